@@ -0,0 +1,35 @@
+#include <HeadlessSurface.hpp>
+
+HeadlessSurface::HeadlessSurface(const Args& arguments) noexcept
+	: m_instanceRef{ arguments.instance }, m_surface{ VK_NULL_HANDLE } {
+	// Extension entry points aren't exported by the loader, so it has to be queried.
+	auto createHeadlessSurface = reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(
+		vkGetInstanceProcAddr(m_instanceRef, "vkCreateHeadlessSurfaceEXT")
+	);
+
+	if (!createHeadlessSurface)
+		return;
+
+	VkHeadlessSurfaceCreateInfoEXT createInfo{
+		.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT
+	};
+
+	if (createHeadlessSurface(m_instanceRef, &createInfo, nullptr, &m_surface) != VK_SUCCESS)
+		m_surface = VK_NULL_HANDLE;
+}
+
+HeadlessSurface::~HeadlessSurface() noexcept {
+	if (m_surface != VK_NULL_HANDLE)
+		vkDestroySurfaceKHR(m_instanceRef, m_surface, nullptr);
+}
+
+VkSurfaceKHR HeadlessSurface::GetSurface() const noexcept {
+	return m_surface;
+}
+
+std::vector<const char*> HeadlessSurface::GetRequiredExtensions() noexcept {
+	return {
+		VK_KHR_SURFACE_EXTENSION_NAME,
+		VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME
+	};
+}
@@ -0,0 +1,29 @@
+#ifndef HEADLESS_SURFACE_HPP_
+#define HEADLESS_SURFACE_HPP_
+#include <vulkan/vulkan.hpp>
+#include <vector>
+
+class HeadlessSurface {
+public:
+	struct Args {
+		VkInstance instance;
+	};
+
+public:
+	HeadlessSurface(const Args& arguments) noexcept;
+	~HeadlessSurface() noexcept;
+
+	HeadlessSurface(const HeadlessSurface&) = delete;
+	HeadlessSurface& operator=(const HeadlessSurface&) = delete;
+
+	[[nodiscard]]
+	VkSurfaceKHR GetSurface() const noexcept;
+
+	[[nodiscard]]
+	static std::vector<const char*> GetRequiredExtensions() noexcept;
+
+private:
+	VkInstance m_instanceRef;
+	VkSurfaceKHR m_surface;
+};
+#endif
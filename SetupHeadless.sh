@@ -0,0 +1,6 @@
+#!/bin/sh
+# Pass the ICD manifest of a software driver to run the tests without a GPU, e.g.
+# ./SetupHeadless.sh /usr/share/vulkan/icd.d/lvp_icd.x86_64.json
+mkdir -p ./Build
+cd ./Build
+cmake .. -G "Unix Makefiles" -DCMAKE_BUILD_TYPE=Debug -DPLATFORM:STRING=LINUX -DBRANCH=dev -DGOOGLE_TEST_COMMIT_ID=12a5852e451baabc79c63a86c634912c563d57bc -DSOFTWARE_ICD:FILEPATH="$1"
@@ -0,0 +1,27 @@
+#include <AllocationCounter.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<size_t> s_allocationCount = 0u;
+
+size_t GetAllocationCount() noexcept {
+	return s_allocationCount.load(std::memory_order_relaxed);
+}
+
+void* operator new(size_t size) {
+	s_allocationCount.fetch_add(1u, std::memory_order_relaxed);
+
+	if (void* memory = std::malloc(size == 0u ? 1u : size))
+		return memory;
+
+	throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+	std::free(memory);
+}
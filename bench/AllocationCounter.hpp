@@ -0,0 +1,9 @@
+#ifndef ALLOCATION_COUNTER_HPP_
+#define ALLOCATION_COUNTER_HPP_
+#include <cstddef>
+
+// Counts the calls to the global operator new, which is replaced in AllocationCounter.cpp.
+// Allocations the driver makes through malloc or its own allocator aren't counted.
+[[nodiscard]]
+size_t GetAllocationCount() noexcept;
+#endif
@@ -0,0 +1,894 @@
+#include <benchmark/benchmark.h>
+#include <Terra.hpp>
+#include <ObjectManager.hpp>
+#include <VkResourceViews.hpp>
+#include <SpirvShader.hpp>
+#include <VKPipelineObject.hpp>
+#include <PipelineLayout.hpp>
+#include <VKRenderPass.hpp>
+#include <TerraBringUp.hpp>
+#include <AllocationCounter.hpp>
+#include <PipelineBatch.hpp>
+#include <ThreadPool.hpp>
+#include <DeviceMemoryPool.hpp>
+#include <DescriptorUpdateBuilder.hpp>
+#include <FrameDescriptorAllocator.hpp>
+#include <JobSystem.hpp>
+#include <ParallelCommandRecorder.hpp>
+#include <InitGraph.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+#include <memory>
+#include <string>
+
+#ifndef TERRA_BRANCH
+#define TERRA_BRANCH "unknown"
+#endif
+
+static void SetPerCallCounters(
+	benchmark::State& state, size_t callsPerIteration, size_t allocations
+) {
+	const auto callCount = static_cast<double>(state.iterations() * callsPerIteration);
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(callCount));
+	state.counters["timePerCall"] = benchmark::Counter(
+		static_cast<double>(callsPerIteration),
+		benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+	);
+	state.counters["allocsPerCall"] = static_cast<double>(allocations) / callCount;
+}
+
+[[nodiscard]]
+static std::vector<std::unique_ptr<VkResourceView>> CreateResourceViews(
+	VkDevice logicalDevice, size_t objectCount, std::uint32_t bufferCount, bool bindMemory
+) {
+	std::vector<std::unique_ptr<VkResourceView>> resourceViews;
+
+	for (size_t index = 0u; index < objectCount; ++index) {
+		auto& resourceView = resourceViews.emplace_back(
+			std::make_unique<VkResourceView>(logicalDevice)
+		);
+
+		resourceView->CreateResource(
+			logicalDevice, BenchValues::testBufferSize, bufferCount,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+		);
+		resourceView->SetMemoryOffsetAndType(logicalDevice, MemoryType::gpuOnly);
+	}
+
+	if (bindMemory) {
+		Terra::Resources::gpuOnlyMemory->AllocateMemory(logicalDevice);
+
+		for (auto& resourceView : resourceViews)
+			resourceView->BindResourceToMemory(logicalDevice);
+	}
+
+	return resourceViews;
+}
+
+static void BM_InitResources(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		ObjectManager objectManager;
+
+		const size_t allocationStart = GetAllocationCount();
+		Terra::InitResources(objectManager, physicalDevice, logicalDevice);
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		objectManager.StartCleanUp();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, 1u, allocations);
+}
+BENCHMARK(BM_InitResources)->Unit(benchmark::kMicrosecond);
+
+static void BM_CreateResource(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto objectCount = static_cast<size_t>(state.range(0));
+	const auto bufferCount = static_cast<std::uint32_t>(state.range(1));
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		std::vector<std::unique_ptr<VkResourceView>> resourceViews;
+		for (size_t index = 0u; index < objectCount; ++index)
+			resourceViews.emplace_back(std::make_unique<VkResourceView>(logicalDevice));
+		state.ResumeTiming();
+
+		const size_t allocationStart = GetAllocationCount();
+		for (auto& resourceView : resourceViews)
+			resourceView->CreateResource(
+				logicalDevice, BenchValues::testBufferSize, bufferCount,
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+			);
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		resourceViews.clear();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, objectCount, allocations);
+}
+BENCHMARK(BM_CreateResource)
+	->ArgNames({ "objects", "buffers" })
+	->ArgsProduct({ { 1, 16, 256 }, { 1, 2, 3 } })
+	->Unit(benchmark::kMicrosecond);
+
+static void BM_BindResourceToMemory(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto objectCount = static_cast<size_t>(state.range(0));
+	const auto bufferCount = static_cast<std::uint32_t>(state.range(1));
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		ObjectManager objectManager;
+		Terra::InitResources(objectManager, physicalDevice, logicalDevice);
+
+		auto resourceViews = CreateResourceViews(
+			logicalDevice, objectCount, bufferCount, false
+		);
+		Terra::Resources::gpuOnlyMemory->AllocateMemory(logicalDevice);
+		state.ResumeTiming();
+
+		const size_t allocationStart = GetAllocationCount();
+		for (auto& resourceView : resourceViews)
+			resourceView->BindResourceToMemory(logicalDevice);
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		resourceViews.clear();
+		objectManager.StartCleanUp();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, objectCount, allocations);
+}
+BENCHMARK(BM_BindResourceToMemory)
+	->ArgNames({ "objects", "buffers" })
+	->ArgsProduct({ { 1, 16, 256 }, { 1, 2, 3 } })
+	->Unit(benchmark::kMicrosecond);
+
+static void BM_CreateDescriptorSets(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto objectCount = static_cast<size_t>(state.range(0));
+	const auto bufferCount = static_cast<std::uint32_t>(state.range(1));
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		ObjectManager objectManager;
+		Terra::InitResources(objectManager, physicalDevice, logicalDevice);
+		Terra::InitDescriptorSets(objectManager, logicalDevice, bufferCount);
+
+		auto resourceViews = CreateResourceViews(logicalDevice, objectCount, bufferCount, true);
+
+		for (size_t index = 0u; index < objectCount; ++index) {
+			DescriptorInfo descInfo{
+				.bindingSlot = static_cast<std::uint32_t>(index),
+				.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+			};
+
+			Terra::graphicsDescriptorSet->AddBuffersSplit(
+				descInfo, resourceViews[index]->GetDescBufferInfoSplit(bufferCount),
+				VK_SHADER_STAGE_ALL
+			);
+		}
+		state.ResumeTiming();
+
+		const size_t allocationStart = GetAllocationCount();
+		Terra::graphicsDescriptorSet->CreateDescriptorSets(logicalDevice);
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		resourceViews.clear();
+		objectManager.StartCleanUp();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, 1u, allocations);
+}
+BENCHMARK(BM_CreateDescriptorSets)
+	->ArgNames({ "bindings", "buffers" })
+	->ArgsProduct({ { 1, 8, 32 }, { 1, 2, 3 } })
+	->Unit(benchmark::kMicrosecond);
+
+[[nodiscard]]
+static std::unique_ptr<SpirvShader> CreateShader(VkDevice logicalDevice, const wchar_t* fileName) {
+	auto shader = std::make_unique<SpirvShader>(logicalDevice);
+	shader->CreateShader(logicalDevice, BenchValues::shaderPath + std::wstring(fileName));
+
+	return shader;
+}
+
+template<typename CreatePipeline>
+static void TimePipelineCreation(benchmark::State& state, CreatePipeline&& createPipeline) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto pipelineCount = static_cast<size_t>(state.range(0));
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines;
+		for (size_t index = 0u; index < pipelineCount; ++index)
+			pipelines.emplace_back(std::make_unique<VkPipelineObject>(logicalDevice));
+		state.ResumeTiming();
+
+		const size_t allocationStart = GetAllocationCount();
+		for (auto& pipeline : pipelines)
+			createPipeline(*pipeline);
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		pipelines.clear();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, pipelineCount, allocations);
+}
+
+static void BM_CreateGraphicsPipelineVS(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(nullptr, 0u);
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	auto vertexShader = CreateShader(logicalDevice, L"VertexShaderTest.spv");
+	auto fragmentShader = CreateShader(logicalDevice, L"FragmentShaderTest.spv");
+
+	TimePipelineCreation(state, [&](VkPipelineObject& pipeline) {
+		pipeline.CreateGraphicsPipelineVS(
+			logicalDevice, pipeLayout, vkRenderPass,
+			VertexLayout()
+			.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+			.InitLayout(), vertexShader->GetShaderModule(), fragmentShader->GetShaderModule()
+		);
+	});
+}
+BENCHMARK(BM_CreateGraphicsPipelineVS)
+	->ArgName("pipelines")->Arg(1)->Arg(16)->Unit(benchmark::kMillisecond);
+
+static void BM_CreateGraphicsPipelineMS(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(nullptr, 0u);
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	auto meshShader = CreateShader(logicalDevice, L"MeshShaderTest.spv");
+	auto fragmentShader = CreateShader(logicalDevice, L"FragmentShaderTest.spv");
+
+	TimePipelineCreation(state, [&](VkPipelineObject& pipeline) {
+		pipeline.CreateGraphicsPipelineMS(
+			logicalDevice, pipeLayout, vkRenderPass,
+			meshShader->GetShaderModule(), fragmentShader->GetShaderModule()
+		);
+	});
+}
+BENCHMARK(BM_CreateGraphicsPipelineMS)
+	->ArgName("pipelines")->Arg(1)->Arg(16)->Unit(benchmark::kMillisecond);
+
+// Builds pipelineCount descriptions, cycling through the compute, vertex and mesh shader
+// pipelines made from the shaders in shaders/src.
+class PipelineBatchFixture {
+public:
+	PipelineBatchFixture(VkDevice logicalDevice)
+		: m_layout{ logicalDevice }, m_renderPass{ logicalDevice },
+		m_computeShader{ CreateShader(logicalDevice, L"ComputeShaderTest.spv") },
+		m_vertexShader{ CreateShader(logicalDevice, L"VertexShaderTest.spv") },
+		m_meshShader{ CreateShader(logicalDevice, L"MeshShaderTest.spv") },
+		m_fragmentShader{ CreateShader(logicalDevice, L"FragmentShaderTest.spv") } {
+		m_layout.CreateLayout(nullptr, 0u);
+		m_renderPass.CreateRenderPass(
+			logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT
+		);
+	}
+
+	[[nodiscard]]
+	std::vector<PipelineDesc> GetPipelineDescs(size_t pipelineCount) const {
+		std::vector<PipelineDesc> pipelineDescs;
+
+		for (size_t index = 0u; index < pipelineCount; ++index) {
+			if (index % 3u == 0u)
+				pipelineDescs.emplace_back(ComputePipelineDesc{
+					.layout = m_layout.GetLayout(),
+					.computeShader = m_computeShader->GetShaderModule()
+				});
+			else if (index % 3u == 1u)
+				pipelineDescs.emplace_back(GraphicsPipelineVSDesc{
+					.layout = m_layout.GetLayout(),
+					.renderPass = m_renderPass.GetRenderPass(),
+					.vertexLayout = VertexLayout()
+						.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+						.InitLayout(),
+					.vertexShader = m_vertexShader->GetShaderModule(),
+					.fragmentShader = m_fragmentShader->GetShaderModule()
+				});
+			else
+				pipelineDescs.emplace_back(GraphicsPipelineMSDesc{
+					.layout = m_layout.GetLayout(),
+					.renderPass = m_renderPass.GetRenderPass(),
+					.meshShader = m_meshShader->GetShaderModule(),
+					.fragmentShader = m_fragmentShader->GetShaderModule()
+				});
+		}
+
+		return pipelineDescs;
+	}
+
+private:
+	PipelineLayout m_layout;
+	VKRenderPass m_renderPass;
+	std::unique_ptr<SpirvShader> m_computeShader;
+	std::unique_ptr<SpirvShader> m_vertexShader;
+	std::unique_ptr<SpirvShader> m_meshShader;
+	std::unique_ptr<SpirvShader> m_fragmentShader;
+};
+
+static void BM_CreatePipelinesSerial(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto pipelineCount = static_cast<size_t>(state.range(0));
+
+	PipelineBatchFixture batchFixture{ logicalDevice };
+	const std::vector<PipelineDesc> pipelineDescs = batchFixture.GetPipelineDescs(pipelineCount);
+
+	for (auto _ : state) {
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines;
+
+		for (const PipelineDesc& pipelineDesc : pipelineDescs)
+			pipelines.emplace_back(CreatePipeline(logicalDevice, pipelineDesc));
+
+		state.PauseTiming();
+		pipelines.clear();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * pipelineCount));
+}
+BENCHMARK(BM_CreatePipelinesSerial)
+	->ArgName("pipelines")->Arg(32)->Arg(128)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_CreatePipelinesParallel(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto pipelineCount = static_cast<size_t>(state.range(0));
+	const auto threadCount = static_cast<size_t>(state.range(1));
+
+	PipelineBatchFixture batchFixture{ logicalDevice };
+	const std::vector<PipelineDesc> pipelineDescs = batchFixture.GetPipelineDescs(pipelineCount);
+
+	ThreadPool threadPool{ threadCount };
+
+	for (auto _ : state) {
+		auto pipelineFutures = CreatePipelinesAsync(threadPool, logicalDevice, pipelineDescs);
+
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines;
+		for (auto& pipelineFuture : pipelineFutures)
+			pipelines.emplace_back(pipelineFuture.get());
+
+		state.PauseTiming();
+		pipelines.clear();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * pipelineCount));
+}
+// The work happens on the pool, so only the wall time is meaningful.
+BENCHMARK(BM_CreatePipelinesParallel)
+	->ArgNames({ "pipelines", "threads" })
+	->ArgsProduct({ { 32, 128 }, { 2, 4, 8, 16 } })
+	->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Cold start of the pipeline state: the shader modules, the layout and the render pass only
+// need the device, and each pipeline only needs its own shaders. With one thread the graph runs
+// in sequence, which is how the fixture brings things up.
+static void BM_InitGraphPipelines(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto pipelineCount = static_cast<size_t>(state.range(0));
+	const auto threadCount = static_cast<size_t>(state.range(1));
+
+	ThreadPool threadPool{ threadCount };
+
+	double criticalPathUs = 0.0;
+
+	for (auto _ : state) {
+		PipelineLayout layout{ logicalDevice };
+		VKRenderPass renderPass{ logicalDevice };
+		std::array<std::unique_ptr<SpirvShader>, 4u> shaders{};
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines(pipelineCount);
+
+		InitGraph initGraph{};
+
+		const InitGraph::NodeId layoutNode = initGraph.AddNode(
+			"layout", [&layout] { layout.CreateLayout(nullptr, 0u); }
+		);
+		const InitGraph::NodeId renderPassNode = initGraph.AddNode(
+			"renderPass",
+			[&renderPass, logicalDevice] {
+				renderPass.CreateRenderPass(
+					logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT
+				);
+			}
+		);
+
+		constexpr std::array<const wchar_t*, 4u> shaderNames{
+			L"ComputeShaderTest.spv", L"VertexShaderTest.spv", L"MeshShaderTest.spv",
+			L"FragmentShaderTest.spv"
+		};
+
+		std::array<InitGraph::NodeId, 4u> shaderNodes{};
+		for (size_t index = 0u; index < std::size(shaderNames); ++index)
+			shaderNodes[index] = initGraph.AddNode(
+				"shader" + std::to_string(index),
+				[&shaders, index, logicalDevice, shaderName = shaderNames[index]] {
+					shaders[index] = CreateShader(logicalDevice, shaderName);
+				}
+			);
+
+		for (size_t index = 0u; index < pipelineCount; ++index) {
+			const size_t kind = index % 3u;
+
+			const InitGraph::NodeId pipelineNode = initGraph.AddNode(
+				"pipeline" + std::to_string(index),
+				[&, index, kind] {
+					PipelineDesc pipelineDesc = ComputePipelineDesc{
+						.layout = layout.GetLayout(),
+						.computeShader = shaders[0]->GetShaderModule()
+					};
+
+					if (kind == 1u)
+						pipelineDesc = GraphicsPipelineVSDesc{
+							.layout = layout.GetLayout(),
+							.renderPass = renderPass.GetRenderPass(),
+							.vertexLayout = VertexLayout()
+								.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+								.InitLayout(),
+							.vertexShader = shaders[1]->GetShaderModule(),
+							.fragmentShader = shaders[3]->GetShaderModule()
+						};
+					else if (kind == 2u)
+						pipelineDesc = GraphicsPipelineMSDesc{
+							.layout = layout.GetLayout(),
+							.renderPass = renderPass.GetRenderPass(),
+							.meshShader = shaders[2]->GetShaderModule(),
+							.fragmentShader = shaders[3]->GetShaderModule()
+						};
+
+					pipelines[index] = CreatePipeline(logicalDevice, pipelineDesc);
+				},
+				[&pipelines, index] { pipelines[index].reset(); }
+			);
+
+			initGraph.AddDependency(pipelineNode, layoutNode);
+			initGraph.AddDependency(pipelineNode, shaderNodes[kind]);
+
+			if (kind != 0u) {
+				initGraph.AddDependency(pipelineNode, renderPassNode);
+				initGraph.AddDependency(pipelineNode, shaderNodes[3]);
+			}
+		}
+
+		if (!initGraph.Run(threadPool)) {
+			state.SkipWithError("The init graph has a cycle.");
+
+			break;
+		}
+
+		state.PauseTiming();
+		criticalPathUs = static_cast<double>(initGraph.GetCriticalPathDuration().count());
+		initGraph.Teardown();
+		state.ResumeTiming();
+	}
+
+	// What the start up would take with unlimited threads.
+	state.counters["criticalPathUs"] = criticalPathUs;
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * pipelineCount));
+}
+BENCHMARK(BM_InitGraphPipelines)
+	->ArgNames({ "pipelines", "threads" })
+	->ArgsProduct({ { 12, 48 }, { 1, 2, 4, 8 } })
+	->Unit(benchmark::kMillisecond)->UseRealTime();
+
+[[nodiscard]]
+static VkDeviceSize GetStorageBufferStride(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceProperties deviceProperties{};
+	vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+
+	const VkDeviceSize alignment = deviceProperties.limits.minStorageBufferOffsetAlignment;
+
+	return (BenchValues::testBufferSize + alignment - 1u) / alignment * alignment;
+}
+
+// A descriptor set with one storage buffer array of descriptorCount elements, each pointing at
+// its own part of a single buffer. The parts are aligned to minStorageBufferOffsetAlignment.
+class DescriptorWriteFixture {
+public:
+	DescriptorWriteFixture(
+		VkDevice logicalDevice, VkPhysicalDevice physicalDevice, std::uint32_t descriptorCount
+	) : m_deviceRef{ logicalDevice }, m_setLayout{ VK_NULL_HANDLE }, m_pool{ VK_NULL_HANDLE },
+		m_descriptorSet{ VK_NULL_HANDLE }, m_buffer{ VK_NULL_HANDLE },
+		m_memoryPool{
+			logicalDevice,
+			DeviceMemoryPool::Args{
+				.physicalDevice = physicalDevice,
+				.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+				.blockSize = GetStorageBufferStride(physicalDevice) * descriptorCount * 2u,
+				.strategy = AllocatorStrategy::Linear
+			}
+		} {
+		const VkDeviceSize bufferStride = GetStorageBufferStride(physicalDevice);
+
+		VkDescriptorSetLayoutBinding binding{
+			.binding = 0u,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.descriptorCount = descriptorCount,
+			.stageFlags = VK_SHADER_STAGE_ALL
+		};
+
+		VkDescriptorSetLayoutCreateInfo layoutInfo{
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+			.bindingCount = 1u,
+			.pBindings = &binding
+		};
+		vkCreateDescriptorSetLayout(logicalDevice, &layoutInfo, nullptr, &m_setLayout);
+
+		VkDescriptorPoolSize poolSize{
+			.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.descriptorCount = descriptorCount
+		};
+
+		VkDescriptorPoolCreateInfo poolInfo{
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+			.maxSets = 1u,
+			.poolSizeCount = 1u,
+			.pPoolSizes = &poolSize
+		};
+		vkCreateDescriptorPool(logicalDevice, &poolInfo, nullptr, &m_pool);
+
+		VkDescriptorSetAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			.descriptorPool = m_pool,
+			.descriptorSetCount = 1u,
+			.pSetLayouts = &m_setLayout
+		};
+		vkAllocateDescriptorSets(logicalDevice, &allocInfo, &m_descriptorSet);
+
+		VkBufferCreateInfo bufferInfo{
+			.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+			.size = bufferStride * descriptorCount,
+			.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+			.sharingMode = VK_SHARING_MODE_EXCLUSIVE
+		};
+		vkCreateBuffer(logicalDevice, &bufferInfo, nullptr, &m_buffer);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, m_buffer, &requirements);
+
+		if (std::optional<MemoryAllocation> allocation = m_memoryPool.Allocate(
+			logicalDevice, requirements
+		))
+			vkBindBufferMemory(logicalDevice, m_buffer, allocation->memory, allocation->offset);
+
+		for (std::uint32_t index = 0u; index < descriptorCount; ++index)
+			m_bufferInfos.emplace_back(VkDescriptorBufferInfo{
+				.buffer = m_buffer,
+				.offset = bufferStride * index,
+				.range = BenchValues::testBufferSize
+			});
+	}
+
+	~DescriptorWriteFixture() noexcept {
+		vkDestroyBuffer(m_deviceRef, m_buffer, nullptr);
+		vkDestroyDescriptorPool(m_deviceRef, m_pool, nullptr);
+		vkDestroyDescriptorSetLayout(m_deviceRef, m_setLayout, nullptr);
+	}
+
+	DescriptorWriteFixture(const DescriptorWriteFixture&) = delete;
+	DescriptorWriteFixture& operator=(const DescriptorWriteFixture&) = delete;
+
+	[[nodiscard]]
+	VkDescriptorSetLayout GetSetLayout() const noexcept { return m_setLayout; }
+	[[nodiscard]]
+	VkDescriptorSet GetDescriptorSet() const noexcept { return m_descriptorSet; }
+	[[nodiscard]]
+	const std::vector<VkDescriptorBufferInfo>& GetBufferInfos() const noexcept {
+		return m_bufferInfos;
+	}
+
+private:
+	VkDevice m_deviceRef;
+	VkDescriptorSetLayout m_setLayout;
+	VkDescriptorPool m_pool;
+	VkDescriptorSet m_descriptorSet;
+	VkBuffer m_buffer;
+	DeviceMemoryPool m_memoryPool;
+	std::vector<VkDescriptorBufferInfo> m_bufferInfos;
+};
+
+// Terra's own path: every resource view returns its infos from GetDescBufferInfoSplit, they
+// are moved into the graphics descriptor set with AddBuffersSplit, one binding per view, and
+// written by CreateDescriptorSets. Terra can't rewrite the descriptors of a set it already
+// created, so the time includes creating the layout, pool and set, as any change does there.
+static void BM_DescriptorWritesAdHoc(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto descriptorCount = static_cast<std::uint32_t>(state.range(0));
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		state.PauseTiming();
+		ObjectManager objectManager;
+		Terra::InitResources(objectManager, physicalDevice, logicalDevice);
+		Terra::InitDescriptorSets(objectManager, logicalDevice, 1u);
+
+		auto resourceViews = CreateResourceViews(logicalDevice, descriptorCount, 1u, true);
+		state.ResumeTiming();
+
+		const size_t allocationStart = GetAllocationCount();
+
+		for (std::uint32_t index = 0u; index < descriptorCount; ++index) {
+			DescriptorInfo descInfo{
+				.bindingSlot = index,
+				.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+			};
+
+			Terra::graphicsDescriptorSet->AddBuffersSplit(
+				descInfo, resourceViews[index]->GetDescBufferInfoSplit(1u), VK_SHADER_STAGE_ALL
+			);
+		}
+
+		Terra::graphicsDescriptorSet->CreateDescriptorSets(logicalDevice);
+
+		allocations += GetAllocationCount() - allocationStart;
+
+		state.PauseTiming();
+		resourceViews.clear();
+		objectManager.StartCleanUp();
+		state.ResumeTiming();
+	}
+
+	SetPerCallCounters(state, descriptorCount, allocations);
+}
+BENCHMARK(BM_DescriptorWritesAdHoc)
+	->ArgName("descriptors")->Arg(1'024)->Arg(4'096)->Unit(benchmark::kMicrosecond);
+
+static void BM_DescriptorWritesBatched(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto descriptorCount = static_cast<std::uint32_t>(state.range(0));
+
+	DescriptorWriteFixture writeFixture{ logicalDevice, physicalDevice, descriptorCount };
+	const std::vector<VkDescriptorBufferInfo>& bufferInfos = writeFixture.GetBufferInfos();
+
+	DescriptorUpdateBuilder updateBuilder{
+		logicalDevice,
+		DescriptorUpdateBuilder::Args{
+			.writeCapacity = 64u,
+			.bufferInfoCapacity = descriptorCount,
+			.imageInfoCapacity = 0u
+		}
+	};
+
+	size_t allocations = 0u;
+
+	for (auto _ : state) {
+		const size_t allocationStart = GetAllocationCount();
+
+		for (std::uint32_t index = 0u; index < descriptorCount; ++index)
+			updateBuilder.AddBuffer(
+				writeFixture.GetDescriptorSet(), 0u, index, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+				bufferInfos[index]
+			);
+
+		updateBuilder.Flush();
+
+		allocations += GetAllocationCount() - allocationStart;
+	}
+
+	SetPerCallCounters(state, descriptorCount, allocations);
+}
+BENCHMARK(BM_DescriptorWritesBatched)
+	->ArgName("descriptors")->Arg(1'024)->Arg(4'096)->Unit(benchmark::kMicrosecond);
+
+static void BM_DescriptorSetsFreeIndividually(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto setCount = static_cast<std::uint32_t>(state.range(0));
+
+	DescriptorWriteFixture writeFixture{ logicalDevice, physicalDevice, 1u };
+	VkDescriptorSetLayout setLayout = writeFixture.GetSetLayout();
+
+	VkDescriptorPoolSize poolSize{
+		.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+		.descriptorCount = setCount
+	};
+
+	VkDescriptorPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+		.maxSets = setCount,
+		.poolSizeCount = 1u,
+		.pPoolSizes = &poolSize
+	};
+
+	VkDescriptorPool pool = VK_NULL_HANDLE;
+	vkCreateDescriptorPool(logicalDevice, &poolInfo, nullptr, &pool);
+
+	std::vector<VkDescriptorSet> descriptorSets(setCount, VK_NULL_HANDLE);
+
+	for (auto _ : state) {
+		for (VkDescriptorSet& descriptorSet : descriptorSets) {
+			VkDescriptorSetAllocateInfo allocInfo{
+				.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+				.descriptorPool = pool,
+				.descriptorSetCount = 1u,
+				.pSetLayouts = &setLayout
+			};
+
+			vkAllocateDescriptorSets(logicalDevice, &allocInfo, &descriptorSet);
+		}
+
+		for (VkDescriptorSet descriptorSet : descriptorSets)
+			vkFreeDescriptorSets(logicalDevice, pool, 1u, &descriptorSet);
+	}
+
+	vkDestroyDescriptorPool(logicalDevice, pool, nullptr);
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * setCount));
+}
+BENCHMARK(BM_DescriptorSetsFreeIndividually)
+	->ArgName("sets")->Arg(1'024)->Arg(4'096)->Unit(benchmark::kMicrosecond);
+
+static void BM_DescriptorSetsFrameReset(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const auto setCount = static_cast<std::uint32_t>(state.range(0));
+
+	DescriptorWriteFixture writeFixture{ logicalDevice, physicalDevice, 1u };
+	VkDescriptorSetLayout setLayout = writeFixture.GetSetLayout();
+
+	FrameDescriptorAllocator frameAllocator{
+		logicalDevice,
+		FrameDescriptorAllocator::Args{
+			.frameCount = BenchValues::bufferCount,
+			.setsPerPool = 256u,
+			.poolSizes = {
+				VkDescriptorPoolSize{
+					.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+					.descriptorCount = 256u
+				}
+			}
+		}
+	};
+
+	size_t frameIndex = 0u;
+
+	for (auto _ : state) {
+		frameAllocator.BeginFrame(logicalDevice, frameIndex);
+
+		for (std::uint32_t index = 0u; index < setCount; ++index)
+			benchmark::DoNotOptimize(frameAllocator.Allocate(logicalDevice, setLayout));
+
+		frameIndex = (frameIndex + 1u) % BenchValues::bufferCount;
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * setCount));
+}
+BENCHMARK(BM_DescriptorSetsFrameReset)
+	->ArgName("sets")->Arg(1'024)->Arg(4'096)->Unit(benchmark::kMicrosecond);
+
+// Records drawCount draws of a vertex shader pipeline into secondary command buffers, spread
+// over the workers of a JobSystem. The chunks are small enough for every worker to get a few,
+// so stealing can balance them.
+static void BM_RecordDraws(benchmark::State& state) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	const auto drawCount = static_cast<size_t>(state.range(0));
+	const auto threadCount = static_cast<size_t>(state.range(1));
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(nullptr, 0u);
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	auto vertexShader = CreateShader(logicalDevice, L"VertexShaderTest.spv");
+	auto fragmentShader = CreateShader(logicalDevice, L"FragmentShaderTest.spv");
+
+	VkPipelineObject pipeline{ logicalDevice };
+	pipeline.CreateGraphicsPipelineVS(
+		logicalDevice, layout.GetLayout(), renderPass.GetRenderPass(),
+		VertexLayout()
+		.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+		.InitLayout(), vertexShader->GetShaderModule(), fragmentShader->GetShaderModule()
+	);
+	VkPipeline vkPipeline = pipeline.GetPipeline();
+
+	VkQueueFamilyMananger queFamilyMan = Terra::device->GetQueueFamilyManager();
+
+	JobSystem jobSystem{ threadCount };
+	ParallelCommandRecorder commandRecorder{
+		logicalDevice,
+		ParallelCommandRecorder::Args{
+			.queueFamilyIndex = queFamilyMan.GetIndex(GraphicsQueue),
+			.frameCount = BenchValues::bufferCount,
+			.threadCount = threadCount
+		}
+	};
+
+	VkCommandBufferInheritanceInfo inheritanceInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+		.renderPass = renderPass.GetRenderPass(),
+		.subpass = 0u
+	};
+
+	const size_t chunkSize = std::max<size_t>(drawCount / (threadCount * 4u), 64u);
+	size_t frameIndex = 0u;
+
+	for (auto _ : state) {
+		// Nothing is submitted, so the pools can be reset straight away.
+		commandRecorder.BeginFrame(logicalDevice, frameIndex);
+
+		std::vector<VkCommandBuffer> secondaries = commandRecorder.RecordSecondaries(
+			logicalDevice, jobSystem, drawCount, chunkSize, inheritanceInfo,
+			[vkPipeline](VkCommandBuffer commandBuffer, size_t begin, size_t end) {
+				vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, vkPipeline);
+
+				for (size_t index = begin; index < end; ++index)
+					vkCmdDraw(commandBuffer, 3u, 1u, 0u, static_cast<std::uint32_t>(index));
+			}
+		);
+		benchmark::DoNotOptimize(std::data(secondaries));
+
+		frameIndex = (frameIndex + 1u) % BenchValues::bufferCount;
+	}
+
+	state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * drawCount));
+	state.counters["stolenChunks"] = static_cast<double>(jobSystem.GetStealCount());
+}
+// The recording happens on the workers, so only the wall time is meaningful.
+BENCHMARK(BM_RecordDraws)
+	->ArgNames({ "draws", "threads" })
+	->ArgsProduct({ { 1'024, 16'384 }, { 1, 2, 4, 8 } })
+	->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+int main(int argc, char** argv) {
+	benchmark::Initialize(&argc, argv);
+
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::AddCustomContext("terraBranch", TERRA_BRANCH);
+
+	{
+		TerraBringUp bringUp{};
+
+		benchmark::RunSpecifiedBenchmarks();
+	}
+
+	benchmark::Shutdown();
+
+	return 0;
+}
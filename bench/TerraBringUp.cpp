@@ -0,0 +1,70 @@
+#include <TerraBringUp.hpp>
+#include <Terra.hpp>
+#include <VkResourceViews.hpp>
+
+TerraBringUp::TerraBringUp()
+#ifdef TERRA_WIN32
+	: m_window{ BenchValues::windowWidth, BenchValues::windowHeight, BenchValues::appName }
+#endif
+{
+	Terra::InitDisplay(m_objectManager);
+
+	m_objectManager.CreateObject(Terra::vkInstance, { BenchValues::appName }, 5u);
+	Terra::vkInstance->AddExtensionNames(Terra::display->GetRequiredExtensions());
+#ifndef TERRA_WIN32
+	Terra::vkInstance->AddExtensionNames(HeadlessSurface::GetRequiredExtensions());
+#endif
+	Terra::vkInstance->CreateInstance();
+
+	VkInstance vkInstance = Terra::vkInstance->GetVKInstance();
+
+#ifdef _DEBUG
+	m_objectManager.CreateObject(Terra::debugLayer, { vkInstance }, 4u);
+#endif
+
+#ifdef TERRA_WIN32
+	Terra::InitSurface(
+		m_objectManager, vkInstance, m_window.GetWindowHandle(), m_window.GetModuleInstance()
+	);
+	VkSurfaceKHR vkSurface = Terra::surface->GetSurface();
+#else
+	m_objectManager.CreateObject(m_headlessSurface, { vkInstance }, 4u);
+	VkSurfaceKHR vkSurface = m_headlessSurface->GetSurface();
+#endif
+
+	m_objectManager.CreateObject(Terra::device, 3u);
+
+	if (BenchValues::meshShader)
+		Terra::device->AddExtensionName("VK_EXT_mesh_shader");
+
+	Terra::device->FindPhysicalDevice(vkInstance, vkSurface);
+	Terra::device->CreateLogicalDevice(BenchValues::meshShader);
+
+	m_queFamilyMan = Terra::device->GetQueueFamilyManager();
+
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	_vkResourceView::SetBufferAlignments(physicalDevice);
+
+	Terra::InitGraphicsQueue(
+		m_objectManager, m_queFamilyMan.GetQueue(GraphicsQueue), logicalDevice,
+		m_queFamilyMan.GetIndex(GraphicsQueue), BenchValues::bufferCount
+	);
+	Terra::InitTransferQueue(
+		m_objectManager, m_queFamilyMan.GetQueue(TransferQueue), logicalDevice,
+		m_queFamilyMan.GetIndex(TransferQueue)
+	);
+	Terra::InitComputeQueue(
+		m_objectManager, m_queFamilyMan.GetQueue(ComputeQueue), logicalDevice,
+		m_queFamilyMan.GetIndex(ComputeQueue), BenchValues::bufferCount
+	);
+}
+
+TerraBringUp::~TerraBringUp() noexcept {
+	m_objectManager.StartCleanUp();
+}
+
+const VkQueueFamilyMananger& TerraBringUp::GetQueueFamilyManager() const noexcept {
+	return m_queFamilyMan;
+}
@@ -0,0 +1,47 @@
+#ifndef TERRA_BRING_UP_HPP_
+#define TERRA_BRING_UP_HPP_
+#include <ObjectManager.hpp>
+#include <VkQueueFamilyManager.hpp>
+#include <memory>
+#include <cstdint>
+#ifdef TERRA_WIN32
+#include <SimpleWindow.hpp>
+#else
+#include <HeadlessSurface.hpp>
+#endif
+
+namespace BenchValues {
+	constexpr std::uint32_t windowWidth = 1920u;
+	constexpr std::uint32_t windowHeight = 1080u;
+	constexpr std::uint32_t bufferCount = 2u;
+	constexpr VkDeviceSize testBufferSize = 128u;
+	constexpr const char* appName = "Terra";
+	constexpr const wchar_t* shaderPath = L"resources/shaders/";
+	constexpr bool meshShader = true;
+}
+
+// Runs the same sequence as the RendererVKTest fixture, from the display to the queues.
+// The resources and the descriptors are left to the benchmarks, so each of them can time
+// those stages on fresh heaps.
+class TerraBringUp {
+public:
+	TerraBringUp();
+	~TerraBringUp() noexcept;
+
+	TerraBringUp(const TerraBringUp&) = delete;
+	TerraBringUp& operator=(const TerraBringUp&) = delete;
+
+	[[nodiscard]]
+	const VkQueueFamilyMananger& GetQueueFamilyManager() const noexcept;
+
+private:
+	ObjectManager m_objectManager;
+	VkQueueFamilyMananger m_queFamilyMan;
+
+#ifdef TERRA_WIN32
+	SimpleWindow m_window;
+#else
+	std::unique_ptr<HeadlessSurface> m_headlessSurface;
+#endif
+};
+#endif
@@ -0,0 +1,85 @@
+#include <DeferredDestructionQueue.hpp>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+namespace {
+	constexpr std::uint64_t framesInFlight = 2u;
+
+	// Frame n can only be known complete once frame n + framesInFlight starts, which is when
+	// its fence gets waited on.
+	[[nodiscard]]
+	std::uint64_t CompletedFrame(std::uint64_t currentFrame) noexcept {
+		return currentFrame >= framesInFlight ? currentFrame - framesInFlight : 0u;
+	}
+}
+
+TEST(DeferredDestructionQueueTest, FrameProgressionTest) {
+	DeferredDestructionQueue destructionQueue{ VK_NULL_HANDLE };
+	std::vector<std::uint64_t> destroyedAt;
+
+	// Starting at frame 1, so a completed value of 0 means nothing has finished yet.
+	for (std::uint64_t frame = 1u; frame <= 10u; ++frame) {
+		destructionQueue.Collect(VK_NULL_HANDLE, CompletedFrame(frame));
+
+		// Every frame retires one resource it still used.
+		destructionQueue.Enqueue(frame, [&destroyedAt, frame](VkDevice) {
+			destroyedAt.emplace_back(frame);
+		});
+
+		// Never destroyed while a frame which might use it is in flight.
+		for (std::uint64_t destroyedFrame : destroyedAt)
+			EXPECT_LE(destroyedFrame + framesInFlight, frame)
+				<< "Resource of frame " << destroyedFrame << " destroyed too early.";
+
+		EXPECT_LE(destructionQueue.GetPendingCount(), framesInFlight + 1u)
+			<< "Resources aren't released once their frame completes.";
+	}
+
+	EXPECT_EQ(std::size(destroyedAt), 10u - framesInFlight) << "Destroyed count doesn't match.";
+
+	EXPECT_EQ(destructionQueue.Flush(VK_NULL_HANDLE), framesInFlight)
+		<< "Flush didn't release the rest.";
+	EXPECT_EQ(destructionQueue.GetPendingCount(), 0u) << "Objects left after the flush.";
+
+	for (size_t index = 0u; index < std::size(destroyedAt); ++index)
+		EXPECT_EQ(destroyedAt[index], index + 1u) << "Destruction order doesn't match.";
+}
+
+TEST(DeferredDestructionQueueTest, OutOfOrderValuesTest) {
+	DeferredDestructionQueue destructionQueue{ VK_NULL_HANDLE };
+	std::vector<int> destroyed;
+
+	auto record = [&destroyed](int id) {
+		return [&destroyed, id](VkDevice) { destroyed.emplace_back(id); };
+	};
+
+	destructionQueue.Enqueue(5u, record(0));
+	destructionQueue.Enqueue(3u, record(1));
+	destructionQueue.Enqueue(5u, record(2));
+	destructionQueue.Enqueue(4u, record(3));
+	destructionQueue.Enqueue(3u, record(4));
+
+	EXPECT_EQ(destructionQueue.Collect(VK_NULL_HANDLE, 2u), 0u) << "Nothing has completed yet.";
+	EXPECT_EQ(destructionQueue.Collect(VK_NULL_HANDLE, 3u), 2u) << "Released count doesn't match.";
+	EXPECT_EQ(destructionQueue.Collect(VK_NULL_HANDLE, 5u), 3u) << "Released count doesn't match.";
+
+	// By value, and in the order they came for equal values.
+	const std::vector<int> expectedOrder{ 1, 4, 3, 0, 2 };
+	EXPECT_EQ(destroyed, expectedOrder) << "Destruction order doesn't match.";
+}
+
+TEST(DeferredDestructionQueueTest, DestructorFlushTest) {
+	size_t destroyedCount = 0u;
+
+	{
+		DeferredDestructionQueue destructionQueue{ VK_NULL_HANDLE };
+
+		for (std::uint64_t value = 0u; value < 4u; ++value)
+			destructionQueue.Enqueue(value + 100u, [&destroyedCount](VkDevice) {
+				++destroyedCount;
+			});
+	}
+
+	EXPECT_EQ(destroyedCount, 4u) << "The destructor leaked pending objects.";
+}
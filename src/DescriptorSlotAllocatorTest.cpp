@@ -0,0 +1,61 @@
+#include <DescriptorSlotAllocator.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+TEST(DescriptorSlotAllocatorTest, AllocateAndFreeTest) {
+	DescriptorSlotAllocator slotAllocator{ 4u };
+
+	std::vector<std::uint32_t> slots;
+	for (std::uint32_t index = 0u; index < 4u; ++index) {
+		std::optional<std::uint32_t> slot = slotAllocator.Allocate();
+		ASSERT_TRUE(slot) << "Allocation failed.";
+		EXPECT_EQ(*slot, index) << "Fresh slots should be handed out in order.";
+
+		slots.emplace_back(*slot);
+	}
+
+	EXPECT_FALSE(slotAllocator.Allocate()) << "Allocated past the capacity.";
+	EXPECT_EQ(slotAllocator.GetUsedCount(), 4u) << "Used count doesn't match.";
+
+	slotAllocator.Free(1u);
+	slotAllocator.Free(3u);
+	EXPECT_EQ(slotAllocator.GetUsedCount(), 2u) << "Used count doesn't match.";
+
+	EXPECT_EQ(slotAllocator.Allocate(), 3u) << "The last freed slot should be reused first.";
+	EXPECT_EQ(slotAllocator.Allocate(), 1u) << "The freed slot wasn't reused.";
+	EXPECT_FALSE(slotAllocator.Allocate()) << "Allocated past the capacity.";
+}
+
+TEST(DescriptorSlotAllocatorTest, DoubleFreeTest) {
+	DescriptorSlotAllocator slotAllocator{ 4u };
+
+	for (std::uint32_t index = 0u; index < 2u; ++index)
+		ASSERT_TRUE(slotAllocator.Allocate()) << "Allocation failed.";
+
+	slotAllocator.Free(1u);
+	slotAllocator.Free(1u);
+	// Neither a slot which was never handed out nor one past the capacity is freed.
+	slotAllocator.Free(2u);
+	slotAllocator.Free(7u);
+	EXPECT_EQ(slotAllocator.GetUsedCount(), 1u) << "Used count doesn't match.";
+
+	EXPECT_EQ(slotAllocator.Allocate(), 1u) << "The freed slot wasn't reused.";
+	EXPECT_EQ(slotAllocator.Allocate(), 2u) << "A slot was handed out twice.";
+	EXPECT_EQ(slotAllocator.GetUsedCount(), 3u) << "Used count doesn't match.";
+}
+
+TEST(DescriptorSlotAllocatorTest, CoalesceSlotsTest) {
+	const std::vector<SlotRange> ranges = CoalesceSlots({ 7u, 2u, 3u, 9u, 4u, 8u, 3u, 12u });
+
+	ASSERT_EQ(std::size(ranges), 3u) << "Range count doesn't match.";
+
+	EXPECT_EQ(ranges[0].firstSlot, 2u) << "Range start doesn't match.";
+	EXPECT_EQ(ranges[0].count, 3u) << "Duplicates should only be written once.";
+	EXPECT_EQ(ranges[1].firstSlot, 7u) << "Range start doesn't match.";
+	EXPECT_EQ(ranges[1].count, 3u) << "Range count doesn't match.";
+	EXPECT_EQ(ranges[2].firstSlot, 12u) << "Range start doesn't match.";
+	EXPECT_EQ(ranges[2].count, 1u) << "Range count doesn't match.";
+
+	EXPECT_TRUE(std::empty(CoalesceSlots({}))) << "No slots should produce no ranges.";
+}
@@ -0,0 +1,108 @@
+#include <FrustumCulling.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace {
+	constexpr std::array<float, 16u> identityMatrix{
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		0.f, 0.f, 0.f, 1.f
+	};
+
+	// Vulkan style perspective looking down -z, column major.
+	[[nodiscard]]
+	std::array<float, 16u> Perspective(float fovY, float aspect, float near, float far) {
+		const float focalLength = 1.f / std::tan(fovY * 0.5f);
+
+		return {
+			focalLength / aspect, 0.f, 0.f, 0.f,
+			0.f, -focalLength, 0.f, 0.f,
+			0.f, 0.f, far / (near - far), -1.f,
+			0.f, 0.f, near * far / (near - far), 0.f
+		};
+	}
+}
+
+TEST(FrustumCullingTest, ExtractPlanesTest) {
+	// Clip space itself, x and y from -1 to 1 and z from 0 to 1.
+	const FrustumPlanes planes = ExtractFrustumPlanes(identityMatrix);
+
+	const std::array<FrustumPlane, 6u> expectedPlanes{
+		FrustumPlane{ 1.f, 0.f, 0.f, 1.f }, FrustumPlane{ -1.f, 0.f, 0.f, 1.f },
+		FrustumPlane{ 0.f, 1.f, 0.f, 1.f }, FrustumPlane{ 0.f, -1.f, 0.f, 1.f },
+		FrustumPlane{ 0.f, 0.f, 1.f, 0.f }, FrustumPlane{ 0.f, 0.f, -1.f, 1.f }
+	};
+
+	for (size_t index = 0u; index < std::size(planes); ++index)
+		for (size_t component = 0u; component < 4u; ++component)
+			EXPECT_FLOAT_EQ(planes[index][component], expectedPlanes[index][component])
+				<< "Plane " << index << " doesn't match.";
+
+	// Normalised, so the distance is in world units.
+	const FrustumPlanes perspectivePlanes = ExtractFrustumPlanes(
+		Perspective(1.5f, 16.f / 9.f, 0.1f, 100.f)
+	);
+
+	for (const FrustumPlane& plane : perspectivePlanes)
+		EXPECT_NEAR(
+			std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]), 1.f, 1e-5f
+		) << "Plane isn't normalised.";
+
+	EXPECT_NEAR(perspectivePlanes[4][3], -0.1f, 1e-4f) << "Near distance doesn't match.";
+	EXPECT_NEAR(perspectivePlanes[5][3], 100.f, 1e-2f) << "Far distance doesn't match.";
+}
+
+TEST(FrustumCullingTest, SphereVisibilityTest) {
+	const FrustumPlanes planes = ExtractFrustumPlanes(Perspective(1.5f, 1.f, 0.1f, 100.f));
+
+	EXPECT_TRUE(IsSphereVisible(planes, { 0.f, 0.f, -10.f, 1.f })) << "Centered sphere culled.";
+	EXPECT_FALSE(IsSphereVisible(planes, { 0.f, 0.f, 10.f, 1.f })) << "Sphere behind visible.";
+	EXPECT_FALSE(IsSphereVisible(planes, { 0.f, 0.f, -200.f, 50.f }))
+		<< "Sphere past the far plane visible.";
+	EXPECT_TRUE(IsSphereVisible(planes, { 0.f, 0.f, -120.f, 30.f }))
+		<< "Sphere crossing the far plane culled.";
+	EXPECT_FALSE(IsSphereVisible(planes, { 100.f, 0.f, -10.f, 1.f }))
+		<< "Sphere on the right visible.";
+	EXPECT_TRUE(IsSphereVisible(planes, { 0.f, 0.f, 0.5f, 1.f }))
+		<< "Sphere around the camera culled.";
+}
+
+TEST(FrustumCullingTest, CullObjectsTest) {
+	const FrustumPlanes planes = ExtractFrustumPlanes(identityMatrix);
+
+	std::mt19937 generator{ 11u };
+	std::uniform_real_distribution<float> position{ -3.f, 3.f };
+	std::uniform_real_distribution<float> radius{ 0.f, 0.5f };
+
+	std::vector<CullObject> objects;
+	for (std::uint32_t index = 0u; index < 1'000u; ++index)
+		objects.emplace_back(CullObject{
+			.sphere = {
+				position(generator), position(generator), position(generator), radius(generator)
+			},
+			.indexCount = index * 3u
+		});
+
+	const std::vector<std::uint32_t> visibleObjects = CullObjects(planes, objects);
+	ASSERT_FALSE(std::empty(visibleObjects)) << "Everything was culled.";
+	EXPECT_LT(std::size(visibleObjects), std::size(objects)) << "Nothing was culled.";
+
+	size_t visibleIndex = 0u;
+	for (std::uint32_t index = 0u; index < std::size(objects); ++index) {
+		const std::array<float, 4u>& sphere = objects[index].sphere;
+
+		// Against the clip space box directly.
+		const bool inside = sphere[0] >= -1.f - sphere[3] && sphere[0] <= 1.f + sphere[3]
+			&& sphere[1] >= -1.f - sphere[3] && sphere[1] <= 1.f + sphere[3]
+			&& sphere[2] >= -sphere[3] && sphere[2] <= 1.f + sphere[3];
+
+		const bool listed = visibleIndex < std::size(visibleObjects)
+			&& visibleObjects[visibleIndex] == index;
+		EXPECT_EQ(listed, inside) << "Visibility of object " << index << " doesn't match.";
+
+		if (listed)
+			++visibleIndex;
+	}
+}
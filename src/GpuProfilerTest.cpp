@@ -0,0 +1,55 @@
+#include <GpuProfiler.hpp>
+#include <ChromeTrace.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+
+TEST(GpuProfilerTest, TimestampDeltaTest) {
+	EXPECT_EQ(GetTimestampDelta(100u, 350u, 64u), 250u) << "Delta doesn't match.";
+	EXPECT_EQ(GetTimestampDelta(100u, 350u, 36u), 250u) << "Delta doesn't match.";
+
+	// A 36 bit counter which wrapped between the two timestamps.
+	constexpr std::uint64_t counterEnd = std::uint64_t{ 1u } << 36u;
+	EXPECT_EQ(GetTimestampDelta(counterEnd - 10u, 5u, 36u), 15u) << "Wrapped delta doesn't match.";
+
+	EXPECT_DOUBLE_EQ(TicksToMicroseconds(1'000u, 1.f), 1.0) << "Conversion doesn't match.";
+	EXPECT_DOUBLE_EQ(TicksToMicroseconds(3'000u, 52.08f), 3.0 * 52.08f)
+		<< "Conversion doesn't match.";
+}
+
+TEST(GpuProfilerTest, ChromeTraceTest) {
+	ChromeTrace trace{};
+
+	{
+		CpuTraceScope frameScope{ trace, "Frame \"1\"", 7u };
+		std::this_thread::sleep_for(std::chrono::milliseconds{ 2 });
+	}
+
+	ASSERT_EQ(std::size(trace.GetEvents()), 1u) << "The CPU scope wasn't added.";
+
+	const TraceEvent& cpuEvent = trace.GetEvents()[0];
+	EXPECT_EQ(cpuEvent.processId, ChromeTrace::cpuProcessId) << "Process doesn't match.";
+	EXPECT_EQ(cpuEvent.threadId, 7u) << "Thread doesn't match.";
+	EXPECT_GE(cpuEvent.durationUs, 2'000.0) << "Duration too short.";
+	EXPECT_GE(cpuEvent.startUs, 0.0) << "Started before the trace.";
+
+	trace.SetThreadName(ChromeTrace::gpuProcessId, 0u, "Graphics");
+	trace.AddEvent(TraceEvent{
+		.name = "Shadows",
+		.category = "gpu",
+		.processId = ChromeTrace::gpuProcessId,
+		.threadId = 0u,
+		.startUs = 12.5,
+		.durationUs = 100.25
+	});
+
+	const std::string json = trace.ToJSON();
+	EXPECT_EQ(json.find("{\"traceEvents\":["), 0u) << "Header doesn't match.";
+	EXPECT_NE(json.find("\"name\":\"Frame \\\"1\\\"\""), std::string::npos)
+		<< "Name isn't escaped.";
+	EXPECT_NE(json.find("\"args\":{\"name\":\"Graphics\"}"), std::string::npos)
+		<< "Thread name is missing.";
+	EXPECT_NE(json.find("\"ts\":12.500,\"dur\":100.250"), std::string::npos)
+		<< "GPU event is missing.";
+	EXPECT_NE(json.find("\"ph\":\"X\",\"pid\":2"), std::string::npos)
+		<< "GPU process doesn't match.";
+}
@@ -0,0 +1,183 @@
+#include <InitGraph.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+
+TEST(InitGraphTest, DependencyOrderTest) {
+	ThreadPool threadPool{ 4u };
+	InitGraph initGraph{};
+
+	std::mutex orderMutex;
+	std::vector<std::string> initOrder;
+	std::vector<std::string> teardownOrder;
+
+	auto addNode = [&](std::string name) {
+		return initGraph.AddNode(
+			name,
+			[&, name] {
+				std::lock_guard lock{ orderMutex };
+				initOrder.emplace_back(name);
+			},
+			[&, name] { teardownOrder.emplace_back(name); }
+		);
+	};
+
+	// The fixture's bring up, with the steps which only need the device side by side.
+	const InitGraph::NodeId instance = addNode("instance");
+	const InitGraph::NodeId surface = addNode("surface");
+	const InitGraph::NodeId device = addNode("device");
+	const InitGraph::NodeId queues = addNode("queues");
+	const InitGraph::NodeId descriptors = addNode("descriptors");
+	const InitGraph::NodeId shaders = addNode("shaders");
+	const InitGraph::NodeId pipelines = addNode("pipelines");
+
+	initGraph.AddDependency(surface, instance);
+	initGraph.AddDependency(device, surface);
+	initGraph.AddDependency(queues, device);
+	initGraph.AddDependency(descriptors, device);
+	initGraph.AddDependency(shaders, device);
+	initGraph.AddDependency(pipelines, shaders);
+	initGraph.AddDependency(pipelines, descriptors);
+
+	ASSERT_TRUE(initGraph.Run(threadPool)) << "The graph has no cycle.";
+	ASSERT_EQ(std::size(initOrder), initGraph.GetNodeCount()) << "Not every node ran.";
+
+	auto position = [](const std::vector<std::string>& order, const char* name) {
+		return std::ranges::find(order, name) - std::begin(order);
+	};
+
+	const std::array<std::pair<const char*, const char*>, 7u> edges{
+		std::pair{ "surface", "instance" }, std::pair{ "device", "surface" },
+		std::pair{ "queues", "device" }, std::pair{ "descriptors", "device" },
+		std::pair{ "shaders", "device" }, std::pair{ "pipelines", "shaders" },
+		std::pair{ "pipelines", "descriptors" }
+	};
+
+	for (const auto& [node, dependency] : edges)
+		EXPECT_GT(position(initOrder, node), position(initOrder, dependency))
+			<< node << " started before " << dependency << " finished.";
+
+	EXPECT_TRUE(std::empty(teardownOrder)) << "Teardown ran before it was asked to.";
+	initGraph.Teardown();
+	ASSERT_EQ(std::size(teardownOrder), initGraph.GetNodeCount())
+		<< "Not every node was torn down.";
+
+	for (const auto& [node, dependency] : edges)
+		EXPECT_LT(position(teardownOrder, node), position(teardownOrder, dependency))
+			<< dependency << " was torn down before " << node << ".";
+}
+
+TEST(InitGraphTest, ConcurrentNodesTest) {
+	constexpr size_t independentCount = 4u;
+
+	ThreadPool threadPool{ independentCount };
+	InitGraph initGraph{};
+
+	// Every independent node waits for all the others, so this only finishes if they overlap.
+	std::latch allStarted{ static_cast<std::ptrdiff_t>(independentCount) };
+
+	const InitGraph::NodeId device = initGraph.AddNode("device", [] {});
+
+	for (size_t index = 0u; index < independentCount; ++index) {
+		const InitGraph::NodeId node = initGraph.AddNode(
+			"independent" + std::to_string(index), [&allStarted] { allStarted.arrive_and_wait(); }
+		);
+		initGraph.AddDependency(node, device);
+	}
+
+	EXPECT_TRUE(initGraph.Run(threadPool)) << "The graph has no cycle.";
+}
+
+TEST(InitGraphTest, TimingsTest) {
+	ThreadPool threadPool{ 2u };
+	InitGraph initGraph{};
+
+	auto sleepFor = [](std::chrono::milliseconds duration) {
+		return [duration] { std::this_thread::sleep_for(duration); };
+	};
+
+	using std::chrono::milliseconds;
+
+	const InitGraph::NodeId device = initGraph.AddNode("device", sleepFor(milliseconds{ 5 }));
+	const InitGraph::NodeId fast = initGraph.AddNode("fast", sleepFor(milliseconds{ 1 }));
+	const InitGraph::NodeId slow = initGraph.AddNode("slow", sleepFor(milliseconds{ 30 }));
+	const InitGraph::NodeId last = initGraph.AddNode("last", sleepFor(milliseconds{ 1 }));
+
+	initGraph.AddDependency(fast, device);
+	initGraph.AddDependency(slow, device);
+	initGraph.AddDependency(last, fast);
+	initGraph.AddDependency(last, slow);
+
+	ASSERT_TRUE(initGraph.Run(threadPool)) << "The graph has no cycle.";
+
+	const std::vector<InitGraph::NodeTiming> timings = initGraph.GetTimings();
+	ASSERT_EQ(std::size(timings), 4u) << "Timing count doesn't match.";
+
+	EXPECT_EQ(timings[slow].name, "slow") << "Name doesn't match.";
+	EXPECT_GE(timings[slow].duration, milliseconds{ 30 }) << "Duration too short.";
+	EXPECT_GE(timings[slow].start, timings[device].start + timings[device].duration)
+		<< "Slow started before the device was done.";
+
+	const std::vector<InitGraph::NodeId> criticalPath = initGraph.GetCriticalPath();
+	const std::vector<InitGraph::NodeId> expectedPath{ device, slow, last };
+	EXPECT_EQ(criticalPath, expectedPath) << "Critical path doesn't match.";
+
+	EXPECT_GE(initGraph.GetTotalDuration(), initGraph.GetCriticalPathDuration())
+		<< "Finished faster than its critical path.";
+}
+
+TEST(InitGraphTest, CycleTest) {
+	ThreadPool threadPool{ 1u };
+	InitGraph initGraph{};
+
+	bool ran = false;
+	const InitGraph::NodeId first = initGraph.AddNode("first", [&ran] { ran = true; });
+	const InitGraph::NodeId second = initGraph.AddNode("second", [&ran] { ran = true; });
+
+	initGraph.AddDependency(first, second);
+	initGraph.AddDependency(second, first);
+
+	EXPECT_FALSE(initGraph.GetTopologicalOrder()) << "The cycle wasn't found.";
+	EXPECT_FALSE(initGraph.Run(threadPool)) << "A graph with a cycle ran.";
+	EXPECT_FALSE(ran) << "A node of a cycle ran.";
+}
+
+TEST(InitGraphTest, FailureTest) {
+	ThreadPool threadPool{ 2u };
+	InitGraph initGraph{};
+
+	std::atomic<size_t> torndown = 0u;
+	std::atomic<bool> dependentRan = false;
+	std::atomic<bool> independentRan = false;
+
+	const InitGraph::NodeId device = initGraph.AddNode(
+		"device", [] {}, [&torndown] { ++torndown; }
+	);
+	const InitGraph::NodeId failing = initGraph.AddNode(
+		"failing", [] { throw std::runtime_error{ "No suitable queue." }; },
+		[&torndown] { ++torndown; }
+	);
+	const InitGraph::NodeId dependent = initGraph.AddNode(
+		"dependent", [&dependentRan] { dependentRan = true; }
+	);
+	const InitGraph::NodeId independent = initGraph.AddNode(
+		"independent", [&independentRan] { independentRan = true; }
+	);
+
+	initGraph.AddDependency(failing, device);
+	initGraph.AddDependency(dependent, failing);
+	initGraph.AddDependency(independent, device);
+
+	EXPECT_THROW(static_cast<void>(initGraph.Run(threadPool)), std::runtime_error)
+		<< "The exception wasn't rethrown.";
+	EXPECT_FALSE(dependentRan) << "A node ran after its dependency failed.";
+	EXPECT_TRUE(independentRan) << "An unrelated node was skipped.";
+
+	// Only what finished gets torn down.
+	initGraph.Teardown();
+	EXPECT_EQ(torndown.load(), 1u) << "Teardown count doesn't match.";
+}
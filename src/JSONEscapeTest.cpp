@@ -0,0 +1,14 @@
+#include <JSONEscape.hpp>
+#include <gtest/gtest.h>
+
+TEST(JSONEscapeTest, EscapeTest) {
+	EXPECT_EQ(EscapeJSON("Shadows"), "Shadows") << "Plain text shouldn't change.";
+	EXPECT_EQ(EscapeJSON("a\"b\\c"), "a\\\"b\\\\c") << "Quotes aren't escaped.";
+	EXPECT_EQ(EscapeJSON("line\nnext\ttab"), "line\\u000anext\\u0009tab")
+		<< "Control characters aren't escaped.";
+	EXPECT_EQ(EscapeJSON(std::string_view{ "\0\x1f", 2u }), "\\u0000\\u001f")
+		<< "Control characters aren't escaped.";
+	// Anything from 0x20 on, UTF-8 included, is valid in a JSON string as it is.
+	EXPECT_EQ(EscapeJSON("\x7f\xc3\xa9"), "\x7f\xc3\xa9") << "Valid characters were escaped.";
+	EXPECT_TRUE(std::empty(EscapeJSON(""))) << "Empty text doesn't match.";
+}
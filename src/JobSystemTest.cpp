@@ -0,0 +1,62 @@
+#include <JobSystem.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+TEST(JobSystemTest, ParallelForTest) {
+	JobSystem jobSystem{ 4u };
+	EXPECT_EQ(jobSystem.GetWorkerCount(), 4u) << "Worker count doesn't match.";
+
+	constexpr size_t itemCount = 10'000u;
+	constexpr size_t chunkSize = 64u;
+
+	std::vector<std::atomic<size_t>> visitCounts(itemCount);
+	std::vector<std::atomic<size_t>> chunkCounts((itemCount + chunkSize - 1u) / chunkSize);
+	std::atomic<bool> invalidWorker = false;
+
+	jobSystem.ParallelFor(
+		itemCount, chunkSize,
+		[&](size_t chunkIndex, size_t begin, size_t end, size_t workerIndex) {
+			if (workerIndex >= 4u)
+				invalidWorker = true;
+
+			++chunkCounts[chunkIndex];
+
+			for (size_t index = begin; index < end; ++index)
+				++visitCounts[index];
+		}
+	);
+
+	EXPECT_FALSE(invalidWorker.load()) << "A worker index was out of range.";
+
+	for (size_t index = 0u; index < itemCount; ++index)
+		EXPECT_EQ(visitCounts[index].load(), 1u) << "Item " << index << " wasn't run once.";
+
+	for (size_t index = 0u; index < std::size(chunkCounts); ++index)
+		EXPECT_EQ(chunkCounts[index].load(), 1u) << "Chunk " << index << " wasn't run once.";
+
+	// Nothing to run shouldn't block.
+	jobSystem.ParallelFor(0u, chunkSize, [](size_t, size_t, size_t, size_t) {});
+}
+
+TEST(JobSystemTest, WorkStealingTest) {
+	JobSystem jobSystem{ 4u };
+
+	// The first worker's chunks are far slower, so the others have to steal them to finish.
+	constexpr size_t chunkCount = 32u;
+	std::atomic<size_t> completedChunks = 0u;
+
+	jobSystem.ParallelFor(
+		chunkCount, 1u,
+		[&completedChunks](size_t chunkIndex, size_t, size_t, size_t) {
+			if (chunkIndex < chunkCount / 4u)
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 5 });
+
+			++completedChunks;
+		}
+	);
+
+	EXPECT_EQ(completedChunks.load(), chunkCount) << "Not every chunk was run.";
+	EXPECT_GT(jobSystem.GetStealCount(), 0u) << "Idle workers didn't steal any jobs.";
+}
@@ -0,0 +1,36 @@
+#include <MemoryStats.hpp>
+#include <gtest/gtest.h>
+
+TEST(MemoryStatsTest, SplitBufferRecordTest) {
+	AllocationRecord record = GetSplitBufferRecord("split", 100u, 256u, 3u);
+
+	EXPECT_EQ(record.size, 612u) << "Split buffer size doesn't match.";
+	EXPECT_EQ(record.paddingSize, 312u) << "Split buffer padding doesn't match.";
+
+	AllocationRecord single = GetSplitBufferRecord("single", 100u, 256u, 1u);
+	EXPECT_EQ(single.size, 100u) << "A single buffer shouldn't have padding.";
+	EXPECT_EQ(single.paddingSize, 0u) << "A single buffer shouldn't have padding.";
+}
+
+TEST(MemoryStatsTest, HeapTotalsAndJSONTest) {
+	MemoryStats memoryStats{};
+
+	HeapStats heap{ .name = "gpuOnly", .reservedSize = 4'096u };
+	heap.AddAllocation(GetSplitBufferRecord("first", 100u, 256u, 2u));
+	heap.AddAllocation(GetSplitBufferRecord("second\"quoted\"", 64u, 64u, 2u));
+
+	EXPECT_EQ(heap.boundSize, 356u + 128u) << "Bound size doesn't match.";
+	EXPECT_EQ(heap.paddingSize, 156u) << "Padding size doesn't match.";
+	EXPECT_EQ(std::size(heap.allocations), 2u) << "Allocation count doesn't match.";
+
+	memoryStats.AddHeap(std::move(heap));
+	memoryStats.AddHeap(HeapStats{ .name = "cpuWrite" });
+	EXPECT_EQ(memoryStats.GetHeaps().front().paddingSize, 156u)
+		<< "Adding a heap changed the earlier one.";
+
+	const std::string json = memoryStats.ToJSON();
+	EXPECT_NE(json.find("\"name\":\"gpuOnly\""), std::string::npos) << "Heap is missing.";
+	EXPECT_NE(json.find("\"paddingSize\":156"), std::string::npos) << "Padding is missing.";
+	EXPECT_NE(json.find("second\\\"quoted\\\""), std::string::npos) << "Name isn't escaped.";
+	EXPECT_NE(json.find("\"hasBudget\":false"), std::string::npos) << "Budget flag is wrong.";
+}
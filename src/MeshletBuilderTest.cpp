@@ -0,0 +1,191 @@
+#include <MeshletBuilder.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct GridMesh {
+	std::vector<MeshletFloat3> positions;
+	std::vector<std::uint32_t> indices;
+};
+
+// A flat grid on the XY plane, facing +Z.
+[[nodiscard]]
+static GridMesh CreateGrid(std::uint32_t quadsPerSide) {
+	GridMesh grid{};
+	const std::uint32_t verticesPerSide = quadsPerSide + 1u;
+
+	for (std::uint32_t y = 0u; y < verticesPerSide; ++y)
+		for (std::uint32_t x = 0u; x < verticesPerSide; ++x)
+			grid.positions.emplace_back(
+				MeshletFloat3{ static_cast<float>(x), static_cast<float>(y), 0.f }
+			);
+
+	for (std::uint32_t y = 0u; y < quadsPerSide; ++y)
+		for (std::uint32_t x = 0u; x < quadsPerSide; ++x) {
+			const std::uint32_t topLeft = y * verticesPerSide + x;
+			const std::uint32_t bottomLeft = topLeft + verticesPerSide;
+
+			grid.indices.insert(
+				std::end(grid.indices),
+				{ topLeft, topLeft + 1u, bottomLeft, topLeft + 1u, bottomLeft + 1u, bottomLeft }
+			);
+		}
+
+	return grid;
+}
+
+[[nodiscard]]
+static std::vector<std::array<std::uint32_t, 3u>> GetTriangles(const MeshletData& data) {
+	std::vector<std::array<std::uint32_t, 3u>> triangles;
+
+	for (const Meshlet& meshlet : data.meshlets)
+		for (std::uint32_t primitive = 0u; primitive < meshlet.primitiveCount; ++primitive) {
+			const auto local = UnpackPrimitive(
+				data.primitiveIndices[meshlet.primitiveOffset + primitive]
+			);
+
+			triangles.push_back({
+				data.vertexIndices[meshlet.vertexOffset + local[0]],
+				data.vertexIndices[meshlet.vertexOffset + local[1]],
+				data.vertexIndices[meshlet.vertexOffset + local[2]]
+			});
+		}
+
+	return triangles;
+}
+
+TEST(MeshletBuilderTest, LimitsTest) {
+	const GridMesh grid = CreateGrid(32u);
+	const MeshletLimits limits{};
+
+	const MeshletData data = BuildMeshlets(grid.indices, grid.positions, limits);
+
+	ASSERT_FALSE(std::empty(data.meshlets)) << "No meshlets were built.";
+	EXPECT_EQ(std::size(data.meshlets), std::size(data.bounds)) << "Bounds count doesn't match.";
+
+	for (const Meshlet& meshlet : data.meshlets) {
+		EXPECT_LE(meshlet.vertexCount, limits.maxVertices) << "Vertex limit exceeded.";
+		EXPECT_LE(meshlet.primitiveCount, limits.maxPrimitives) << "Primitive limit exceeded.";
+		EXPECT_GT(meshlet.primitiveCount, 0u) << "Empty meshlet.";
+
+		for (std::uint32_t primitive = 0u; primitive < meshlet.primitiveCount; ++primitive)
+			for (std::uint32_t localIndex : UnpackPrimitive(
+				data.primitiveIndices[meshlet.primitiveOffset + primitive]
+			))
+				EXPECT_LT(localIndex, meshlet.vertexCount) << "Local index out of range.";
+	}
+}
+
+TEST(MeshletBuilderTest, TriangleCoverageTest) {
+	const GridMesh grid = CreateGrid(20u);
+
+	const MeshletData data = BuildMeshlets(grid.indices, grid.positions);
+
+	std::vector<std::array<std::uint32_t, 3u>> expectedTriangles;
+	for (size_t index = 0u; index < std::size(grid.indices); index += 3u)
+		expectedTriangles.push_back(
+			{ grid.indices[index], grid.indices[index + 1u], grid.indices[index + 2u] }
+		);
+
+	std::vector<std::array<std::uint32_t, 3u>> triangles = GetTriangles(data);
+
+	std::ranges::sort(expectedTriangles);
+	std::ranges::sort(triangles);
+
+	EXPECT_EQ(triangles, expectedTriangles)
+		<< "Every triangle should be emitted once with its winding intact.";
+}
+
+TEST(MeshletBuilderTest, VertexReuseTest) {
+	const GridMesh grid = CreateGrid(32u);
+	const MeshletLimits limits{};
+
+	const MeshletData data = BuildMeshlets(grid.indices, grid.positions, limits);
+
+	const size_t triangleCount = std::size(grid.indices) / 3u;
+	const size_t minimumMeshlets = (triangleCount + limits.maxPrimitives - 1u)
+		/ limits.maxPrimitives;
+
+	// A 64 vertex meshlet of a grid fits at most 98 triangles, so full primitive
+	// usage isn't possible. But scattered meshlets would need many more.
+	EXPECT_LE(std::size(data.meshlets), minimumMeshlets * 2u) << "Too many meshlets.";
+
+	// Every vertex of the grid is referenced by at least one meshlet. With good locality
+	// the border vertices shared between meshlets shouldn't double the reference count.
+	const double vertexReferenceRatio = static_cast<double>(std::size(data.vertexIndices))
+		/ static_cast<double>(std::size(grid.positions));
+
+	EXPECT_LT(vertexReferenceRatio, 1.6) << "Meshlets reference too many duplicate vertices.";
+
+	for (const Meshlet& meshlet : data.meshlets) {
+		std::vector<std::uint32_t> meshletVertices{
+			std::begin(data.vertexIndices) + meshlet.vertexOffset,
+			std::begin(data.vertexIndices) + meshlet.vertexOffset + meshlet.vertexCount
+		};
+		std::ranges::sort(meshletVertices);
+
+		EXPECT_EQ(std::ranges::adjacent_find(meshletVertices), std::end(meshletVertices))
+			<< "A meshlet references the same vertex twice.";
+	}
+}
+
+TEST(MeshletBuilderTest, BoundsTest) {
+	const GridMesh grid = CreateGrid(16u);
+
+	const MeshletData data = BuildMeshlets(grid.indices, grid.positions);
+
+	for (size_t index = 0u; index < std::size(data.meshlets); ++index) {
+		const Meshlet& meshlet = data.meshlets[index];
+		const MeshletBounds& bounds = data.bounds[index];
+
+		for (std::uint32_t vertex = 0u; vertex < meshlet.vertexCount; ++vertex) {
+			const MeshletFloat3& position
+				= grid.positions[data.vertexIndices[meshlet.vertexOffset + vertex]];
+
+			const float distance = std::sqrt(
+				std::pow(position[0] - bounds.center[0], 2.f)
+				+ std::pow(position[1] - bounds.center[1], 2.f)
+				+ std::pow(position[2] - bounds.center[2], 2.f)
+			);
+
+			EXPECT_LE(distance, bounds.radius + 0.001f) << "Vertex outside of the sphere.";
+		}
+
+		// Every triangle of the flat grid faces +Z.
+		EXPECT_NEAR(bounds.coneAxis[2], 1.f, 0.001f) << "Cone axis doesn't match the normal.";
+		EXPECT_NEAR(bounds.coneCutoff, 0.f, 0.001f) << "A flat meshlet should have a tight cone.";
+
+		// The grid is only visible from the front.
+		const MeshletFloat3 behind{ bounds.center[0], bounds.center[1], -100.f };
+		const MeshletFloat3 toCentre{
+			bounds.center[0] - behind[0], bounds.center[1] - behind[1],
+			bounds.center[2] - behind[2]
+		};
+		const float toCentreLength = std::sqrt(
+			toCentre[0] * toCentre[0] + toCentre[1] * toCentre[1] + toCentre[2] * toCentre[2]
+		);
+		const float facing = toCentre[0] * bounds.coneAxis[0]
+			+ toCentre[1] * bounds.coneAxis[1] + toCentre[2] * bounds.coneAxis[2];
+
+		EXPECT_GE(facing, bounds.coneCutoff * toCentreLength + bounds.radius)
+			<< "Meshlet seen from behind wasn't culled.";
+	}
+}
+
+TEST(MeshletBuilderTest, CustomLimitsTest) {
+	const GridMesh grid = CreateGrid(8u);
+	const MeshletLimits limits{ .maxVertices = 16u, .maxPrimitives = 12u };
+
+	const MeshletData data = BuildMeshlets(grid.indices, grid.positions, limits);
+
+	size_t primitiveCount = 0u;
+	for (const Meshlet& meshlet : data.meshlets) {
+		EXPECT_LE(meshlet.vertexCount, limits.maxVertices) << "Vertex limit exceeded.";
+		EXPECT_LE(meshlet.primitiveCount, limits.maxPrimitives) << "Primitive limit exceeded.";
+
+		primitiveCount += meshlet.primitiveCount;
+	}
+
+	EXPECT_EQ(primitiveCount, std::size(grid.indices) / 3u) << "Triangle count doesn't match.";
+}
@@ -0,0 +1,417 @@
+#include <RenderGraph.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace {
+	constexpr std::uint32_t graphicsFamily = 0u;
+	constexpr std::uint32_t computeFamily = 1u;
+
+	RenderGraphResourceDesc TransientBuffer(VkDeviceSize size) noexcept {
+		return RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Buffer, .transient = true, .size = size,
+			.alignment = 256u
+		};
+	}
+
+	RenderGraphResourceDesc TransientImage(VkDeviceSize size) noexcept {
+		return RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Image, .transient = true, .size = size,
+			.alignment = 4'096u
+		};
+	}
+
+	const RenderGraphCompiledPass* FindPass(
+		const RenderGraphCompileResult& result, RenderGraphPassId pass
+	) {
+		auto compiledPass = std::ranges::find(result.passes, pass, &RenderGraphCompiledPass::pass);
+
+		return compiledPass == std::end(result.passes) ? nullptr : &*compiledPass;
+	}
+}
+
+TEST(RenderGraphTest, CullingTest) {
+	RenderGraph graph{};
+
+	const RenderGraphResourceId backBuffer = graph.AddResource(
+		"BackBuffer", RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Image, .transient = false, .size = 0u,
+			.alignment = 0u
+		}
+	);
+	const RenderGraphResourceId gBuffer = graph.AddResource("GBuffer", TransientImage(1'024u));
+	const RenderGraphResourceId debugBuffer = graph.AddResource(
+		"Debug", TransientImage(1'024u)
+	);
+	const RenderGraphResourceId readback = graph.AddResource("Readback", TransientBuffer(64u));
+	const RenderGraphResourceId histogram = graph.AddResource(
+		"Histogram", TransientBuffer(1'024u)
+	);
+	const RenderGraphResourceId exposure = graph.AddResource(
+		"Exposure", RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Buffer, .transient = false, .size = 0u,
+			.alignment = 0u
+		}
+	);
+
+	const RenderGraphPassId geometryPass = graph.AddPass("Geometry", graphicsFamily);
+	graph.Write(
+		geometryPass, gBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	);
+
+	// Nothing reads the debug view.
+	const RenderGraphPassId debugPass = graph.AddPass("Debug", graphicsFamily);
+	graph.Read(
+		debugPass, gBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+	);
+	graph.Write(
+		debugPass, debugBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	);
+
+	const RenderGraphPassId lightingPass = graph.AddPass("Lighting", graphicsFamily);
+	graph.Read(
+		lightingPass, gBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+	);
+	graph.Write(
+		lightingPass, backBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	);
+	graph.MarkOutput(backBuffer);
+
+	// Kept because of its side effect, even though its output isn't marked.
+	const RenderGraphPassId statsPass = graph.AddPass("Stats", computeFamily, true);
+	graph.Write(
+		statsPass, readback, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT
+	);
+
+	// The histogram is read and written by the same pass, its writer has to be kept.
+	const RenderGraphPassId clearPass = graph.AddPass("ClearHistogram", computeFamily);
+	graph.Write(
+		clearPass, histogram, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+	);
+
+	const RenderGraphPassId accumulatePass = graph.AddPass("Accumulate", computeFamily);
+	graph.Read(
+		accumulatePass, histogram, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_ACCESS_SHADER_READ_BIT
+	);
+	graph.Write(
+		accumulatePass, histogram, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT
+	);
+	graph.Write(
+		accumulatePass, exposure, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT
+	);
+	graph.MarkOutput(exposure);
+
+	const RenderGraphCompileResult result = graph.Compile();
+
+	ASSERT_EQ(std::size(result.passes), 5u) << "Pass count doesn't match.";
+	EXPECT_EQ(result.passes[0].pass, geometryPass) << "Order doesn't match.";
+	EXPECT_EQ(result.passes[1].pass, lightingPass) << "Order doesn't match.";
+	EXPECT_EQ(result.passes[2].pass, statsPass) << "Order doesn't match.";
+	EXPECT_EQ(result.passes[3].pass, clearPass) << "A read-modify-write input was culled.";
+	EXPECT_EQ(result.passes[4].pass, accumulatePass) << "Order doesn't match.";
+
+	ASSERT_EQ(std::size(result.culledPasses), 1u) << "Culled pass count doesn't match.";
+	EXPECT_EQ(result.culledPasses[0], debugPass) << "The wrong pass was culled.";
+
+	// The debug image isn't used by a live pass, so it doesn't get any memory.
+	EXPECT_TRUE(std::ranges::none_of(result.placements, [debugBuffer](const auto& placement) {
+		return placement.resource == debugBuffer;
+	})) << "A culled resource was placed.";
+}
+
+TEST(RenderGraphTest, BarrierTest) {
+	RenderGraph graph{};
+
+	const RenderGraphResourceId colour = graph.AddResource("Colour", TransientImage(4'096u));
+	const RenderGraphResourceId depth = graph.AddResource("Depth", TransientImage(4'096u));
+	const RenderGraphResourceId output = graph.AddResource(
+		"Output", RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Image, .transient = false, .size = 0u,
+			.alignment = 0u, .initialLayout = VK_IMAGE_LAYOUT_GENERAL
+		}
+	);
+
+	const RenderGraphPassId drawPass = graph.AddPass("Draw", graphicsFamily);
+	graph.Write(
+		drawPass, colour, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	);
+	graph.Write(
+		drawPass, depth, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT
+		| VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+		VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+	);
+
+	// Both reads after the draw go into one batch.
+	const RenderGraphPassId firstReadPass = graph.AddPass("FirstRead", graphicsFamily);
+	graph.Read(
+		firstReadPass, colour, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+	);
+	graph.Read(
+		firstReadPass, depth, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+	);
+	graph.Write(
+		firstReadPass, output, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+		VK_IMAGE_LAYOUT_GENERAL
+	);
+
+	// The same read again needs no barrier.
+	const RenderGraphPassId secondReadPass = graph.AddPass("SecondRead", graphicsFamily);
+	graph.Read(
+		secondReadPass, colour, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+	);
+	graph.Write(
+		secondReadPass, output, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT,
+		VK_IMAGE_LAYOUT_GENERAL
+	);
+	graph.MarkOutput(output);
+
+	const RenderGraphCompileResult result = graph.Compile();
+
+	ASSERT_EQ(std::size(result.passes), 3u) << "Pass count doesn't match.";
+
+	const RenderGraphBarrierBatch& drawBarriers = result.passes[0].acquireBarriers;
+	ASSERT_EQ(std::size(drawBarriers.barriers), 2u) << "Initial transition count doesn't match.";
+	for (const RenderGraphBarrier& barrier : drawBarriers.barriers)
+		EXPECT_EQ(barrier.oldLayout, VK_IMAGE_LAYOUT_UNDEFINED)
+			<< "Transient images should start undefined.";
+	EXPECT_EQ(drawBarriers.srcStages, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT)
+		<< "Nothing came before the first use.";
+
+	const RenderGraphBarrierBatch& firstReadBarriers = result.passes[1].acquireBarriers;
+	// The colour and depth transitions, the output's writes didn't change its layout.
+	ASSERT_EQ(std::size(firstReadBarriers.barriers), 2u) << "Barrier count doesn't match.";
+	EXPECT_EQ(
+		firstReadBarriers.srcStages, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+		| VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT
+	) << "Source stages weren't merged.";
+	EXPECT_EQ(firstReadBarriers.dstStages, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT)
+		<< "Destination stages don't match.";
+
+	for (const RenderGraphBarrier& barrier : firstReadBarriers.barriers) {
+		EXPECT_EQ(barrier.newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
+			<< "New layout doesn't match.";
+		EXPECT_EQ(barrier.dstAccess, VK_ACCESS_SHADER_READ_BIT) << "Access doesn't match.";
+	}
+
+	// Write after write on the output.
+	const RenderGraphBarrierBatch& secondReadBarriers = result.passes[2].acquireBarriers;
+	ASSERT_EQ(std::size(secondReadBarriers.barriers), 1u) << "Barrier count doesn't match.";
+	EXPECT_EQ(secondReadBarriers.barriers[0].resource, output) << "Resource doesn't match.";
+	EXPECT_EQ(secondReadBarriers.barriers[0].srcAccess, VK_ACCESS_SHADER_WRITE_BIT)
+		<< "Source access doesn't match.";
+
+	EXPECT_EQ(result.batchCount, 3u) << "There should be one batch per pass.";
+	EXPECT_EQ(result.barrierCount, 5u) << "Barrier count doesn't match.";
+}
+
+TEST(RenderGraphTest, QueueOwnershipTest) {
+	RenderGraph graph{};
+
+	const RenderGraphResourceId particles = graph.AddResource(
+		"Particles", TransientBuffer(65'536u)
+	);
+	const RenderGraphResourceId output = graph.AddResource(
+		"Output", RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Buffer, .transient = false, .size = 0u,
+			.alignment = 0u
+		}
+	);
+
+	const RenderGraphPassId simulatePass = graph.AddPass("Simulate", computeFamily);
+	graph.Write(
+		simulatePass, particles, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT
+	);
+
+	const RenderGraphPassId drawPass = graph.AddPass("Draw", graphicsFamily);
+	graph.Read(
+		drawPass, particles, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+		VK_ACCESS_INDIRECT_COMMAND_READ_BIT
+	);
+	graph.Write(
+		drawPass, output, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+	);
+	graph.MarkOutput(output);
+
+	const RenderGraphCompileResult result = graph.Compile();
+
+	const RenderGraphCompiledPass* simulate = FindPass(result, simulatePass);
+	const RenderGraphCompiledPass* draw = FindPass(result, drawPass);
+	ASSERT_NE(simulate, nullptr) << "The simulation was culled.";
+	ASSERT_NE(draw, nullptr) << "The draw was culled.";
+
+	ASSERT_EQ(std::size(simulate->releaseBarriers.barriers), 1u) << "Release is missing.";
+	const RenderGraphBarrier& release = simulate->releaseBarriers.barriers[0];
+	EXPECT_EQ(release.srcQueueFamily, computeFamily) << "Source family doesn't match.";
+	EXPECT_EQ(release.dstQueueFamily, graphicsFamily) << "Destination family doesn't match.";
+	EXPECT_EQ(release.srcAccess, VK_ACCESS_SHADER_WRITE_BIT) << "Release access doesn't match.";
+	EXPECT_EQ(simulate->releaseBarriers.srcStages, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT)
+		<< "Release stages don't match.";
+
+	auto acquire = std::ranges::find(
+		draw->acquireBarriers.barriers, particles, &RenderGraphBarrier::resource
+	);
+	ASSERT_NE(acquire, std::end(draw->acquireBarriers.barriers)) << "Acquire is missing.";
+	EXPECT_EQ(acquire->srcQueueFamily, computeFamily) << "Source family doesn't match.";
+	EXPECT_EQ(acquire->dstQueueFamily, graphicsFamily) << "Destination family doesn't match.";
+	EXPECT_EQ(acquire->dstAccess, VK_ACCESS_INDIRECT_COMMAND_READ_BIT)
+		<< "Acquire access doesn't match.";
+
+	ASSERT_EQ(std::size(draw->queueWaits), 1u) << "Semaphore wait is missing.";
+	EXPECT_EQ(draw->queueWaits[0], simulatePass) << "Waited pass doesn't match.";
+}
+
+TEST(RenderGraphTest, TransientAliasingTest) {
+	RenderGraph graph{};
+
+	// A chain of passes where every image is only needed by the next one.
+	constexpr size_t chainLength = 6u;
+	constexpr VkDeviceSize imageSize = 1'000'000u;
+
+	std::vector<RenderGraphResourceId> images;
+	for (size_t index = 0u; index < chainLength; ++index)
+		images.emplace_back(graph.AddResource(
+			"Image" + std::to_string(index), TransientImage(imageSize + index * 4'096u)
+		));
+
+	for (size_t index = 0u; index < chainLength; ++index) {
+		const RenderGraphPassId pass = graph.AddPass(
+			"Pass" + std::to_string(index), graphicsFamily, index + 1u == chainLength
+		);
+
+		if (index > 0u)
+			graph.Read(
+				pass, images[index - 1u], VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+				VK_ACCESS_SHADER_READ_BIT, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+			);
+
+		graph.Write(
+			pass, images[index], VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+		);
+	}
+
+	const RenderGraphCompileResult result = graph.Compile();
+
+	ASSERT_EQ(std::size(result.placements), chainLength) << "Placement count doesn't match.";
+	EXPECT_LT(result.transientMemorySize, result.unaliasedMemorySize) << "Nothing was aliased.";
+	// Only two images are ever alive at the same time.
+	EXPECT_LE(result.transientMemorySize, 2u * (imageSize + chainLength * 4'096u))
+		<< "Aliasing isn't tight enough.";
+
+	for (size_t index = 0u; index < chainLength; ++index) {
+		const RenderGraphPlacement& placement = result.placements[index];
+
+		EXPECT_EQ(placement.offset % 4'096u, 0u) << "Placement isn't aligned.";
+		EXPECT_LE(placement.offset + placement.size, result.transientMemorySize)
+			<< "Placement is out of range.";
+
+		// Neighbours in the chain are alive together and can't overlap.
+		if (index > 0u) {
+			const RenderGraphPlacement& previous = result.placements[index - 1u];
+
+			EXPECT_TRUE(
+				placement.offset >= previous.offset + previous.size
+				|| previous.offset >= placement.offset + placement.size
+			) << "Resources alive at the same time overlap.";
+		}
+	}
+
+	// A resource which reuses memory has to wait for the last use of the one before it.
+	for (size_t index = 2u; index < chainLength; ++index) {
+		const RenderGraphBarrierBatch& batch = result.passes[index].acquireBarriers;
+
+		auto firstUse = std::ranges::find(
+			batch.barriers, images[index], &RenderGraphBarrier::resource
+		);
+		ASSERT_NE(firstUse, std::end(batch.barriers)) << "First use barrier is missing.";
+		EXPECT_EQ(firstUse->oldLayout, VK_IMAGE_LAYOUT_UNDEFINED)
+			<< "Aliased contents should be discarded.";
+		EXPECT_NE(batch.srcStages & VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0u)
+			<< "The aliased predecessor's reads aren't waited on.";
+	}
+}
+
+TEST(RenderGraphTest, CrossQueueAliasingTest) {
+	RenderGraph graph{};
+
+	const RenderGraphResourceId computeScratch = graph.AddResource(
+		"ComputeScratch", TransientBuffer(65'536u)
+	);
+	const RenderGraphResourceId graphicsScratch = graph.AddResource(
+		"GraphicsScratch", TransientBuffer(65'536u)
+	);
+
+	const RenderGraphPassId computePass = graph.AddPass("Compute", computeFamily, true);
+	graph.Write(
+		computePass, computeScratch, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+		VK_ACCESS_SHADER_WRITE_BIT
+	);
+
+	const RenderGraphPassId graphicsPass = graph.AddPass("Graphics", graphicsFamily, true);
+	graph.Write(
+		graphicsPass, graphicsScratch, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT
+	);
+
+	const RenderGraphCompileResult result = graph.Compile();
+
+	ASSERT_EQ(std::size(result.placements), 2u) << "Placement count doesn't match.";
+	const RenderGraphCompiledPass* graphics = FindPass(result, graphicsPass);
+	ASSERT_NE(graphics, nullptr) << "The graphics pass was culled.";
+
+	// Sharing memory across queues is only safe when the second pass waits for the first.
+	const bool aliased = result.placements[0].offset == result.placements[1].offset;
+	const bool waits = std::ranges::find(graphics->queueWaits, computePass)
+		!= std::end(graphics->queueWaits);
+
+	EXPECT_TRUE(!aliased || waits) << "Memory is shared with a pass on another queue.";
+}
+
+TEST(RenderGraphTest, PlacementTest) {
+	// Three resources alive at once and one later which fits in the freed range.
+	const TransientLifetime lifetimes[] = {
+		{ .resource = 0u, .firstUse = 0u, .lastUse = 1u, .size = 300u, .alignment = 100u },
+		{ .resource = 1u, .firstUse = 0u, .lastUse = 3u, .size = 200u, .alignment = 100u },
+		{ .resource = 2u, .firstUse = 1u, .lastUse = 2u, .size = 50u, .alignment = 100u },
+		{ .resource = 3u, .firstUse = 2u, .lastUse = 3u, .size = 250u, .alignment = 100u }
+	};
+
+	VkDeviceSize totalSize = 0u;
+	const std::vector<RenderGraphPlacement> placements = PlaceTransientResources(
+		lifetimes, totalSize
+	);
+
+	ASSERT_EQ(std::size(placements), std::size(lifetimes)) << "Placement count doesn't match.";
+	EXPECT_EQ(totalSize, 550u) << "Total size doesn't match.";
+
+	for (size_t index = 0u; index < std::size(lifetimes); ++index) {
+		EXPECT_EQ(placements[index].resource, lifetimes[index].resource)
+			<< "Placements aren't in input order.";
+		EXPECT_EQ(placements[index].offset % 100u, 0u) << "Placement isn't aligned.";
+
+		for (size_t otherIndex = index + 1u; otherIndex < std::size(lifetimes); ++otherIndex) {
+			const bool aliveTogether = lifetimes[index].firstUse <= lifetimes[otherIndex].lastUse
+				&& lifetimes[otherIndex].firstUse <= lifetimes[index].lastUse;
+			const bool memoryOverlaps = placements[index].offset
+				< placements[otherIndex].offset + placements[otherIndex].size
+				&& placements[otherIndex].offset < placements[index].offset + placements[index].size;
+
+			EXPECT_FALSE(aliveTogether && memoryOverlaps)
+				<< "Resources " << index << " and " << otherIndex << " overlap.";
+		}
+	}
+
+	// The last resource takes the first one's memory.
+	EXPECT_EQ(placements[3].offset, placements[0].offset) << "Freed memory wasn't reused.";
+}
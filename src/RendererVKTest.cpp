@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include <ObjectManager.hpp>
+#ifdef TERRA_WIN32
 #include <SimpleWindow.hpp>
+#else
+#include <HeadlessSurface.hpp>
+#endif
 #include <Terra.hpp>
 #include <GenericCheckFunctions.hpp>
 #include <VertexManagerVertexShader.hpp>
@@ -11,6 +15,37 @@
 #include <PipelineLayout.hpp>
 #include <VkQueueFamilyManager.hpp>
 #include <VKRenderPass.hpp>
+#include <PipelineCache.hpp>
+#include <PipelineBatch.hpp>
+#include <ThreadPool.hpp>
+#include <SpirvShader.hpp>
+#include <ShaderLibrary.hpp>
+#include <DeviceMemoryPool.hpp>
+#include <MemoryStats.hpp>
+#include <UploadRingBuffer.hpp>
+#include <UploadScheduler.hpp>
+#include <MeshletBuilder.hpp>
+#include <VertexCacheOptimizer.hpp>
+#include <StaticVertexLayout.hpp>
+#include <BindlessDescriptorTable.hpp>
+#include <DescriptorUpdateBuilder.hpp>
+#include <FrameDescriptorAllocator.hpp>
+#include <ParallelCommandRecorder.hpp>
+#include <TimelineSemaphore.hpp>
+#include <AsyncComputeScheduler.hpp>
+#include <GpuCullingPass.hpp>
+#include <DeferredDestructionQueue.hpp>
+#include <GpuProfiler.hpp>
+#include <RenderGraph.hpp>
+#include <ResizableSwapchain.hpp>
+#include <DeviceAddressBufferView.hpp>
+#include <cstring>
+#ifdef TERRA_TEST_EMBEDDED_SHADERS
+#include <EmbeddedShaders.hpp>
+#endif
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 
 namespace SpecificValues {
 	constexpr std::uint64_t testDisplayWidth = 2560u;
@@ -21,25 +56,139 @@ namespace SpecificValues {
 	constexpr VkDeviceSize testBufferSize = 128u;
 	constexpr const char* appName = "Terra";
 	constexpr const wchar_t* shaderPath = L"resources/shaders/";
+	constexpr const char* pipelineCachePath = "pipelineCache/";
 	constexpr bool meshShader = true;
 }
 
 class RendererVKTest : public ::testing::Test {
+protected:
+	// Terra's device doesn't enable descriptor indexing, timeline semaphores, buffer device
+	// addresses, pipeline statistics queries or indirect count draws, and Vulkan can't be
+	// asked which features a device was created with. So the tests of the utilities which
+	// need them run on this second device, created on the same GPU with every one of those
+	// features it supports, and check what it enabled. It has the first queue of each of Terra's queue families.
+	struct FeatureDevice {
+		VkDevice device = VK_NULL_HANDLE;
+		bool descriptorIndexing = false;
+		bool timelineSemaphore = false;
+		bool bufferDeviceAddress = false;
+		bool pipelineStatisticsQuery = false;
+		// Both drawIndirectCount and drawIndirectFirstInstance.
+		bool drawIndirectCount = false;
+
+		[[nodiscard]]
+		VkQueue GetQueue(std::uint32_t familyIndex) const noexcept {
+			VkQueue queue = VK_NULL_HANDLE;
+			vkGetDeviceQueue(device, familyIndex, 0u, &queue);
+
+			return queue;
+		}
+	};
+
 protected:
 	static inline void TearDownTestSuite() {
+		vkDestroyDevice(s_featureDevice.device, nullptr);
+		s_featureDevice = FeatureDevice{};
+
 		s_testResourceView.reset();
 		s_objectManager.StartCleanUp();
 	}
 
+	[[nodiscard]]
+	static const FeatureDevice& GetFeatureDevice() {
+		if (s_featureDevice.device != VK_NULL_HANDLE)
+			return s_featureDevice;
+
+		VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+		const bool descriptorIndexing = BindlessDescriptorTable::IsSupported(physicalDevice);
+		const bool timelineSemaphore = TimelineSemaphore::IsSupported(physicalDevice);
+		const bool bufferDeviceAddress = DeviceAddressBufferView::IsSupported(physicalDevice);
+		const bool pipelineStatisticsQuery = GpuProfiler::IsStatisticsSupported(physicalDevice);
+		const bool drawIndirectCount = GpuCullingPass::IsDrawSupported(physicalDevice);
+
+		// The descriptor indexing features are the ones BindlessDescriptorTable checks for.
+		VkPhysicalDeviceVulkan12Features vulkan12Features{
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES
+		};
+		vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = descriptorIndexing;
+		vulkan12Features.descriptorBindingStorageImageUpdateAfterBind = descriptorIndexing;
+		vulkan12Features.descriptorBindingStorageBufferUpdateAfterBind = descriptorIndexing;
+		vulkan12Features.descriptorBindingUpdateUnusedWhilePending = descriptorIndexing;
+		vulkan12Features.descriptorBindingPartiallyBound = descriptorIndexing;
+		vulkan12Features.timelineSemaphore = timelineSemaphore;
+		vulkan12Features.bufferDeviceAddress = bufferDeviceAddress;
+		vulkan12Features.drawIndirectCount = drawIndirectCount;
+
+		VkPhysicalDeviceFeatures2 features{
+			.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+			.pNext = &vulkan12Features
+		};
+		features.features.pipelineStatisticsQuery = pipelineStatisticsQuery;
+		features.features.drawIndirectFirstInstance = drawIndirectCount;
+
+		std::vector<std::uint32_t> familyIndices{
+			s_queFamilyMan.GetIndex(GraphicsQueue), s_queFamilyMan.GetIndex(ComputeQueue),
+			s_queFamilyMan.GetIndex(TransferQueue)
+		};
+		std::ranges::sort(familyIndices);
+		familyIndices.erase(std::ranges::unique(familyIndices).begin(), std::end(familyIndices));
+
+		constexpr float queuePriority = 1.f;
+
+		std::vector<VkDeviceQueueCreateInfo> queueInfos;
+		for (std::uint32_t familyIndex : familyIndices)
+			queueInfos.emplace_back(VkDeviceQueueCreateInfo{
+				.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+				.queueFamilyIndex = familyIndex,
+				.queueCount = 1u,
+				.pQueuePriorities = &queuePriority
+			});
+
+		VkDeviceCreateInfo createInfo{
+			.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+			.pNext = &features,
+			.queueCreateInfoCount = static_cast<std::uint32_t>(std::size(queueInfos)),
+			.pQueueCreateInfos = std::data(queueInfos)
+		};
+
+		VkDevice device = VK_NULL_HANDLE;
+		if (vkCreateDevice(physicalDevice, &createInfo, nullptr, &device) == VK_SUCCESS)
+			s_featureDevice = FeatureDevice{
+				.device = device,
+				.descriptorIndexing = descriptorIndexing,
+				.timelineSemaphore = timelineSemaphore,
+				.bufferDeviceAddress = bufferDeviceAddress,
+				.pipelineStatisticsQuery = pipelineStatisticsQuery,
+				.drawIndirectCount = drawIndirectCount
+			};
+
+		return s_featureDevice;
+	}
+
+	[[nodiscard]]
+	static VkSurfaceKHR GetSurface() noexcept {
+#ifdef TERRA_WIN32
+		return Terra::surface->GetSurface();
+#else
+		return s_headlessSurface->GetSurface();
+#endif
+	}
+
 	static inline ObjectManager s_objectManager;
 	static inline std::unique_ptr<VkResourceView> s_testResourceView;
 	static inline VkQueueFamilyMananger s_queFamilyMan;
+	static inline FeatureDevice s_featureDevice;
 
 #ifdef TERRA_WIN32
 	static inline SimpleWindow s_window{
 		SpecificValues::windowWidth, SpecificValues::windowHeight,
 		SpecificValues::appName
 	};
+#else
+	// Owned by the ObjectManager, so it is destroyed after the swapchain and before the
+	// instance.
+	static inline std::unique_ptr<HeadlessSurface> s_headlessSurface;
 #endif
 };
 
@@ -54,6 +203,9 @@ TEST_F(RendererVKTest, VkInstanceInitTest) {
 	ObjectInitCheck("vkInstance", Terra::vkInstance);
 
 	Terra::vkInstance->AddExtensionNames(Terra::display->GetRequiredExtensions());
+#ifndef TERRA_WIN32
+	Terra::vkInstance->AddExtensionNames(HeadlessSurface::GetRequiredExtensions());
+#endif
 	Terra::vkInstance->CreateInstance();
 
 	VkInstance vkInstance = Terra::vkInstance->GetVKInstance();
@@ -83,11 +235,23 @@ TEST_F(RendererVKTest, SurfaceWin32InitTest) {
 #endif
 }
 
+TEST_F(RendererVKTest, SurfaceHeadlessInitTest) {
+#ifndef TERRA_WIN32
+	VkInstance vkInstance = Terra::vkInstance->GetVKInstance();
+
+	s_objectManager.CreateObject(s_headlessSurface, { vkInstance }, 4u);
+	ObjectInitCheck("headlessSurface", s_headlessSurface);
+
+	VkSurfaceKHR vkSurface = s_headlessSurface->GetSurface();
+	VkObjectInitCheck("VkSurfaceKHR", vkSurface);
+#endif
+}
+
 TEST_F(RendererVKTest, DeviceInitTest) {
 	s_objectManager.CreateObject(Terra::device, 3u);
 	ObjectInitCheck("device", Terra::device);
 
-	VkSurfaceKHR vkSurface = Terra::surface->GetSurface();
+	VkSurfaceKHR vkSurface = GetSurface();
 	VkInstance vkInstance = Terra::vkInstance->GetVKInstance();
 
 	if (SpecificValues::meshShader)
@@ -105,6 +269,9 @@ TEST_F(RendererVKTest, DeviceInitTest) {
 }
 
 TEST_F(RendererVKTest, DisplayGetResolutionTest) {
+#ifndef TERRA_WIN32
+	GTEST_SKIP() << "There is no display attached to a headless surface.";
+#endif
 	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
 
 	auto [width, height] = Terra::display->GetDisplayResolution(physicalDevice, 0u);
@@ -203,7 +370,7 @@ TEST_F(RendererVKTest, QueuesInitTest) {
 TEST_F(RendererVKTest, SwapchainInitTest) {
 	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
 	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
-	VkSurfaceKHR vkSurface = Terra::surface->GetSurface();
+	VkSurfaceKHR vkSurface = GetSurface();
 
 	SwapChainManager::Args swapArguments{
 		.device = logicalDevice,
@@ -296,6 +463,42 @@ TEST_F(RendererVKTest, VkResourceViewInitTest) {
 	VkObjectInitCheck("VkBuffer", buffer);
 }
 
+TEST_F(RendererVKTest, VkMemoryStatsTest) {
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	VkPhysicalDeviceProperties deviceProperty{};
+	vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperty);
+
+	MemoryStats memoryStats{};
+	HeapStats gpuOnlyStats{ .name = "gpuOnlyMemory" };
+
+	gpuOnlyStats.AddAllocation(GetSplitBufferRecord(
+		"testResourceView", s_testResourceView->GetSubBufferSize(),
+		s_testResourceView->GetSubAllocationOffset(1u), SpecificValues::bufferCount
+	));
+
+	VkDeviceSize alignedSize = Align(
+		SpecificValues::testBufferSize, deviceProperty.limits.minStorageBufferOffsetAlignment
+	);
+	VkDeviceSize expectedPadding = (alignedSize - SpecificValues::testBufferSize)
+		* static_cast<VkDeviceSize>(SpecificValues::bufferCount - 1u);
+
+	EXPECT_EQ(gpuOnlyStats.paddingSize, expectedPadding) << "Padding doesn't match.";
+	EXPECT_EQ(gpuOnlyStats.boundSize, s_testResourceView->GetBufferSize())
+		<< "Bound size doesn't match.";
+
+	memoryStats.AddHeap(std::move(gpuOnlyStats));
+
+	memoryStats.QueryBudget(physicalDevice);
+	const std::vector<HeapBudget>& budgets = memoryStats.GetBudgets();
+	EXPECT_FALSE(std::empty(budgets)) << "No memory heap was reported.";
+
+	for (size_t index = 0u; index < std::size(budgets); ++index)
+		EXPECT_LE(budgets[index].budget, budgets[index].heapSize)
+			<< "Budget of the heap " << index << " is larger than the heap.";
+
+	RecordProperty("MemoryStats", memoryStats.ToJSON());
+}
+
 TEST_F(RendererVKTest, MemoryCreationTest) {
 	VkDeviceMemory gpuMemory = Terra::Resources::gpuOnlyMemory->GetMemoryHandle();
 	VkObjectNullCheck("GPUMemory", gpuMemory);
@@ -307,218 +510,3214 @@ TEST_F(RendererVKTest, MemoryCreationTest) {
 	VkObjectInitCheck("GPUMemory", gpuMemory);
 }
 
-TEST_F(RendererVKTest, ResourceViewMemoryAndDescriptorTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
-	s_testResourceView->BindResourceToMemory(logicalDevice);
+[[nodiscard]]
+static VkBuffer CreateTestBuffer(
+	VkDevice logicalDevice, VkDeviceSize bufferSize, VkBufferUsageFlags usage
+) {
+	VkBufferCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size = bufferSize,
+		.usage = usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE
+	};
 
-	DescriptorInfo inputDescInfo{
-		.bindingSlot = 0u,
-		.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+	VkBuffer buffer = VK_NULL_HANDLE;
+	vkCreateBuffer(logicalDevice, &createInfo, nullptr, &buffer);
+
+	return buffer;
+}
+
+[[nodiscard]]
+static VkImage CreateTestImage(
+	VkDevice logicalDevice, VkFormat format, VkExtent2D extent, VkImageUsageFlags usage
+) {
+	VkImageCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.imageType = VK_IMAGE_TYPE_2D,
+		.format = format,
+		.extent = VkExtent3D{ .width = extent.width, .height = extent.height, .depth = 1u },
+		.mipLevels = 1u,
+		.arrayLayers = 1u,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage = usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
 	};
 
-	auto inputBufferInfos = s_testResourceView->GetDescBufferInfoSplit(
-		SpecificValues::bufferCount
-	);
+	VkImage image = VK_NULL_HANDLE;
+	vkCreateImage(logicalDevice, &createInfo, nullptr, &image);
 
-	Terra::graphicsDescriptorSet->AddBuffersSplit(
-		inputDescInfo, std::move(inputBufferInfos), VK_SHADER_STAGE_ALL
-	);
+	return image;
 }
 
-TEST_F(RendererVKTest, DescriptorCreationTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
-	Terra::graphicsDescriptorSet->CreateDescriptorSets(logicalDevice);
-	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
-	const char* name = "graphics";
+[[nodiscard]]
+static VkImageView CreateTestImageView(
+	VkDevice logicalDevice, VkImage image, VkFormat format, VkImageAspectFlags aspect
+) {
+	VkImageViewCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+		.image = image,
+		.viewType = VK_IMAGE_VIEW_TYPE_2D,
+		.format = format,
+		.subresourceRange = VkImageSubresourceRange{
+			.aspectMask = aspect,
+			.baseMipLevel = 0u,
+			.levelCount = 1u,
+			.baseArrayLayer = 0u,
+			.layerCount = 1u
+		}
+	};
 
-	VkDescriptorSetLayout const* descLayout = descManager->GetDescriptorSetLayouts();
-	size_t descriptorSetCount = descManager->GetDescriptorSetCount();
-	EXPECT_EQ(descriptorSetCount, SpecificValues::bufferCount)
-		<< "DescCount doesn't match.";
+	VkImageView imageView = VK_NULL_HANDLE;
+	vkCreateImageView(logicalDevice, &createInfo, nullptr, &imageView);
 
-	for (size_t index = 0u; index < SpecificValues::bufferCount; ++index) {
-		VkObjectInitCheck(
-			FormatCompName(name, " VkDescriptorSetLayout ", index), descLayout[index]
-		);
+	return imageView;
+}
 
-		VkDescriptorSet descSet = descManager->GetDescriptorSet(index);
-		VkObjectInitCheck(FormatCompName(name, " VkDescriptorSet ", index), descSet);
-	}
+// Host coherent memory still needs the device writes to be made available to the host before
+// they are read back.
+static void RecordHostReadBarrier(
+	VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStages, VkAccessFlags srcAccess
+) {
+	VkMemoryBarrier memoryBarrier{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+		.srcAccessMask = srcAccess,
+		.dstAccessMask = VK_ACCESS_HOST_READ_BIT
+	};
+
+	vkCmdPipelineBarrier(
+		commandBuffer, srcStages, VK_PIPELINE_STAGE_HOST_BIT, 0u, 1u, &memoryBarrier,
+		0u, nullptr, 0u, nullptr
+	);
 }
 
-TEST_F(RendererVKTest, VertexManagerInitTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+// For work recorded by a utility, the barrier is submitted after it on the same queue and waited
+// for.
+static void SubmitHostReadBarrier(
+	VkDevice logicalDevice, VkQueue queue, std::uint32_t queueFamilyIndex,
+	VkPipelineStageFlags srcStages, VkAccessFlags srcAccess
+) {
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+		.queueFamilyIndex = queueFamilyIndex
+	};
 
-	std::vector<Vertex> verticesTest;
-	verticesTest.emplace_back();
-	verticesTest.emplace_back();
-	verticesTest.emplace_back();
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
 
-	std::vector<std::uint32_t> indicesTest;
-	indicesTest.emplace_back();
-	indicesTest.emplace_back();
-	indicesTest.emplace_back();
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
 
-	std::vector<Vertex> verticesCopy = verticesTest;
-	std::vector<std::uint32_t> indicesCopy = indicesTest;
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
 
-	VertexManagerVertexShader vertexManagerVS{ logicalDevice };
-	vertexManagerVS.AddGVerticesAndIndices(
-		logicalDevice, std::move(verticesTest), std::move(indicesTest)
-	);
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
 
-	std::vector<std::uint32_t> primIndices = indicesCopy;
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+	RecordHostReadBarrier(commandBuffer, srcStages, srcAccess);
+	vkEndCommandBuffer(commandBuffer);
 
-	VertexManagerMeshShader vertexManagerMS{
-		logicalDevice, SpecificValues::bufferCount,
-		s_queFamilyMan.GetTransferAndGraphicsIndices()
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence fence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &fence);
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &commandBuffer
 	};
-	vertexManagerMS.AddGVerticesAndPrimIndices(
-		logicalDevice, std::move(verticesCopy), std::move(indicesCopy), std::move(primIndices)
-	);
+
+	vkQueueSubmit(queue, 1u, &submitInfo, fence);
+	vkWaitForFences(logicalDevice, 1u, &fence, VK_TRUE, UINT64_MAX);
+
+	vkDestroyFence(logicalDevice, fence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
 }
 
-TEST_F(RendererVKTest, VkPipelineLayoutTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+// BufferScaleTest.spv bound to a single storage buffer at binding 0, with the element count as
+// its push constant. The set comes from a FrameDescriptorAllocator of its own.
+class BufferScaleCompute {
+public:
+	static constexpr std::uint32_t threadBlockSize = 64u;
+
+public:
+	BufferScaleCompute(VkDevice logicalDevice, VkBuffer buffer, const std::string& name)
+		: m_deviceRef{ logicalDevice }, m_setLayout{ CreateSetLayout(logicalDevice) },
+		m_frameAllocator{
+			logicalDevice,
+			FrameDescriptorAllocator::Args{
+				.frameCount = 1u,
+				.setsPerPool = 1u,
+				.poolSizes = {
+					VkDescriptorPoolSize{
+						.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1u
+					}
+				}
+			}
+		},
+		m_descriptorSet{ VK_NULL_HANDLE }, m_pipelineLayout{ VK_NULL_HANDLE },
+		m_computeShader{ logicalDevice }, m_computePSO{ logicalDevice } {
+		m_frameAllocator.BeginFrame(logicalDevice, 0u);
+		m_descriptorSet = m_frameAllocator.Allocate(logicalDevice, m_setLayout);
+		VkObjectInitCheck(name + "DescriptorSet", m_descriptorSet);
+
+		VkDescriptorBufferInfo bufferInfo{
+			.buffer = buffer, .offset = 0u, .range = VK_WHOLE_SIZE
+		};
+
+		VkWriteDescriptorSet descriptorWrite{
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.dstSet = m_descriptorSet,
+			.dstBinding = 0u,
+			.descriptorCount = 1u,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.pBufferInfo = &bufferInfo
+		};
+		vkUpdateDescriptorSets(logicalDevice, 1u, &descriptorWrite, 0u, nullptr);
+
+		VkPushConstantRange pushConstantRange{
+			.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+			.offset = 0u,
+			.size = sizeof(std::uint32_t)
+		};
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo{
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+			.setLayoutCount = 1u,
+			.pSetLayouts = &m_setLayout,
+			.pushConstantRangeCount = 1u,
+			.pPushConstantRanges = &pushConstantRange
+		};
+
+		vkCreatePipelineLayout(
+			logicalDevice, &pipelineLayoutInfo, nullptr, &m_pipelineLayout
+		);
+		VkObjectInitCheck(name + "PipelineLayout", m_pipelineLayout);
 
-	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+		m_computeShader.CreateShader(
+			logicalDevice, SpecificValues::shaderPath + std::wstring(L"BufferScaleTest.spv")
+		);
 
-	PipelineLayout layout{ logicalDevice };
-	layout.CreateLayout(
-		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
-	);
+		m_computePSO.CreateComputePipeline(
+			logicalDevice, m_pipelineLayout, m_computeShader.GetShaderModule()
+		);
+		VkObjectInitCheck(name + "Pipeline", m_computePSO.GetPipeline());
+	}
 
-	VkPipelineLayout pipeLayout = layout.GetLayout();
-	VkObjectInitCheck("VkPipelineLayout", pipeLayout);
-}
+	~BufferScaleCompute() noexcept {
+		vkDestroyPipelineLayout(m_deviceRef, m_pipelineLayout, nullptr);
+		vkDestroyDescriptorSetLayout(m_deviceRef, m_setLayout, nullptr);
+	}
 
-TEST_F(RendererVKTest, VkShaderInitTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	BufferScaleCompute(const BufferScaleCompute&) = delete;
+	BufferScaleCompute& operator=(const BufferScaleCompute&) = delete;
 
-	VkShader vertexShader{ logicalDevice };
-	vertexShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
-	);
+	void RecordDispatch(VkCommandBuffer commandBuffer, std::uint32_t elementCount) const noexcept {
+		vkCmdBindPipeline(
+			commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_computePSO.GetPipeline()
+		);
+		vkCmdBindDescriptorSets(
+			commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0u, 1u,
+			&m_descriptorSet, 0u, nullptr
+		);
+		vkCmdPushConstants(
+			commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0u,
+			sizeof(std::uint32_t), &elementCount
+		);
+		vkCmdDispatch(
+			commandBuffer, (elementCount + threadBlockSize - 1u) / threadBlockSize, 1u, 1u
+		);
+	}
 
-	VkShaderModule shaderModule = vertexShader.GetShaderModule();
-	VkObjectInitCheck("VkShaderModule", shaderModule);
-}
+private:
+	[[nodiscard]]
+	static VkDescriptorSetLayout CreateSetLayout(VkDevice logicalDevice) {
+		VkDescriptorSetLayoutBinding binding{
+			.binding = 0u,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.descriptorCount = 1u,
+			.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT
+		};
+
+		VkDescriptorSetLayoutCreateInfo setLayoutInfo{
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+			.bindingCount = 1u,
+			.pBindings = &binding
+		};
+
+		VkDescriptorSetLayout setLayout = VK_NULL_HANDLE;
+		vkCreateDescriptorSetLayout(logicalDevice, &setLayoutInfo, nullptr, &setLayout);
+
+		return setLayout;
+	}
 
-TEST_F(RendererVKTest, VkComputePSOTest) {
+private:
+	VkDevice m_deviceRef;
+	VkDescriptorSetLayout m_setLayout;
+	FrameDescriptorAllocator m_frameAllocator;
+	VkDescriptorSet m_descriptorSet;
+	VkPipelineLayout m_pipelineLayout;
+	SpirvShader m_computeShader;
+	VkPipelineObject m_computePSO;
+};
+
+TEST_F(RendererVKTest, DeviceMemoryPoolTest) {
 	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
 
-	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+	constexpr VkDeviceSize blockSize = 64'000u;
+	constexpr VkDeviceSize bufferSize = 16'000u;
+	constexpr size_t bufferCount = 12u;
+
+	DeviceMemoryPool buddyPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = blockSize,
+			.strategy = AllocatorStrategy::Buddy
+		}
+	};
 
-	PipelineLayout layout{ logicalDevice };
-	layout.CreateLayout(
-		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
-	);
+	std::vector<VkBuffer> buffers;
+	std::vector<MemoryAllocation> allocations;
 
-	VkPipelineLayout pipeLayout = layout.GetLayout();
+	for (size_t index = 0u; index < bufferCount; ++index) {
+		VkBuffer buffer = buffers.emplace_back(
+			CreateTestBuffer(logicalDevice, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
+		);
+		VkObjectInitCheck(FormatCompName("Pool", " VkBuffer ", index), buffer);
 
-	VkShader computeShader{ logicalDevice };
-	computeShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"ComputeShaderTest.spv")
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+		std::optional<MemoryAllocation> allocation = buddyPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate from the pool.";
+		EXPECT_EQ(allocation->offset % requirements.alignment, 0u) << "Offset isn't aligned.";
+
+		EXPECT_EQ(
+			vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset),
+			VK_SUCCESS
+		) << "Failed to bind the buffer.";
+
+		allocations.emplace_back(*allocation);
+	}
+
+	const size_t blockCount = buddyPool.GetBlockCount();
+	EXPECT_GT(blockCount, 1u) << "The pool didn't grow past its first block.";
+
+	// Freed space has to be reused before a new block is allocated.
+	for (size_t index = 0u; index < bufferCount; index += 2u) {
+		vkDestroyBuffer(logicalDevice, buffers[index], nullptr);
+		buddyPool.Free(allocations[index]);
+
+		buffers[index] = CreateTestBuffer(
+			logicalDevice, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+		);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffers[index], &requirements);
+
+		std::optional<MemoryAllocation> allocation = buddyPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to reallocate from the pool.";
+		vkBindBufferMemory(logicalDevice, buffers[index], allocation->memory, allocation->offset);
+	}
+
+	EXPECT_EQ(buddyPool.GetBlockCount(), blockCount) << "Freed memory wasn't reused.";
+
+	for (VkBuffer buffer : buffers)
+		vkDestroyBuffer(logicalDevice, buffer, nullptr);
+
+	DeviceMemoryPool linearPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = blockSize,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkBuffer uploadBuffer = CreateTestBuffer(
+		logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT
 	);
 
-	VkShaderModule shaderModule = computeShader.GetShaderModule();
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, uploadBuffer, &requirements);
 
-	VkPipelineObject computePSO{ logicalDevice };
-	computePSO.CreateComputePipeline(logicalDevice, pipeLayout, shaderModule);
+	std::optional<MemoryAllocation> uploadAllocation = linearPool.Allocate(
+		logicalDevice, requirements
+	);
+	ASSERT_TRUE(uploadAllocation) << "Failed to allocate from the linear pool.";
+	EXPECT_NE(uploadAllocation->cpuAddress, nullptr) << "Host visible memory isn't mapped.";
 
-	VkPipeline computePipeline = computePSO.GetPipeline();
-	VkObjectInitCheck("VkComputePipeline", computePipeline);
-}
+	// Linear memory isn't reclaimed by Free, but it mustn't be reported as padding either.
+	std::optional<MemoryAllocation> secondAllocation = linearPool.Allocate(
+		logicalDevice, requirements
+	);
+	ASSERT_TRUE(secondAllocation) << "Failed to allocate from the linear pool.";
 
-TEST_F(RendererVKTest, VkRenderPassInitTest) {
-	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	linearPool.Free(*uploadAllocation);
 
-	VKRenderPass renderPass{ logicalDevice };
-	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+	const HeapStats linearStats = linearPool.GetStats("linearPool");
+	EXPECT_EQ(linearStats.paddingSize, secondAllocation->paddingSize)
+		<< "Freed linear memory was counted as padding.";
+	EXPECT_EQ(linearStats.boundSize, linearPool.GetUsedSize()) << "Bound size doesn't match.";
 
-	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
-	VkObjectInitCheck("VkRenderPass", vkRenderPass);
+	linearPool.Reset();
+	EXPECT_EQ(linearPool.GetUsedSize(), 0u) << "Reset didn't reclaim the linear pool.";
+
+	vkDestroyBuffer(logicalDevice, uploadBuffer, nullptr);
 }
 
-TEST_F(RendererVKTest, VkGraphicsVertexPSOTest) {
+TEST_F(RendererVKTest, VkUploadRingBufferTest) {
 	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	VkQueue graphicsQueue = s_queFamilyMan.GetQueue(GraphicsQueue);
 
-	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+	VkPhysicalDeviceProperties deviceProperty{};
+	vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperty);
 
-	PipelineLayout layout{ logicalDevice };
-	layout.CreateLayout(
-		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	const VkDeviceSize alignment = std::max(
+		deviceProperty.limits.minUniformBufferOffsetAlignment,
+		deviceProperty.limits.minStorageBufferOffsetAlignment
 	);
+	const VkDeviceSize ringSize = Align(SpecificValues::testBufferSize, alignment) * 4u;
+
+	UploadRingBuffer ringBuffer{
+		logicalDevice,
+		UploadRingBuffer::Args{
+			.physicalDevice = physicalDevice,
+			.size = ringSize,
+			.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+		}
+	};
+	VkObjectInitCheck("RingVkBuffer", ringBuffer.GetBuffer());
 
-	VkPipelineLayout pipeLayout = layout.GetLayout();
+	// The frame is fenced the way Terra's render loop fences it, with the front fence of the
+	// graphics sync objects. The earlier tests could have left it signalled.
+	VkFence frameFence = Terra::graphicsSyncObjects->GetFrontFence();
+	VkObjectInitCheck("RingFrameFence", frameFence);
+	vkResetFences(logicalDevice, 1u, &frameFence);
 
-	VkShader vertexShader{ logicalDevice };
-	vertexShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
-	);
+	std::vector<VkDeviceSize> offsets;
 
-	VkShaderModule vertexShaderModule = vertexShader.GetShaderModule();
+	for (size_t index = 0u; index < 4u; ++index) {
+		std::optional<RingAllocation> allocation = ringBuffer.Allocate(
+			SpecificValues::testBufferSize
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate from the ring.";
+		EXPECT_EQ(allocation->offset % alignment, 0u) << "Offset isn't a valid dynamic offset.";
 
-	VkShader fragmentShader{ logicalDevice };
-	fragmentShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
-	);
+		offsets.emplace_back(allocation->offset);
 
-	VkShaderModule fragmentShaderModule = fragmentShader.GetShaderModule();
+		std::memset(allocation->cpuAddress, static_cast<int>(index), SpecificValues::testBufferSize);
+	}
 
-	VKRenderPass renderPass{ logicalDevice };
-	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+	ringBuffer.FinishFrame(frameFence);
+	EXPECT_FALSE(ringBuffer.Allocate(SpecificValues::testBufferSize))
+		<< "Allocated over a frame the GPU hasn't finished.";
 
-	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+	// The last allocation isn't followed by any alignment padding.
+	const VkDeviceSize expectedUsedSize =
+		offsets.back() + SpecificValues::testBufferSize - offsets.front();
 
-	VkPipelineObject graphicsVertexPSO{ logicalDevice };
-	graphicsVertexPSO.CreateGraphicsPipelineVS(
-		logicalDevice, pipeLayout, vkRenderPass,
-		VertexLayout()
-		.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
-		.InitLayout(), vertexShaderModule, fragmentShaderModule
-	);
+	ringBuffer.ReclaimFinishedFrames(logicalDevice);
+	EXPECT_EQ(ringBuffer.GetUsedSize(), expectedUsedSize)
+		<< "Reclaimed a frame which wasn't submitted.";
 
-	VkPipeline graphicsVertexPipeline = graphicsVertexPSO.GetPipeline();
-	VkObjectInitCheck("VkGraphicsVertexPipeline", graphicsVertexPipeline);
+	// An empty submission signals the fence once the queue is idle.
+	vkQueueSubmit(graphicsQueue, 0u, nullptr, frameFence);
+	vkWaitForFences(logicalDevice, 1u, &frameFence, VK_TRUE, UINT64_MAX);
+
+	ringBuffer.ReclaimFinishedFrames(logicalDevice);
+	EXPECT_EQ(ringBuffer.GetUsedSize(), 0u) << "The finished frame wasn't reclaimed.";
+	EXPECT_TRUE(ringBuffer.Allocate(SpecificValues::testBufferSize))
+		<< "The reclaimed space wasn't reused.";
+
+	Terra::graphicsSyncObjects->AdvanceSyncObjectsInQueue();
 }
 
-TEST_F(RendererVKTest, VkGraphicsMeshPSOTest) {
+TEST_F(RendererVKTest, VkUploadSchedulerTest) {
 	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
 
-	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+	constexpr size_t uploadCount = 64u;
+	constexpr VkDeviceSize uploadSize = sizeof(std::uint32_t) * 4u;
+	constexpr VkDeviceSize dstSize = uploadSize * uploadCount;
+
+	// The destination is host visible so the result can be read back.
+	DeviceMemoryPool readbackPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = dstSize,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
 
-	PipelineLayout layout{ logicalDevice };
-	layout.CreateLayout(
-		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
-	);
+	VkBuffer dstBuffer = CreateTestBuffer(logicalDevice, dstSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
 
-	VkPipelineLayout pipeLayout = layout.GetLayout();
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, dstBuffer, &requirements);
 
-	VkShader meshShader{ logicalDevice };
-	meshShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"MeshShaderTest.spv")
-	);
+	std::optional<MemoryAllocation> dstMemory = readbackPool.Allocate(logicalDevice, requirements);
+	ASSERT_TRUE(dstMemory) << "Failed to allocate the readback memory.";
+	vkBindBufferMemory(logicalDevice, dstBuffer, dstMemory->memory, dstMemory->offset);
 
-	VkShaderModule meshShaderModule = meshShader.GetShaderModule();
+	UploadScheduler uploadScheduler{
+		logicalDevice,
+		UploadScheduler::Args{
+			.physicalDevice = physicalDevice,
+			.transferQueue = s_queFamilyMan.GetQueue(TransferQueue),
+			.transferFamilyIndex = s_queFamilyMan.GetIndex(TransferQueue),
+			.stagingSize = dstSize * 2u
+		}
+	};
 
-	VkShader fragmentShader{ logicalDevice };
-	fragmentShader.CreateShader(
-		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
-	);
+	for (size_t index = 0u; index < uploadCount; ++index) {
+		const auto value = static_cast<std::uint32_t>(index);
+		const std::uint32_t data[4]{ value, value, value, value };
 
-	VkShaderModule fragmentShaderModule = fragmentShader.GetShaderModule();
+		EXPECT_TRUE(uploadScheduler.QueueUpload(dstBuffer, uploadSize * index, data, uploadSize))
+			<< "The staging ring filled up.";
+	}
 
-	VKRenderPass renderPass{ logicalDevice };
-	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+	EXPECT_EQ(uploadScheduler.GetPendingCopyCount(), uploadCount) << "Pending count doesn't match.";
 
-	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+	UploadBatch uploadBatch = uploadScheduler.Flush(logicalDevice, false);
+	VkObjectNullCheck("UploadSemaphore", uploadBatch.waitSemaphore);
+	// The uploads are contiguous in both the staging ring and the destination.
+	EXPECT_EQ(uploadBatch.regionCount, 1u) << "The uploads weren't merged into one region.";
 
-	VkPipelineObject graphicsMeshPSO{ logicalDevice };
-	graphicsMeshPSO.CreateGraphicsPipelineMS(
-		logicalDevice, pipeLayout, vkRenderPass, meshShaderModule, fragmentShaderModule
+	uploadScheduler.WaitForBatch(logicalDevice, uploadBatch.batchId);
+	EXPECT_TRUE(uploadScheduler.IsBatchComplete(logicalDevice, uploadBatch.batchId))
+		<< "The batch didn't complete.";
+
+	SubmitHostReadBarrier(
+		logicalDevice, s_queFamilyMan.GetQueue(TransferQueue),
+		s_queFamilyMan.GetIndex(TransferQueue), VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT
 	);
 
-	VkPipeline graphicsMeshPipeline = graphicsMeshPSO.GetPipeline();
-	VkObjectInitCheck("VkGraphicsMeshPipeline", graphicsMeshPipeline);
+	auto const* result = static_cast<std::uint32_t const*>(dstMemory->cpuAddress);
+	for (size_t index = 0u; index < uploadCount * 4u; ++index)
+		EXPECT_EQ(result[index], static_cast<std::uint32_t>(index / 4u))
+			<< "Uploaded value " << index << " doesn't match.";
+
+	vkDestroyBuffer(logicalDevice, dstBuffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkBindlessDescriptorTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	if (!featureDevice.descriptorIndexing)
+		GTEST_SKIP() << "Descriptor indexing isn't supported.";
+
+	constexpr VkDeviceSize bufferSize = 256u;
+	constexpr size_t bufferCount = 8u;
+
+	BindlessDescriptorTable graphicsTable{
+		logicalDevice,
+		BindlessDescriptorTable::Args{
+			.physicalDevice = physicalDevice,
+			.stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			.storageBufferCount = 1'024u,
+			.sampledImageCount = 1'024u,
+			.storageImageCount = 64u
+		}
+	};
+	VkObjectInitCheck("BindlessGraphicsLayout", graphicsTable.GetLayout());
+	VkObjectInitCheck("BindlessGraphicsSet", graphicsTable.GetDescriptorSet());
+
+	BindlessDescriptorTable computeTable{
+		logicalDevice,
+		BindlessDescriptorTable::Args{
+			.physicalDevice = physicalDevice,
+			.stages = VK_SHADER_STAGE_COMPUTE_BIT,
+			.storageBufferCount = 1'024u,
+			.sampledImageCount = 0u,
+			.storageImageCount = 0u
+		}
+	};
+	VkObjectInitCheck("BindlessComputeSet", computeTable.GetDescriptorSet());
+
+	DeviceMemoryPool bufferPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = 64'000u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	std::vector<VkBuffer> buffers;
+	std::vector<std::uint32_t> slots;
+
+	for (size_t index = 0u; index < bufferCount; ++index) {
+		VkBuffer buffer = buffers.emplace_back(
+			CreateTestBuffer(logicalDevice, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT)
+		);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+		std::optional<MemoryAllocation> allocation = bufferPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+		vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+
+		std::optional<std::uint32_t> slot = graphicsTable.AddStorageBuffer(
+			VkDescriptorBufferInfo{ .buffer = buffer, .offset = 0u, .range = VK_WHOLE_SIZE }
+		);
+		ASSERT_TRUE(slot) << "Failed to allocate a bindless slot.";
+		slots.emplace_back(*slot);
+	}
+
+	EXPECT_EQ(graphicsTable.GetUsedCount(BindlessType::StorageBuffer), bufferCount)
+		<< "Used slot count doesn't match.";
+	EXPECT_EQ(graphicsTable.Flush(logicalDevice), bufferCount) << "Written count doesn't match.";
+	EXPECT_EQ(graphicsTable.Flush(logicalDevice), 0u) << "Unchanged slots were written again.";
+
+	// Replacing a resource only writes its own slot.
+	graphicsTable.Remove(BindlessType::StorageBuffer, slots[2]);
+	std::optional<std::uint32_t> reusedSlot = graphicsTable.AddStorageBuffer(
+		VkDescriptorBufferInfo{ .buffer = buffers[5], .offset = 0u, .range = VK_WHOLE_SIZE }
+	);
+	ASSERT_TRUE(reusedSlot) << "Failed to allocate a bindless slot.";
+	EXPECT_EQ(*reusedSlot, slots[2]) << "The freed slot wasn't reused.";
+
+	graphicsTable.UpdateStorageBuffer(
+		slots[3], VkDescriptorBufferInfo{ .buffer = buffers[6], .offset = 0u, .range = bufferSize }
+	);
+	EXPECT_EQ(graphicsTable.Flush(logicalDevice), 2u) << "Only the changed slots should be written.";
+
+	std::optional<std::uint32_t> computeSlot = computeTable.AddStorageBuffer(
+		VkDescriptorBufferInfo{ .buffer = buffers[0], .offset = 0u, .range = VK_WHOLE_SIZE }
+	);
+	ASSERT_TRUE(computeSlot) << "Failed to allocate a bindless slot.";
+	EXPECT_EQ(computeTable.Flush(logicalDevice), 1u) << "Written count doesn't match.";
+
+	VkDescriptorSetLayout bindlessLayout = computeTable.GetLayout();
+	VkPipelineLayoutCreateInfo layoutInfo{
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.setLayoutCount = 1u,
+		.pSetLayouts = &bindlessLayout
+	};
+
+	VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+	EXPECT_EQ(
+		vkCreatePipelineLayout(logicalDevice, &layoutInfo, nullptr, &pipelineLayout), VK_SUCCESS
+	) << "The bindless layout can't be used in a pipeline layout.";
+
+	vkDestroyPipelineLayout(logicalDevice, pipelineLayout, nullptr);
+
+	for (VkBuffer buffer : buffers)
+		vkDestroyBuffer(logicalDevice, buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkDescriptorUpdateBuilderTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	constexpr std::uint32_t arrayCount = 64u;
+	constexpr std::uint32_t setsPerPool = 4u;
+	constexpr VkDeviceSize elementSize = 256u;
+
+	const std::array<VkDescriptorSetLayoutBinding, 2u> bindings{
+		VkDescriptorSetLayoutBinding{
+			.binding = 0u,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.descriptorCount = arrayCount,
+			.stageFlags = VK_SHADER_STAGE_ALL
+		},
+		VkDescriptorSetLayoutBinding{
+			.binding = 1u,
+			.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+			.descriptorCount = 1u,
+			.stageFlags = VK_SHADER_STAGE_ALL
+		}
+	};
+
+	VkDescriptorSetLayoutCreateInfo layoutInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.bindingCount = static_cast<std::uint32_t>(std::size(bindings)),
+		.pBindings = std::data(bindings)
+	};
+
+	VkDescriptorSetLayout setLayout = VK_NULL_HANDLE;
+	vkCreateDescriptorSetLayout(logicalDevice, &layoutInfo, nullptr, &setLayout);
+	VkObjectInitCheck("UpdateBuilderSetLayout", setLayout);
+
+	FrameDescriptorAllocator frameAllocator{
+		logicalDevice,
+		FrameDescriptorAllocator::Args{
+			.frameCount = SpecificValues::bufferCount,
+			.setsPerPool = setsPerPool,
+			.poolSizes = {
+				VkDescriptorPoolSize{
+					.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+					.descriptorCount = setsPerPool * (arrayCount + 1u)
+				}
+			}
+		}
+	};
+
+	frameAllocator.BeginFrame(logicalDevice, 0u);
+
+	std::vector<VkDescriptorSet> descriptorSets;
+	for (std::uint32_t index = 0u; index < setsPerPool * 2u + 1u; ++index) {
+		VkDescriptorSet descriptorSet = descriptorSets.emplace_back(
+			frameAllocator.Allocate(logicalDevice, setLayout)
+		);
+		VkObjectInitCheck(FormatCompName("Frame", " VkDescriptorSet ", index), descriptorSet);
+	}
+
+	// A pool only has to fail once it runs out of sets or descriptors, some drivers keep
+	// handing out sets past both. So the count lies between one pool and one per setsPerPool.
+	const size_t grownPoolCount = frameAllocator.GetPoolCount(0u);
+	EXPECT_GE(grownPoolCount, 1u) << "The frame didn't create a pool.";
+	EXPECT_LE(grownPoolCount, 3u) << "The frame grew more pools than it needed.";
+	EXPECT_EQ(frameAllocator.GetPoolCount(1u), 0u) << "An unused frame created a pool.";
+
+	DeviceMemoryPool bufferPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = elementSize * arrayCount * 2u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkBuffer buffer = CreateTestBuffer(
+		logicalDevice, elementSize * arrayCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+	);
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+	std::optional<MemoryAllocation> allocation = bufferPool.Allocate(logicalDevice, requirements);
+	ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+	vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+
+	std::vector<VkDescriptorBufferInfo> bufferInfos;
+	for (std::uint32_t index = 0u; index < arrayCount; ++index)
+		bufferInfos.emplace_back(VkDescriptorBufferInfo{
+			.buffer = buffer, .offset = elementSize * index, .range = elementSize
+		});
+
+	DescriptorUpdateBuilder updateBuilder{
+		logicalDevice,
+		DescriptorUpdateBuilder::Args{
+			.writeCapacity = setsPerPool,
+			.bufferInfoCapacity = arrayCount * 2u,
+			.imageInfoCapacity = 0u
+		}
+	};
+
+	updateBuilder.AddBuffers(
+		descriptorSets[0], 0u, 0u, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bufferInfos
+	);
+	EXPECT_EQ(updateBuilder.GetPendingWriteCount(), 1u)
+		<< "Consecutive elements weren't merged into one write.";
+
+	updateBuilder.AddBuffer(
+		descriptorSets[0], 1u, 0u, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bufferInfos[0]
+	);
+	EXPECT_EQ(updateBuilder.Flush(), 2u) << "Flushed write count doesn't match.";
+	EXPECT_EQ(updateBuilder.GetFlushCount(), 1u) << "Flush count doesn't match.";
+
+	// More separate writes than the capacity flush early instead of growing.
+	for (VkDescriptorSet descriptorSet : descriptorSets)
+		updateBuilder.AddBuffer(
+			descriptorSet, 1u, 0u, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bufferInfos[1]
+		);
+
+	updateBuilder.Flush();
+
+	const size_t batchCount = (std::size(descriptorSets) + setsPerPool - 1u) / setsPerPool;
+	EXPECT_EQ(updateBuilder.GetFlushCount(), 1u + batchCount)
+		<< "The writes weren't flushed in capacity sized batches.";
+
+	// Resetting the frame reuses its pools.
+	frameAllocator.BeginFrame(logicalDevice, 0u);
+	for (std::uint32_t index = 0u; index < setsPerPool * 2u + 1u; ++index)
+		VkObjectInitCheck(
+			FormatCompName("Reset", " VkDescriptorSet ", index),
+			frameAllocator.Allocate(logicalDevice, setLayout)
+		);
+	EXPECT_EQ(frameAllocator.GetPoolCount(0u), grownPoolCount)
+		<< "The reset pools weren't reused.";
+
+	vkDestroyBuffer(logicalDevice, buffer, nullptr);
+	vkDestroyDescriptorSetLayout(logicalDevice, setLayout, nullptr);
+}
+
+TEST_F(RendererVKTest, VkParallelCommandRecorderTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	VkQueue graphicsQueue = s_queFamilyMan.GetQueue(GraphicsQueue);
+
+	constexpr size_t threadCount = 4u;
+	constexpr size_t itemCount = 256u;
+	constexpr size_t chunkSize = 16u;
+	constexpr VkDeviceSize bufferSize = sizeof(std::uint32_t) * itemCount;
+
+	DeviceMemoryPool readbackPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = bufferSize * 2u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkBuffer dstBuffer = CreateTestBuffer(
+		logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT
+	);
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, dstBuffer, &requirements);
+
+	std::optional<MemoryAllocation> dstMemory = readbackPool.Allocate(logicalDevice, requirements);
+	ASSERT_TRUE(dstMemory) << "Failed to allocate the readback memory.";
+	vkBindBufferMemory(logicalDevice, dstBuffer, dstMemory->memory, dstMemory->offset);
+
+	JobSystem jobSystem{ threadCount };
+	ParallelCommandRecorder commandRecorder{
+		logicalDevice,
+		ParallelCommandRecorder::Args{
+			.queueFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue),
+			.frameCount = SpecificValues::bufferCount,
+			.threadCount = threadCount
+		}
+	};
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence frameFence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &frameFence);
+
+	// Outside of a render pass, so nothing is inherited.
+	VkCommandBufferInheritanceInfo inheritanceInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO
+	};
+
+	constexpr size_t chunkCount = itemCount / chunkSize;
+
+	// Without reuse, every frame would allocate chunkCount more and pass the limit below.
+	for (std::uint32_t frame = 0u; frame <= threadCount; ++frame) {
+		commandRecorder.BeginFrame(logicalDevice, 0u);
+
+		std::vector<VkCommandBuffer> secondaries = commandRecorder.RecordSecondaries(
+			logicalDevice, jobSystem, itemCount, chunkSize, inheritanceInfo,
+			[dstBuffer, frame](VkCommandBuffer commandBuffer, size_t begin, size_t end) {
+				for (size_t index = begin; index < end; ++index)
+					vkCmdFillBuffer(
+						commandBuffer, dstBuffer, sizeof(std::uint32_t) * index,
+						sizeof(std::uint32_t), static_cast<std::uint32_t>(index + frame)
+					);
+			}
+		);
+		ASSERT_EQ(std::size(secondaries), chunkCount) << "Chunk count doesn't match.";
+
+		for (size_t index = 0u; index < std::size(secondaries); ++index)
+			VkObjectInitCheck(
+				FormatCompName("Secondary", " VkCommandBuffer ", index), secondaries[index]
+			);
+
+		VkCommandBuffer primary = commandRecorder.GetPrimaryCommandBuffer();
+		VkObjectInitCheck("PrimaryVkCommandBuffer", primary);
+
+		VkCommandBufferBeginInfo beginInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+		};
+
+		vkBeginCommandBuffer(primary, &beginInfo);
+		vkCmdExecuteCommands(
+			primary, static_cast<std::uint32_t>(std::size(secondaries)), std::data(secondaries)
+		);
+		RecordHostReadBarrier(
+			primary, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+		);
+		vkEndCommandBuffer(primary);
+
+		VkSubmitInfo submitInfo{
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.commandBufferCount = 1u,
+			.pCommandBuffers = &primary
+		};
+
+		vkQueueSubmit(graphicsQueue, 1u, &submitInfo, frameFence);
+		vkWaitForFences(logicalDevice, 1u, &frameFence, VK_TRUE, UINT64_MAX);
+		vkResetFences(logicalDevice, 1u, &frameFence);
+
+		auto const* result = static_cast<std::uint32_t const*>(dstMemory->cpuAddress);
+		for (size_t index = 0u; index < itemCount; ++index)
+			EXPECT_EQ(result[index], static_cast<std::uint32_t>(index + frame))
+				<< "Value " << index << " of frame " << frame << " doesn't match.";
+
+		// Stealing decides how many chunks each worker records, so a worker can need more
+		// command buffers than in an earlier frame, but never more than every chunk.
+		const size_t secondaryCount = commandRecorder.GetSecondaryCount();
+		EXPECT_GE(secondaryCount, chunkCount) << "Secondary count doesn't match.";
+		EXPECT_LE(secondaryCount, chunkCount * threadCount)
+			<< "The reset command buffers weren't reused.";
+	}
+
+	// A worker of this one would have no command pool.
+	JobSystem largerJobSystem{ threadCount + 1u };
+	commandRecorder.BeginFrame(logicalDevice, 0u);
+
+	EXPECT_TRUE(std::empty(commandRecorder.RecordSecondaries(
+		logicalDevice, largerJobSystem, itemCount, chunkSize, inheritanceInfo,
+		[](VkCommandBuffer, size_t, size_t) {}
+	))) << "The extra workers weren't rejected.";
+
+	vkDestroyFence(logicalDevice, frameFence, nullptr);
+	vkDestroyBuffer(logicalDevice, dstBuffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkTimelineSemaphoreTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+
+	if (!featureDevice.timelineSemaphore)
+		GTEST_SKIP() << "Timeline semaphores aren't supported.";
+
+	QueueTimeline graphicsTimeline{
+		logicalDevice,
+		QueueTimeline::Args{
+			.queue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(GraphicsQueue))
+		}
+	};
+	QueueTimeline computeTimeline{
+		logicalDevice,
+		QueueTimeline::Args{
+			.queue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(ComputeQueue))
+		}
+	};
+	QueueTimeline transferTimeline{
+		logicalDevice,
+		QueueTimeline::Args{
+			.queue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(TransferQueue))
+		}
+	};
+	VkObjectInitCheck("GraphicsTimeline", graphicsTimeline.GetTimeline().GetSemaphore());
+
+	// The graphics work can't start before the CPU signals its input is ready.
+	TimelineSemaphore hostTimeline{ logicalDevice };
+
+	const std::array hostWaits{
+		TimelineWait{ hostTimeline.GetPoint(1u), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT }
+	};
+	const std::optional<TimelinePoint> graphicsPoint = graphicsTimeline.Submit({}, hostWaits);
+	ASSERT_TRUE(graphicsPoint) << "Failed to submit to the graphics queue.";
+	EXPECT_EQ(graphicsPoint->value, 1u) << "The first submission should signal 1.";
+
+	// Compute depends on graphics and transfer on compute.
+	const std::array computeWaits{
+		TimelineWait{ *graphicsPoint, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT }
+	};
+	const std::optional<TimelinePoint> computePoint = computeTimeline.Submit({}, computeWaits);
+	ASSERT_TRUE(computePoint) << "Failed to submit to the compute queue.";
+
+	const std::array transferWaits{
+		TimelineWait{ *computePoint, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT }
+	};
+	const std::optional<TimelinePoint> transferPoint = transferTimeline.Submit(
+		{}, transferWaits
+	);
+	ASSERT_TRUE(transferPoint) << "Failed to submit to the transfer queue.";
+
+	// None of them can complete yet, and asking doesn't block.
+	EXPECT_FALSE(graphicsTimeline.IsComplete(logicalDevice, graphicsPoint->value))
+		<< "Graphics completed before its wait was signalled.";
+	EXPECT_FALSE(transferTimeline.Wait(logicalDevice, transferPoint->value, 1'000'000u))
+		<< "Transfer completed before the work it depends on.";
+
+	hostTimeline.Signal(logicalDevice, 1u);
+
+	const std::array points{ *graphicsPoint, *computePoint, *transferPoint };
+	EXPECT_TRUE(TimelineSemaphore::WaitForAll(logicalDevice, points))
+		<< "The queues didn't reach their points.";
+
+	EXPECT_EQ(computeTimeline.GetCompletedValue(logicalDevice), 1u)
+		<< "Completed value doesn't match.";
+
+	// Frames keep counting up without resetting anything.
+	for (std::uint64_t frame = 2u; frame <= 4u; ++frame) {
+		const std::optional<TimelinePoint> framePoint = graphicsTimeline.Submit({});
+		ASSERT_TRUE(framePoint) << "Failed to submit to the graphics queue.";
+		EXPECT_EQ(framePoint->value, frame) << "Frame value doesn't match.";
+	}
+
+	EXPECT_TRUE(graphicsTimeline.WaitIdle(logicalDevice)) << "The graphics queue didn't finish.";
+	EXPECT_EQ(graphicsTimeline.GetCompletedValue(logicalDevice), 4u)
+		<< "Completed value doesn't match.";
+}
+
+TEST_F(RendererVKTest, VkAsyncComputeTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	if (!featureDevice.timelineSemaphore)
+		GTEST_SKIP() << "Timeline semaphores aren't supported.";
+
+	constexpr std::uint32_t elementCount = 1'048'576u;
+	constexpr std::uint32_t fillValue = 0xABCDu;
+	constexpr VkDeviceSize bufferSize = sizeof(std::uint32_t) * elementCount;
+
+	AsyncComputeScheduler scheduler{
+		logicalDevice,
+		AsyncComputeScheduler::Args{
+			.graphicsQueue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(GraphicsQueue)),
+			.graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue),
+			.computeQueue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(ComputeQueue)),
+			.computeFamilyIndex = s_queFamilyMan.GetIndex(ComputeQueue)
+		}
+	};
+
+	DeviceMemoryPool readbackPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = bufferSize * 4u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	// The shared buffer goes back and forth, the fill buffer only ever sees graphics.
+	const std::array<VkBuffer, 3u> buffers{
+		CreateTestBuffer(
+			logicalDevice, bufferSize,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+		),
+		CreateTestBuffer(logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT),
+		CreateTestBuffer(logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT)
+	};
+	const auto [sharedBuffer, copyBuffer, fillBuffer] = buffers;
+
+	std::array<void*, 3u> cpuAddresses{};
+	for (size_t index = 0u; index < std::size(buffers); ++index) {
+		VkObjectInitCheck(FormatCompName("AsyncCompute", " VkBuffer ", index), buffers[index]);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffers[index], &requirements);
+
+		std::optional<MemoryAllocation> allocation = readbackPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+		vkBindBufferMemory(
+			logicalDevice, buffers[index], allocation->memory, allocation->offset
+		);
+
+		cpuAddresses[index] = allocation->cpuAddress;
+	}
+
+	auto* sharedValues = static_cast<std::uint32_t*>(cpuAddresses[0]);
+	for (std::uint32_t index = 0u; index < elementCount; ++index)
+		sharedValues[index] = index;
+
+	BufferScaleCompute scaleCompute{ logicalDevice, sharedBuffer, "AsyncCompute" };
+
+	auto scalePass = [&scaleCompute](VkCommandBuffer commandBuffer) {
+		scaleCompute.RecordDispatch(commandBuffer, elementCount);
+	};
+
+	const std::array handOver{
+		SharedBuffer{
+			.buffer = sharedBuffer,
+			.graphicsStages = VK_PIPELINE_STAGE_TRANSFER_BIT,
+			.graphicsAccess = VK_ACCESS_TRANSFER_READ_BIT,
+			.computeAccess = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT
+		}
+	};
+
+	const std::optional<TimelinePoint> firstComputePoint = scheduler.SubmitCompute(
+		logicalDevice, scalePass, AsyncComputeScheduler::PassBuffers{ .release = handOver }
+	);
+	ASSERT_TRUE(firstComputePoint) << "Failed to submit the first compute pass.";
+
+	// Doesn't wait for anything, so it can run while the compute queue is busy.
+	const std::optional<TimelinePoint> fillPoint = scheduler.SubmitGraphics(
+		logicalDevice,
+		[fillBuffer](VkCommandBuffer commandBuffer) {
+			vkCmdFillBuffer(commandBuffer, fillBuffer, 0u, VK_WHOLE_SIZE, fillValue);
+			RecordHostReadBarrier(
+				commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+			);
+		}
+	);
+	ASSERT_TRUE(fillPoint) << "Failed to submit the fill pass.";
+
+	const std::array graphicsWaits{
+		TimelineWait{ *firstComputePoint, VK_PIPELINE_STAGE_TRANSFER_BIT }
+	};
+	const std::optional<TimelinePoint> copyPoint = scheduler.SubmitGraphics(
+		logicalDevice,
+		[sharedBuffer, copyBuffer](VkCommandBuffer commandBuffer) {
+			VkBufferCopy copyRegion{ .srcOffset = 0u, .dstOffset = 0u, .size = bufferSize };
+			vkCmdCopyBuffer(commandBuffer, sharedBuffer, copyBuffer, 1u, &copyRegion);
+			RecordHostReadBarrier(
+				commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+			);
+		},
+		AsyncComputeScheduler::PassBuffers{ .acquire = handOver, .release = handOver },
+		graphicsWaits
+	);
+	ASSERT_TRUE(copyPoint) << "Failed to submit the copy pass.";
+	EXPECT_EQ(copyPoint->value, fillPoint->value + 1u) << "Graphics value doesn't match.";
+
+	const std::array computeWaits{
+		TimelineWait{ *copyPoint, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT }
+	};
+	// The CPU reads the shared buffer after the second pass.
+	auto readbackScalePass = [scalePass](VkCommandBuffer commandBuffer) {
+		scalePass(commandBuffer);
+		RecordHostReadBarrier(
+			commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT
+		);
+	};
+
+	const std::optional<TimelinePoint> secondComputePoint = scheduler.SubmitCompute(
+		logicalDevice, readbackScalePass,
+		AsyncComputeScheduler::PassBuffers{ .acquire = handOver }, computeWaits
+	);
+	ASSERT_TRUE(secondComputePoint) << "Failed to submit the second compute pass.";
+
+	EXPECT_TRUE(
+		scheduler.GetComputeTimeline().Wait(logicalDevice, secondComputePoint->value)
+	) << "The second compute pass didn't finish.";
+	scheduler.WaitIdle(logicalDevice);
+
+	auto const* copiedValues = static_cast<std::uint32_t const*>(cpuAddresses[1]);
+	auto const* filledValues = static_cast<std::uint32_t const*>(cpuAddresses[2]);
+	for (std::uint32_t index = 0u; index < elementCount; ++index) {
+		ASSERT_EQ(copiedValues[index], index * 2u + 1u)
+			<< "Graphics didn't see the first compute pass at " << index << ".";
+		ASSERT_EQ(sharedValues[index], index * 4u + 3u)
+			<< "Compute result doesn't match at " << index << ".";
+		ASSERT_EQ(filledValues[index], fillValue) << "Fill value doesn't match at " << index << ".";
+	}
+
+	// The passes which completed hand their command buffers to the next ones.
+	const std::optional<TimelinePoint> reusePoint = scheduler.SubmitCompute(
+		logicalDevice, scalePass
+	);
+	ASSERT_TRUE(reusePoint) << "Failed to submit the compute pass again.";
+	EXPECT_EQ(reusePoint->value, secondComputePoint->value + 1u)
+		<< "Compute value doesn't match.";
+	scheduler.WaitIdle(logicalDevice);
+
+	for (VkBuffer buffer : buffers)
+		vkDestroyBuffer(logicalDevice, buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkDeferredDestructionTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	if (!featureDevice.timelineSemaphore)
+		GTEST_SKIP() << "Timeline semaphores aren't supported.";
+
+	constexpr VkDeviceSize bufferSize = 64'000u;
+	constexpr std::uint64_t frameCount = 8u;
+
+	DeviceMemoryPool bufferPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = bufferSize * frameCount,
+			.strategy = AllocatorStrategy::Buddy
+		}
+	};
+
+	QueueTimeline graphicsTimeline{
+		logicalDevice,
+		QueueTimeline::Args{
+			.queue = featureDevice.GetQueue(s_queFamilyMan.GetIndex(GraphicsQueue))
+		}
+	};
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.queueFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue)
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	// One per frame, none of them is waited for before the next frame.
+	std::vector<VkCommandBuffer> commandBuffers(frameCount, VK_NULL_HANDLE);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = static_cast<std::uint32_t>(frameCount)
+	};
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, std::data(commandBuffers));
+
+	DeferredDestructionQueue destructionQueue{ logicalDevice };
+
+	// Every frame replaces a buffer which the frame before it still used, without waiting for
+	// the device.
+	for (std::uint64_t frame = 0u; frame < frameCount; ++frame) {
+		destructionQueue.Collect(logicalDevice, graphicsTimeline.GetCompletedValue(logicalDevice));
+
+		VkBuffer buffer = CreateTestBuffer(
+			logicalDevice, bufferSize,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+		);
+		VkObjectInitCheck(FormatCompName("Deferred", " VkBuffer ", frame), buffer);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+		std::optional<MemoryAllocation> allocation = bufferPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+		vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+
+		// The GPU writes the buffer, so destroying it before the frame completes would be a use
+		// after free the validation layers report.
+		VkCommandBuffer commandBuffer = commandBuffers[frame];
+
+		VkCommandBufferBeginInfo beginInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+		};
+
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+		vkCmdFillBuffer(
+			commandBuffer, buffer, 0u, VK_WHOLE_SIZE, static_cast<std::uint32_t>(frame)
+		);
+		vkEndCommandBuffer(commandBuffer);
+
+		const std::optional<TimelinePoint> framePoint = graphicsTimeline.Submit(
+			std::span{ &commandBuffer, 1u }
+		);
+		ASSERT_TRUE(framePoint) << "Failed to submit to the graphics queue.";
+
+		destructionQueue.EnqueueBuffer(framePoint->value, buffer);
+		destructionQueue.EnqueueMemory(framePoint->value, bufferPool, *allocation);
+	}
+
+	EXPECT_GT(destructionQueue.GetPendingMemorySize(), 0u) << "Pending memory wasn't tracked.";
+
+	EXPECT_TRUE(graphicsTimeline.WaitIdle(logicalDevice)) << "The graphics queue didn't finish.";
+	destructionQueue.Collect(logicalDevice, graphicsTimeline.GetCompletedValue(logicalDevice));
+
+	EXPECT_EQ(destructionQueue.GetPendingCount(), 0u) << "Objects left after the last frame.";
+	EXPECT_EQ(destructionQueue.GetPendingMemorySize(), 0u) << "Memory left after the last frame.";
+	EXPECT_EQ(bufferPool.GetUsedSize(), 0u) << "The memory didn't go back to the pool.";
+
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+}
+
+TEST_F(RendererVKTest, VkGpuProfilerTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const std::uint32_t graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue);
+
+	if (!GpuProfiler::IsSupported(physicalDevice, graphicsFamilyIndex))
+		GTEST_SKIP() << "The graphics queue doesn't write timestamps.";
+
+	constexpr VkDeviceSize bufferSize = 4'000'000u;
+
+	// The pipelineStatisticsQuery feature isn't enabled on the device, so only timestamps.
+	GpuProfiler profiler{
+		logicalDevice,
+		GpuProfiler::Args{
+			.physicalDevice = physicalDevice,
+			.queueFamilyIndex = graphicsFamilyIndex,
+			.frameCount = SpecificValues::bufferCount,
+			.maxScopesPerFrame = 2u,
+			.statisticFlags = 0u,
+			.queueName = "Graphics"
+		}
+	};
+
+	DeviceMemoryPool bufferPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = bufferSize,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkBuffer buffer = CreateTestBuffer(
+		logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT
+	);
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+	std::optional<MemoryAllocation> allocation = bufferPool.Allocate(logicalDevice, requirements);
+	ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+	vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.queueFamilyIndex = graphicsFamilyIndex
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence frameFence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &frameFence);
+
+	ChromeTrace trace{};
+
+	{
+		CpuTraceScope recordScope{ trace, "Record" };
+
+		VkCommandBufferBeginInfo beginInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+		};
+
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+		profiler.BeginFrame(commandBuffer, 0u);
+
+		const std::uint32_t frameScope = profiler.BeginScope(commandBuffer, "Frame");
+		const std::uint32_t fillScope = profiler.BeginScope(commandBuffer, "Fill");
+		vkCmdFillBuffer(commandBuffer, buffer, 0u, VK_WHOLE_SIZE, 0x1234u);
+		profiler.EndScope(commandBuffer, fillScope);
+
+		EXPECT_EQ(profiler.BeginScope(commandBuffer, "Overflow"), GpuProfiler::invalidScope)
+			<< "A scope past the maximum got queries.";
+
+		// The frame scope is left open, EndFrame has to end it.
+		profiler.EndFrame(commandBuffer);
+		profiler.EndScope(commandBuffer, frameScope);
+
+		vkEndCommandBuffer(commandBuffer);
+	}
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &commandBuffer
+	};
+
+	vkQueueSubmit(s_queFamilyMan.GetQueue(GraphicsQueue), 1u, &submitInfo, frameFence);
+	profiler.SetSubmitTime(ChromeTrace::Clock::now());
+
+	vkWaitForFences(logicalDevice, 1u, &frameFence, VK_TRUE, UINT64_MAX);
+	ASSERT_TRUE(profiler.CollectFrame(logicalDevice, 0u))
+		<< "The results weren't available after the fence.";
+
+	const std::vector<GpuScopeResult>& results = profiler.GetResults(0u);
+	ASSERT_EQ(std::size(results), 2u) << "Scope count doesn't match.";
+
+	EXPECT_EQ(results[0].name, "Frame") << "Name doesn't match.";
+	EXPECT_EQ(results[1].depth, 1u) << "The nested scope's depth doesn't match.";
+	EXPECT_GT(results[1].durationUs, 0.0) << "The fill took no time.";
+	EXPECT_LE(results[1].startUs + results[1].durationUs, results[0].durationUs + 1.0)
+		<< "The nested scope ended after its parent.";
+	EXPECT_TRUE(std::empty(results[0].statistics)) << "Statistics without flags.";
+
+	profiler.ExportToTrace(trace, 0u);
+	const std::string json = trace.ToJSON();
+	EXPECT_NE(json.find("\"name\":\"Fill\",\"cat\":\"gpu\""), std::string::npos)
+		<< "The GPU scope is missing from the trace.";
+	EXPECT_NE(json.find("\"name\":\"Record\",\"cat\":\"cpu\""), std::string::npos)
+		<< "The CPU scope is missing from the trace.";
+
+	vkDestroyFence(logicalDevice, frameFence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+	vkDestroyBuffer(logicalDevice, buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkGpuProfilerStatisticsTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const std::uint32_t graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue);
+
+	if (!featureDevice.pipelineStatisticsQuery)
+		GTEST_SKIP() << "Pipeline statistics queries aren't supported.";
+	if (!GpuProfiler::IsSupported(physicalDevice, graphicsFamilyIndex))
+		GTEST_SKIP() << "The graphics queue doesn't write timestamps.";
+
+	constexpr std::uint32_t elementCount = 4'096u;
+	constexpr VkDeviceSize bufferSize = sizeof(std::uint32_t) * elementCount;
+
+	GpuProfiler profiler{
+		logicalDevice,
+		GpuProfiler::Args{
+			.physicalDevice = physicalDevice,
+			.queueFamilyIndex = graphicsFamilyIndex,
+			.frameCount = 1u,
+			.maxScopesPerFrame = 2u,
+			.statisticFlags = VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT
+				| VK_QUERY_PIPELINE_STATISTIC_COMPUTE_SHADER_INVOCATIONS_BIT,
+			.queueName = "Graphics"
+		}
+	};
+	ASSERT_EQ(profiler.GetStatisticCount(), 2u) << "Statistic count doesn't match.";
+
+	DeviceMemoryPool bufferPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = bufferSize,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkBuffer buffer = CreateTestBuffer(
+		logicalDevice, bufferSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+	);
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+	std::optional<MemoryAllocation> allocation = bufferPool.Allocate(logicalDevice, requirements);
+	ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+	vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+
+	BufferScaleCompute scaleCompute{ logicalDevice, buffer, "ProfilerStatistics" };
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.queueFamilyIndex = graphicsFamilyIndex
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence frameFence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &frameFence);
+
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
+
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+	profiler.BeginFrame(commandBuffer, 0u);
+
+	// Only the outer scope can have statistics, the nested one runs inside its query.
+	const std::uint32_t frameScope = profiler.BeginScope(commandBuffer, "Frame");
+	const std::uint32_t dispatchScope = profiler.BeginScope(commandBuffer, "Dispatch");
+
+	scaleCompute.RecordDispatch(commandBuffer, elementCount);
+
+	profiler.EndScope(commandBuffer, dispatchScope);
+	profiler.EndScope(commandBuffer, frameScope);
+	profiler.EndFrame(commandBuffer);
+
+	vkEndCommandBuffer(commandBuffer);
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &commandBuffer
+	};
+
+	vkQueueSubmit(featureDevice.GetQueue(graphicsFamilyIndex), 1u, &submitInfo, frameFence);
+	profiler.SetSubmitTime(ChromeTrace::Clock::now());
+
+	vkWaitForFences(logicalDevice, 1u, &frameFence, VK_TRUE, UINT64_MAX);
+	ASSERT_TRUE(profiler.CollectFrame(logicalDevice, 0u))
+		<< "The results weren't available after the fence.";
+
+	const std::vector<GpuScopeResult>& results = profiler.GetResults(0u);
+	ASSERT_EQ(std::size(results), 2u) << "Scope count doesn't match.";
+	ASSERT_EQ(std::size(results[0].statistics), 2u) << "Statistics count doesn't match.";
+
+	// In the order of the flag bits, vertex shader invocations come first.
+	EXPECT_EQ(results[0].statistics[0], 0u) << "Vertex shader invocations don't match.";
+	// The counts can be approximate, but never below the dispatched invocations.
+	EXPECT_GE(results[0].statistics[1], elementCount)
+		<< "Compute shader invocations don't match.";
+	EXPECT_TRUE(std::empty(results[1].statistics)) << "The nested scope has statistics.";
+
+	vkDestroyFence(logicalDevice, frameFence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+	vkDestroyBuffer(logicalDevice, buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkRenderGraphTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const std::uint32_t graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue);
+
+	constexpr VkDeviceSize bufferSize = 256'000u;
+	constexpr std::uint32_t fillValue = 0x2468u;
+	constexpr size_t transientCount = 3u;
+
+	// Fill the first buffer and copy it down a chain, the last buffer can reuse the first's
+	// memory.
+	std::vector<RenderGraphResourceHandle> handles;
+	std::vector<VkMemoryRequirements> transientRequirements;
+
+	for (size_t index = 0u; index < transientCount; ++index) {
+		VkBuffer buffer = CreateTestBuffer(
+			logicalDevice, bufferSize,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+		);
+		VkObjectInitCheck(FormatCompName("Transient", " VkBuffer ", index), buffer);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+		handles.emplace_back(RenderGraphResourceHandle{ .buffer = buffer });
+		transientRequirements.emplace_back(requirements);
+	}
+
+	VkBuffer readbackBuffer = CreateTestBuffer(
+		logicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT
+	);
+	handles.emplace_back(RenderGraphResourceHandle{ .buffer = readbackBuffer });
+
+	RenderGraph graph{};
+
+	std::vector<RenderGraphResourceId> transients;
+	for (size_t index = 0u; index < transientCount; ++index)
+		transients.emplace_back(graph.AddResource(
+			"Transient" + std::to_string(index),
+			RenderGraphResourceDesc{
+				.type = RenderGraphResourceType::Buffer,
+				.transient = true,
+				.size = transientRequirements[index].size,
+				.alignment = transientRequirements[index].alignment
+			}
+		));
+
+	const RenderGraphResourceId readback = graph.AddResource(
+		"Readback", RenderGraphResourceDesc{
+			.type = RenderGraphResourceType::Buffer, .transient = false, .size = 0u,
+			.alignment = 0u
+		}
+	);
+	graph.MarkOutput(readback);
+
+	const RenderGraphPassId fillPass = graph.AddPass("Fill", graphicsFamilyIndex);
+	graph.Write(
+		fillPass, transients[0], VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+	);
+
+	for (size_t index = 1u; index <= transientCount; ++index) {
+		const RenderGraphResourceId dst = index == transientCount ? readback : transients[index];
+
+		const RenderGraphPassId copyPass = graph.AddPass(
+			"Copy" + std::to_string(index), graphicsFamilyIndex
+		);
+		graph.Read(
+			copyPass, transients[index - 1u], VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_READ_BIT
+		);
+		graph.Write(copyPass, dst, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT);
+	}
+
+	const RenderGraphCompileResult result = graph.Compile();
+	ASSERT_EQ(std::size(result.passes), transientCount + 1u) << "A pass was culled.";
+	EXPECT_LT(result.transientMemorySize, result.unaliasedMemorySize) << "Nothing was aliased.";
+
+	VkMemoryRequirements rangeRequirements{
+		.size = result.transientMemorySize, .alignment = 1u, .memoryTypeBits = ~0u
+	};
+	for (const VkMemoryRequirements& requirements : transientRequirements) {
+		rangeRequirements.alignment = std::max(rangeRequirements.alignment, requirements.alignment);
+		rangeRequirements.memoryTypeBits &= requirements.memoryTypeBits;
+	}
+
+	DeviceMemoryPool transientPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = result.unaliasedMemorySize,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	std::optional<MemoryAllocation> transientMemory = transientPool.Allocate(
+		logicalDevice, rangeRequirements
+	);
+	ASSERT_TRUE(transientMemory) << "Failed to allocate the transient memory.";
+
+	for (const RenderGraphPlacement& placement : result.placements)
+		vkBindBufferMemory(
+			logicalDevice, handles[placement.resource].buffer, transientMemory->memory,
+			transientMemory->offset + placement.offset
+		);
+
+	DeviceMemoryPool readbackPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = bufferSize * 2u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	VkMemoryRequirements readbackRequirements{};
+	vkGetBufferMemoryRequirements(logicalDevice, readbackBuffer, &readbackRequirements);
+
+	std::optional<MemoryAllocation> readbackMemory = readbackPool.Allocate(
+		logicalDevice, readbackRequirements
+	);
+	ASSERT_TRUE(readbackMemory) << "Failed to allocate the readback memory.";
+	vkBindBufferMemory(
+		logicalDevice, readbackBuffer, readbackMemory->memory, readbackMemory->offset
+	);
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.queueFamilyIndex = graphicsFamilyIndex
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
+
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
+
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+	for (size_t position = 0u; position < std::size(result.passes); ++position) {
+		const RenderGraphCompiledPass& compiledPass = result.passes[position];
+
+		RecordBarriers(commandBuffer, compiledPass.acquireBarriers, handles);
+
+		if (position == 0u)
+			vkCmdFillBuffer(
+				commandBuffer, handles[transients[0]].buffer, 0u, bufferSize, fillValue
+			);
+		else {
+			const VkBufferCopy copyRegion{ .srcOffset = 0u, .dstOffset = 0u, .size = bufferSize };
+
+			vkCmdCopyBuffer(
+				commandBuffer, handles[position - 1u].buffer, handles[position].buffer, 1u,
+				&copyRegion
+			);
+		}
+
+		RecordBarriers(commandBuffer, compiledPass.releaseBarriers, handles);
+	}
+
+	// The graph only orders the passes, the last copy still has to be made visible to the
+	// host.
+	RecordHostReadBarrier(
+		commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT
+	);
+	vkEndCommandBuffer(commandBuffer);
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence fence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &fence);
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &commandBuffer
+	};
+
+	vkQueueSubmit(s_queFamilyMan.GetQueue(GraphicsQueue), 1u, &submitInfo, fence);
+	vkWaitForFences(logicalDevice, 1u, &fence, VK_TRUE, UINT64_MAX);
+
+	auto const* values = static_cast<std::uint32_t const*>(readbackMemory->cpuAddress);
+	for (size_t index = 0u; index < bufferSize / sizeof(std::uint32_t); ++index)
+		ASSERT_EQ(values[index], fillValue) << "Value " << index << " doesn't match.";
+
+	vkDestroyFence(logicalDevice, fence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+
+	for (const RenderGraphResourceHandle& handle : handles)
+		vkDestroyBuffer(logicalDevice, handle.buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VkResizableSwapchainTest) {
+#ifdef TERRA_WIN32
+	GTEST_SKIP() << "The window's surface already has Terra's swapchain.";
+#else
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const std::uint32_t graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue);
+
+	// A surface can only have one swapchain, so this one gets its own.
+	HeadlessSurface headlessSurface{ { Terra::vkInstance->GetVKInstance() } };
+	VkSurfaceKHR surface = headlessSurface.GetSurface();
+	VkObjectInitCheck("Resizable VkSurfaceKHR", surface);
+
+	VkBool32 presentSupport = VK_FALSE;
+	vkGetPhysicalDeviceSurfaceSupportKHR(
+		physicalDevice, graphicsFamilyIndex, surface, &presentSupport
+	);
+
+	if (!presentSupport)
+		GTEST_SKIP() << "The graphics queue can't present to the surface.";
+
+	std::uint32_t formatCount = 0u;
+	vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, nullptr);
+
+	std::vector<VkSurfaceFormatKHR> surfaceFormats(formatCount);
+	vkGetPhysicalDeviceSurfaceFormatsKHR(
+		physicalDevice, surface, &formatCount, std::data(surfaceFormats)
+	);
+	ASSERT_FALSE(std::empty(surfaceFormats)) << "The surface has no formats.";
+
+	ResizableSwapchain::Args swapchainArgs{
+		.physicalDevice = physicalDevice,
+		.surface = surface,
+		.presentQueue = s_queFamilyMan.GetQueue(GraphicsQueue),
+		.surfaceFormat = surfaceFormats.front(),
+		.width = SpecificValues::windowWidth,
+		.height = SpecificValues::windowHeight,
+		.imageCount = SpecificValues::bufferCount + 1u,
+		.presentModes = { VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR }
+	};
+
+	ResizableSwapchain swapchain{ logicalDevice, swapchainArgs };
+	VkObjectInitCheck("Resizable VkSwapchainKHR", swapchain.GetSwapchain());
+	EXPECT_GE(swapchain.GetImageCount(), 1u) << "The swapchain has no images.";
+	EXPECT_TRUE(swapchain.GetImageUsage() & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT)
+		<< "The images can't be color attachments.";
+
+	const std::vector<VkPresentModeKHR> supportedModes = ResizableSwapchain::QueryPresentModes(
+		physicalDevice, surface
+	);
+	EXPECT_EQ(
+		swapchain.GetPresentMode(), ChoosePresentMode(supportedModes, swapchainArgs.presentModes)
+	) << "Present mode doesn't match.";
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+		.queueFamilyIndex = graphicsFamilyIndex
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	struct FrameResources {
+		VkCommandBuffer commandBuffer;
+		VkFence fence;
+		VkSemaphore acquireSemaphore;
+		std::uint64_t frameNumber;
+	};
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkSemaphoreCreateInfo semaphoreInfo{ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+
+	std::vector<FrameResources> frames(SpecificValues::bufferCount);
+	for (FrameResources& frame : frames) {
+		VkCommandBufferAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+			.commandPool = commandPool,
+			.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			.commandBufferCount = 1u
+		};
+
+		vkAllocateCommandBuffers(logicalDevice, &allocInfo, &frame.commandBuffer);
+		vkCreateFence(logicalDevice, &fenceInfo, nullptr, &frame.fence);
+		vkCreateSemaphore(logicalDevice, &semaphoreInfo, nullptr, &frame.acquireSemaphore);
+		frame.frameNumber = 0u;
+	}
+
+	// One per image, as a present may still wait on it after the frame's fence.
+	std::vector<VkSemaphore> renderSemaphores;
+
+	DeferredDestructionQueue destructionQueue{ logicalDevice };
+
+	constexpr std::uint64_t frameCount = 12u;
+	constexpr std::uint64_t resizeFrame = 6u;
+	std::uint64_t completedFrame = 0u;
+
+	for (std::uint64_t frameNumber = 1u; frameNumber <= frameCount; ++frameNumber) {
+		FrameResources& frame = frames[frameNumber % std::size(frames)];
+
+		if (frame.frameNumber) {
+			vkWaitForFences(logicalDevice, 1u, &frame.fence, VK_TRUE, UINT64_MAX);
+			vkResetFences(logicalDevice, 1u, &frame.fence);
+
+			completedFrame = std::max(completedFrame, frame.frameNumber);
+		}
+
+		destructionQueue.Collect(logicalDevice, completedFrame);
+
+		if (frameNumber == resizeFrame) {
+			swapchainArgs.width /= 2u;
+			swapchainArgs.height /= 2u;
+			swapchainArgs.presentModes = { VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+
+			// The frame before is still in flight, nothing waits for it here.
+			ASSERT_TRUE(swapchain.Recreate(
+				logicalDevice, swapchainArgs, destructionQueue, frameNumber - 1u
+			)) << "Failed to recreate the swapchain.";
+
+			EXPECT_GT(destructionQueue.GetPendingCount(), 0u)
+				<< "The old swapchain wasn't retired.";
+
+			// A headless surface has no current extent, the requested one is clamped.
+			VkSurfaceCapabilitiesKHR capabilities{};
+			vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, &capabilities);
+
+			const VkExtent2D extent = swapchain.GetExtent();
+			EXPECT_EQ(
+				extent.width, std::clamp(
+					swapchainArgs.width, capabilities.minImageExtent.width,
+					capabilities.maxImageExtent.width
+				)
+			) << "Width doesn't match after the recreation.";
+			EXPECT_EQ(
+				extent.height, std::clamp(
+					swapchainArgs.height, capabilities.minImageExtent.height,
+					capabilities.maxImageExtent.height
+				)
+			) << "Height doesn't match after the recreation.";
+			EXPECT_EQ(
+				swapchain.GetPresentMode(),
+				ChoosePresentMode(supportedModes, swapchainArgs.presentModes)
+			) << "Present mode doesn't match after the recreation.";
+		}
+
+		while (std::size(renderSemaphores) < swapchain.GetImageCount()) {
+			VkSemaphore renderSemaphore = VK_NULL_HANDLE;
+			vkCreateSemaphore(logicalDevice, &semaphoreInfo, nullptr, &renderSemaphore);
+
+			renderSemaphores.emplace_back(renderSemaphore);
+		}
+
+		std::uint32_t imageIndex = 0u;
+		const VkResult acquireResult = swapchain.AcquireNextImage(
+			logicalDevice, frame.acquireSemaphore, imageIndex
+		);
+		ASSERT_TRUE(acquireResult == VK_SUCCESS || acquireResult == VK_SUBOPTIMAL_KHR)
+			<< "Failed to acquire an image.";
+
+		VkCommandBufferBeginInfo beginInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+		};
+
+		vkBeginCommandBuffer(frame.commandBuffer, &beginInfo);
+
+		VkImageMemoryBarrier presentBarrier{
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.srcAccessMask = 0u,
+			.dstAccessMask = 0u,
+			.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+			.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = swapchain.GetImage(imageIndex),
+			.subresourceRange = VkImageSubresourceRange{
+				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+				.baseMipLevel = 0u,
+				.levelCount = 1u,
+				.baseArrayLayer = 0u,
+				.layerCount = 1u
+			}
+		};
+
+		vkCmdPipelineBarrier(
+			frame.commandBuffer, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0u, 0u, nullptr, 0u, nullptr, 1u,
+			&presentBarrier
+		);
+
+		vkEndCommandBuffer(frame.commandBuffer);
+
+		const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+		VkSubmitInfo submitInfo{
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.waitSemaphoreCount = 1u,
+			.pWaitSemaphores = &frame.acquireSemaphore,
+			.pWaitDstStageMask = &waitStage,
+			.commandBufferCount = 1u,
+			.pCommandBuffers = &frame.commandBuffer,
+			.signalSemaphoreCount = 1u,
+			.pSignalSemaphores = &renderSemaphores[imageIndex]
+		};
+
+		vkQueueSubmit(s_queFamilyMan.GetQueue(GraphicsQueue), 1u, &submitInfo, frame.fence);
+		frame.frameNumber = frameNumber;
+
+		const VkResult presentResult = swapchain.Present(renderSemaphores[imageIndex], imageIndex);
+		EXPECT_TRUE(presentResult == VK_SUCCESS || presentResult == VK_SUBOPTIMAL_KHR)
+			<< "Failed to present frame " << frameNumber << ".";
+	}
+
+	for (const FrameResources& frame : frames)
+		vkWaitForFences(logicalDevice, 1u, &frame.fence, VK_TRUE, UINT64_MAX);
+
+	vkQueueWaitIdle(s_queFamilyMan.GetQueue(GraphicsQueue));
+
+	destructionQueue.Collect(logicalDevice, frameCount);
+	EXPECT_EQ(destructionQueue.GetPendingCount(), 0u) << "The old swapchain wasn't destroyed.";
+
+	const FramePacingSummary pacing = swapchain.GetPacingSummary();
+	EXPECT_EQ(pacing.presentCount, frameCount) << "Present count doesn't match.";
+	EXPECT_EQ(pacing.acquireWait.sampleCount, frameCount) << "Acquire count doesn't match.";
+	EXPECT_EQ(pacing.presentInterval.sampleCount, frameCount - 1u)
+		<< "Interval count doesn't match.";
+
+	for (VkSemaphore renderSemaphore : renderSemaphores)
+		vkDestroySemaphore(logicalDevice, renderSemaphore, nullptr);
+
+	for (const FrameResources& frame : frames) {
+		vkDestroySemaphore(logicalDevice, frame.acquireSemaphore, nullptr);
+		vkDestroyFence(logicalDevice, frame.fence, nullptr);
+	}
+
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+#endif
+}
+
+TEST_F(RendererVKTest, VkBufferDeviceAddressTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	if (!featureDevice.bufferDeviceAddress)
+		GTEST_SKIP() << "Buffer device addresses aren't supported.";
+
+	constexpr std::uint32_t elementCount = 4'096u;
+	constexpr std::uint32_t threadBlockSize = 64u;
+	constexpr std::uint32_t scale = 3u;
+	constexpr VkDeviceSize subBufferSize = sizeof(std::uint32_t) * elementCount;
+
+	// The layout of Header in BufferAddressTest.comp.
+	struct PointerHeader {
+		VkDeviceAddress values;
+		std::uint32_t elementCount;
+		std::uint32_t scale;
+	};
+
+	DeviceMemoryPool addressPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = subBufferSize * 4u,
+			.strategy = AllocatorStrategy::Linear,
+			.deviceAddress = true
+		}
+	};
+
+	DeviceAddressBufferView emptyView{ logicalDevice };
+	EXPECT_FALSE(emptyView.CreateResource(
+		logicalDevice, physicalDevice, subBufferSize, 0u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+	)) << "A buffer without splits shouldn't be created.";
+	EXPECT_FALSE(emptyView.BindResourceToMemory(logicalDevice, addressPool))
+		<< "A view without a buffer shouldn't be bound.";
+
+	// The input values, the header pointing at them and the results.
+	DeviceAddressBufferView addressView{ logicalDevice };
+	ASSERT_TRUE(addressView.CreateResource(
+		logicalDevice, physicalDevice, subBufferSize, 3u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+	)) << "Failed to create the buffer.";
+	VkObjectInitCheck("DeviceAddress VkBuffer", addressView.GetResource());
+
+	ASSERT_TRUE(addressView.BindResourceToMemory(logicalDevice, addressPool))
+		<< "Failed to allocate the buffer memory.";
+
+	const VkBuffer buffer = addressView.GetResource();
+	EXPECT_FALSE(addressView.CreateResource(
+		logicalDevice, physicalDevice, subBufferSize, 3u, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
+	)) << "A second buffer shouldn't be created.";
+	EXPECT_FALSE(addressView.BindResourceToMemory(logicalDevice, addressPool))
+		<< "A bound buffer shouldn't be bound again.";
+	EXPECT_EQ(addressView.GetResource(), buffer) << "The buffer was replaced.";
+	EXPECT_TRUE(std::empty(addressView.GetDeviceAddressSplit(4u)))
+		<< "Got addresses past the sub allocations.";
+
+	const std::vector<VkDeviceAddress> addresses = addressView.GetDeviceAddressSplit(3u);
+	ASSERT_EQ(std::size(addresses), 3u) << "Address count doesn't match.";
+	ASSERT_NE(addresses[0], 0u) << "The buffer has no device address.";
+
+	for (std::uint32_t index = 1u; index < std::size(addresses); ++index)
+		EXPECT_EQ(addresses[index] - addresses[0], addressView.GetSubAllocationOffset(index))
+			<< "Split " << index << " doesn't start at its sub allocation offset.";
+
+	auto* values = static_cast<std::uint32_t*>(addressView.GetCPUAddress(0u));
+	for (std::uint32_t index = 0u; index < elementCount; ++index)
+		values[index] = index;
+
+	const PointerHeader header{
+		.values = addresses[0], .elementCount = elementCount, .scale = scale
+	};
+	std::memcpy(addressView.GetCPUAddress(1u), &header, sizeof(header));
+	std::memset(addressView.GetCPUAddress(2u), 0, subBufferSize);
+
+	// Only the two pointers, there are no descriptor sets.
+	const std::array pushConstants{ addresses[1], addresses[2] };
+
+	VkPushConstantRange pushConstantRange{
+		.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+		.offset = 0u,
+		.size = static_cast<std::uint32_t>(sizeof(pushConstants))
+	};
+
+	VkPipelineLayoutCreateInfo pipelineLayoutInfo{
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pushConstantRangeCount = 1u,
+		.pPushConstantRanges = &pushConstantRange
+	};
+
+	VkPipelineLayout pipelineLayout = VK_NULL_HANDLE;
+	vkCreatePipelineLayout(logicalDevice, &pipelineLayoutInfo, nullptr, &pipelineLayout);
+	VkObjectInitCheck("DeviceAddressPipelineLayout", pipelineLayout);
+
+	SpirvShader computeShader{ logicalDevice };
+	computeShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"BufferAddressTest.spv")
+	);
+
+	VkPipelineObject computePSO{ logicalDevice };
+	computePSO.CreateComputePipeline(
+		logicalDevice, pipelineLayout, computeShader.GetShaderModule()
+	);
+
+	VkPipeline computePipeline = computePSO.GetPipeline();
+	VkObjectInitCheck("DeviceAddressPipeline", computePipeline);
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.queueFamilyIndex = s_queFamilyMan.GetIndex(ComputeQueue)
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
+
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
+
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, computePipeline);
+	vkCmdPushConstants(
+		commandBuffer, pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0u,
+		static_cast<std::uint32_t>(sizeof(pushConstants)), std::data(pushConstants)
+	);
+	vkCmdDispatch(
+		commandBuffer, (elementCount + threadBlockSize - 1u) / threadBlockSize, 1u, 1u
+	);
+
+	VkBufferMemoryBarrier readbackBarrier{
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.buffer = addressView.GetResource(),
+		.offset = addressView.GetSubAllocationOffset(2u),
+		.size = subBufferSize
+	};
+
+	vkCmdPipelineBarrier(
+		commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0u,
+		0u, nullptr, 1u, &readbackBarrier, 0u, nullptr
+	);
+	vkEndCommandBuffer(commandBuffer);
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence fence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &fence);
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &commandBuffer
+	};
+
+	vkQueueSubmit(
+		featureDevice.GetQueue(s_queFamilyMan.GetIndex(ComputeQueue)), 1u, &submitInfo, fence
+	);
+	vkWaitForFences(logicalDevice, 1u, &fence, VK_TRUE, UINT64_MAX);
+
+	auto const* results = static_cast<std::uint32_t const*>(addressView.GetCPUAddress(2u));
+	for (std::uint32_t index = 0u; index < elementCount; ++index)
+		ASSERT_EQ(results[index], index * scale + 1u) << "Value " << index << " doesn't match.";
+
+	vkDestroyFence(logicalDevice, fence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+	vkDestroyPipelineLayout(logicalDevice, pipelineLayout, nullptr);
+}
+
+TEST_F(RendererVKTest, ResourceViewMemoryAndDescriptorTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	s_testResourceView->BindResourceToMemory(logicalDevice);
+
+	DescriptorInfo inputDescInfo{
+		.bindingSlot = 0u,
+		.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+	};
+
+	auto inputBufferInfos = s_testResourceView->GetDescBufferInfoSplit(
+		SpecificValues::bufferCount
+	);
+
+	Terra::graphicsDescriptorSet->AddBuffersSplit(
+		inputDescInfo, std::move(inputBufferInfos), VK_SHADER_STAGE_ALL
+	);
+}
+
+TEST_F(RendererVKTest, DescriptorCreationTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	Terra::graphicsDescriptorSet->CreateDescriptorSets(logicalDevice);
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+	const char* name = "graphics";
+
+	VkDescriptorSetLayout const* descLayout = descManager->GetDescriptorSetLayouts();
+	size_t descriptorSetCount = descManager->GetDescriptorSetCount();
+	EXPECT_EQ(descriptorSetCount, SpecificValues::bufferCount)
+		<< "DescCount doesn't match.";
+
+	for (size_t index = 0u; index < SpecificValues::bufferCount; ++index) {
+		VkObjectInitCheck(
+			FormatCompName(name, " VkDescriptorSetLayout ", index), descLayout[index]
+		);
+
+		VkDescriptorSet descSet = descManager->GetDescriptorSet(index);
+		VkObjectInitCheck(FormatCompName(name, " VkDescriptorSet ", index), descSet);
+	}
+}
+
+// A single color attachment which is cleared and kept in the attachment layout. Terra's
+// VKRenderPass ends in the present layout, which needs VK_KHR_swapchain on the device.
+[[nodiscard]]
+static VkRenderPass CreateTestRenderPass(VkDevice logicalDevice, VkFormat colorFormat) {
+	VkAttachmentDescription colorAttachment{
+		.format = colorFormat,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+		.storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+		.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+		.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+		.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	};
+
+	VkAttachmentReference colorReference{
+		.attachment = 0u,
+		.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	};
+
+	VkSubpassDescription subpass{
+		.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+		.colorAttachmentCount = 1u,
+		.pColorAttachments = &colorReference
+	};
+
+	VkRenderPassCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+		.attachmentCount = 1u,
+		.pAttachments = &colorAttachment,
+		.subpassCount = 1u,
+		.pSubpasses = &subpass
+	};
+
+	VkRenderPass renderPass = VK_NULL_HANDLE;
+	vkCreateRenderPass(logicalDevice, &createInfo, nullptr, &renderPass);
+
+	return renderPass;
+}
+
+TEST_F(RendererVKTest, VkGpuCullingTest) {
+	const FeatureDevice& featureDevice = GetFeatureDevice();
+	VkDevice logicalDevice = featureDevice.device;
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+	const std::uint32_t graphicsFamilyIndex = s_queFamilyMan.GetIndex(GraphicsQueue);
+
+	if (logicalDevice == VK_NULL_HANDLE)
+		GTEST_SKIP() << "The feature device couldn't be created.";
+
+	constexpr std::uint32_t objectCount = 4'096u;
+	constexpr VkDeviceSize objectsSize = sizeof(CullObject) * objectCount;
+	constexpr VkDeviceSize commandsSize = sizeof(VkDrawIndexedIndirectCommand) * objectCount;
+	// Every command's indices and vertices are zero, the last object's first index plus the
+	// largest index count and the last vertex offset bound the buffers.
+	constexpr VkDeviceSize indicesSize = sizeof(std::uint32_t) * (objectCount * 3u + 21u);
+	constexpr VkDeviceSize verticesSize = sizeof(float) * 3u * objectCount;
+	constexpr VkExtent2D targetExtent{ .width = 64u, .height = 64u };
+	constexpr VkFormat targetFormat = VK_FORMAT_R8G8B8A8_UNORM;
+
+	DeviceMemoryPool readbackPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+				| VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+			.blockSize = (objectsSize + commandsSize) * 2u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	DeviceMemoryPool drawPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = (indicesSize + verticesSize) * 2u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	// Images get a pool of their own, so they never share a granularity page with buffers.
+	DeviceMemoryPool targetPool{
+		logicalDevice,
+		DeviceMemoryPool::Args{
+			.physicalDevice = physicalDevice,
+			.propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+			.blockSize = 1'048'576u,
+			.strategy = AllocatorStrategy::Linear
+		}
+	};
+
+	const std::array<VkBuffer, 3u> buffers{
+		CreateTestBuffer(logicalDevice, objectsSize, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT),
+		CreateTestBuffer(
+			logicalDevice, commandsSize,
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+		),
+		CreateTestBuffer(
+			logicalDevice, sizeof(std::uint32_t),
+			VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+				| VK_BUFFER_USAGE_TRANSFER_DST_BIT
+		)
+	};
+
+	std::array<void*, 3u> cpuAddresses{};
+	for (size_t index = 0u; index < std::size(buffers); ++index) {
+		VkObjectInitCheck(FormatCompName("Culling", " VkBuffer ", index), buffers[index]);
+
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffers[index], &requirements);
+
+		std::optional<MemoryAllocation> allocation = readbackPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+		vkBindBufferMemory(
+			logicalDevice, buffers[index], allocation->memory, allocation->offset
+		);
+
+		cpuAddresses[index] = allocation->cpuAddress;
+	}
+
+	const std::array<VkBuffer, 2u> drawBuffers{
+		CreateTestBuffer(
+			logicalDevice, indicesSize,
+			VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+		),
+		CreateTestBuffer(
+			logicalDevice, verticesSize,
+			VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT
+		)
+	};
+	const auto [indexBuffer, vertexBuffer] = drawBuffers;
+
+	for (VkBuffer buffer : drawBuffers) {
+		VkMemoryRequirements requirements{};
+		vkGetBufferMemoryRequirements(logicalDevice, buffer, &requirements);
+
+		std::optional<MemoryAllocation> allocation = drawPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the buffer memory.";
+		vkBindBufferMemory(logicalDevice, buffer, allocation->memory, allocation->offset);
+	}
+
+	VkImage targetImage = CreateTestImage(
+		logicalDevice, targetFormat, targetExtent, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+	);
+	VkObjectInitCheck("Culling VkImage", targetImage);
+
+	{
+		VkMemoryRequirements requirements{};
+		vkGetImageMemoryRequirements(logicalDevice, targetImage, &requirements);
+
+		std::optional<MemoryAllocation> allocation = targetPool.Allocate(
+			logicalDevice, requirements
+		);
+		ASSERT_TRUE(allocation) << "Failed to allocate the image memory.";
+		vkBindImageMemory(logicalDevice, targetImage, allocation->memory, allocation->offset);
+	}
+
+	VkImageView targetView = CreateTestImageView(
+		logicalDevice, targetImage, targetFormat, VK_IMAGE_ASPECT_COLOR_BIT
+	);
+	VkRenderPass renderPass = CreateTestRenderPass(logicalDevice, targetFormat);
+	VkObjectInitCheck("Culling VkRenderPass", renderPass);
+
+	VkFramebufferCreateInfo framebufferInfo{
+		.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+		.renderPass = renderPass,
+		.attachmentCount = 1u,
+		.pAttachments = &targetView,
+		.width = targetExtent.width,
+		.height = targetExtent.height,
+		.layers = 1u
+	};
+
+	VkFramebuffer framebuffer = VK_NULL_HANDLE;
+	vkCreateFramebuffer(logicalDevice, &framebufferInfo, nullptr, &framebuffer);
+	VkObjectInitCheck("Culling VkFramebuffer", framebuffer);
+
+	// Spread around the clip space box, so roughly a third of them survive.
+	auto* objects = static_cast<CullObject*>(cpuAddresses[0]);
+	for (std::uint32_t index = 0u; index < objectCount; ++index) {
+		const float position = static_cast<float>(index % 64u) / 16.f - 2.f;
+		const float depth = static_cast<float>(index / 64u) / 32.f - 0.5f;
+
+		objects[index] = CullObject{
+			.sphere = { position, -position * 0.5f, depth, 0.1f },
+			.indexCount = 3u * (index % 7u + 1u),
+			.firstIndex = index * 3u,
+			.vertexOffset = static_cast<std::int32_t>(index),
+			.taskGroupCount = index % 5u + 1u
+		};
+	}
+
+	const FrustumPlanes planes = ExtractFrustumPlanes({
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		0.f, 0.f, 0.f, 1.f
+	});
+	const std::vector<std::uint32_t> expectedObjects = CullObjects(
+		planes, std::span<const CullObject>{ objects, objectCount }
+	);
+
+	// The bounds, commands and count go through a DescriptorSetManager like any other compute
+	// resources. It is a manager of its own, so Terra's global compute set stays as the other
+	// tests expect.
+	ObjectManager descriptorObjects;
+	std::unique_ptr<DescriptorSetManager> descManager;
+	descriptorObjects.CreateObject(descManager, { logicalDevice, 1u }, 0u);
+
+	for (std::uint32_t binding = 0u; binding < std::size(buffers); ++binding)
+		descManager->AddBuffersSplit(
+			DescriptorInfo{ .bindingSlot = binding, .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER },
+			std::vector<VkDescriptorBufferInfo>{
+				VkDescriptorBufferInfo{
+					.buffer = buffers[binding], .offset = 0u, .range = VK_WHOLE_SIZE
+				}
+			},
+			VK_SHADER_STAGE_COMPUTE_BIT
+		);
+
+	descManager->CreateDescriptorSets(logicalDevice);
+	VkDescriptorSet descriptorSet = descManager->GetDescriptorSet(0u);
+	VkObjectInitCheck("CullingDescriptorSet", descriptorSet);
+
+	SpirvShader cullShader{ logicalDevice };
+	cullShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FrustumCullTest.spv")
+	);
+
+	// The draws only need the vertex shader's position input.
+	VkPipelineLayoutCreateInfo drawLayoutInfo{
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO
+	};
+
+	VkPipelineLayout drawLayout = VK_NULL_HANDLE;
+	vkCreatePipelineLayout(logicalDevice, &drawLayoutInfo, nullptr, &drawLayout);
+
+	SpirvShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	SpirvShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VkPipelineObject drawPSO{ logicalDevice };
+	drawPSO.CreateGraphicsPipelineVS(
+		logicalDevice, drawLayout, renderPass,
+		VertexLayout()
+		.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+		.InitLayout(), vertexShader.GetShaderModule(), fragmentShader.GetShaderModule()
+	);
+
+	VkPipeline drawPipeline = drawPSO.GetPipeline();
+	VkObjectInitCheck("CullingDrawPipeline", drawPipeline);
+
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+		.queueFamilyIndex = graphicsFamilyIndex
+	};
+
+	VkCommandPool commandPool = VK_NULL_HANDLE;
+	vkCreateCommandPool(logicalDevice, &poolInfo, nullptr, &commandPool);
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(logicalDevice, &allocInfo, &commandBuffer);
+
+	VkFenceCreateInfo fenceInfo{ .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+	VkFence cullFence = VK_NULL_HANDLE;
+	vkCreateFence(logicalDevice, &fenceInfo, nullptr, &cullFence);
+
+	auto const* commands = static_cast<std::uint32_t const*>(cpuAddresses[1]);
+	auto const* drawCount = static_cast<std::uint32_t const*>(cpuAddresses[2]);
+
+	for (GpuCullingPass::Output output :
+		{ GpuCullingPass::Output::IndexedDraws, GpuCullingPass::Output::TaskDispatches }) {
+		GpuCullingPass cullingPass{
+			logicalDevice,
+			GpuCullingPass::Args{
+				.setLayout = descManager->GetDescriptorSetLayouts()[0],
+				.cullShader = cullShader.GetShaderModule(),
+				.output = output,
+				.drawFeaturesEnabled = featureDevice.drawIndirectCount
+			}
+		};
+		VkObjectInitCheck("CullingPipeline", cullingPass.GetPipeline());
+
+		// The feature device doesn't enable VK_EXT_mesh_shader, so the task dispatches can be
+		// culled there but not drawn.
+		const bool drawn = output == GpuCullingPass::Output::IndexedDraws
+			&& featureDevice.drawIndirectCount;
+		EXPECT_EQ(cullingPass.CanRecordDraws(), drawn) << "The draw requirements don't match.";
+
+		VkCommandBufferBeginInfo beginInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+		};
+
+		vkBeginCommandBuffer(commandBuffer, &beginInfo);
+
+		if (drawn) {
+			for (VkBuffer buffer : drawBuffers)
+				vkCmdFillBuffer(commandBuffer, buffer, 0u, VK_WHOLE_SIZE, 0u);
+
+			VkMemoryBarrier fillBarrier{
+				.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+				.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+				.dstAccessMask = VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT
+			};
+
+			vkCmdPipelineBarrier(
+				commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0u, 1u, &fillBarrier, 0u, nullptr,
+				0u, nullptr
+			);
+		}
+
+		cullingPass.RecordCull(commandBuffer, descriptorSet, planes, objectCount, buffers[2]);
+
+		if (drawn) {
+			VkClearValue clearValue{};
+
+			VkRenderPassBeginInfo renderPassInfo{
+				.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+				.renderPass = renderPass,
+				.framebuffer = framebuffer,
+				.renderArea = VkRect2D{ .offset = VkOffset2D{}, .extent = targetExtent },
+				.clearValueCount = 1u,
+				.pClearValues = &clearValue
+			};
+
+			VkViewport viewport{
+				.width = static_cast<float>(targetExtent.width),
+				.height = static_cast<float>(targetExtent.height),
+				.maxDepth = 1.f
+			};
+			VkRect2D scissor{ .offset = VkOffset2D{}, .extent = targetExtent };
+			const VkDeviceSize vertexOffset = 0u;
+
+			vkCmdBeginRenderPass(commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+			vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, drawPipeline);
+			vkCmdSetViewport(commandBuffer, 0u, 1u, &viewport);
+			vkCmdSetScissor(commandBuffer, 0u, 1u, &scissor);
+			vkCmdBindVertexBuffers(commandBuffer, 0u, 1u, &vertexBuffer, &vertexOffset);
+			vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0u, VK_INDEX_TYPE_UINT32);
+
+			EXPECT_TRUE(cullingPass.RecordDraws(commandBuffer, buffers[1], buffers[2], objectCount))
+				<< "The draws weren't recorded.";
+
+			vkCmdEndRenderPass(commandBuffer);
+		}
+		else
+			// Nothing is recorded, so it doesn't need a render pass.
+			EXPECT_FALSE(
+				cullingPass.RecordDraws(commandBuffer, buffers[1], buffers[2], objectCount)
+			) << "The missing draw requirements weren't reported.";
+
+		RecordHostReadBarrier(
+			commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT
+		);
+		vkEndCommandBuffer(commandBuffer);
+
+		VkSubmitInfo submitInfo{
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.commandBufferCount = 1u,
+			.pCommandBuffers = &commandBuffer
+		};
+
+		vkQueueSubmit(featureDevice.GetQueue(graphicsFamilyIndex), 1u, &submitInfo, cullFence);
+		vkWaitForFences(logicalDevice, 1u, &cullFence, VK_TRUE, UINT64_MAX);
+		vkResetFences(logicalDevice, 1u, &cullFence);
+
+		ASSERT_EQ(*drawCount, std::size(expectedObjects)) << "Draw count doesn't match.";
+
+		// The commands are compacted in whatever order the invocations got their slots.
+		const std::uint32_t stride = GpuCullingPass::GetCommandStride(output)
+			/ sizeof(std::uint32_t);
+		std::uint32_t taskGroupCount = 0u;
+		std::vector<std::uint32_t> visibleObjects;
+
+		for (std::uint32_t slot = 0u; slot < *drawCount; ++slot) {
+			std::uint32_t const* command = commands + slot * stride;
+
+			if (output == GpuCullingPass::Output::IndexedDraws) {
+				const std::uint32_t objectIndex = command[4];
+				ASSERT_LT(objectIndex, objectCount) << "Object index out of range.";
+				EXPECT_TRUE(std::ranges::binary_search(expectedObjects, objectIndex))
+					<< "Object " << objectIndex << " should have been culled.";
+
+				EXPECT_EQ(command[0], objects[objectIndex].indexCount)
+					<< "Index count doesn't match.";
+				EXPECT_EQ(command[1], 1u) << "Instance count doesn't match.";
+				EXPECT_EQ(command[2], objects[objectIndex].firstIndex)
+					<< "First index doesn't match.";
+
+				visibleObjects.emplace_back(objectIndex);
+			}
+			else {
+				taskGroupCount += command[0];
+				EXPECT_EQ(command[1], 1u) << "Task group y doesn't match.";
+				EXPECT_EQ(command[2], 1u) << "Task group z doesn't match.";
+			}
+		}
+
+		if (output == GpuCullingPass::Output::IndexedDraws) {
+			// The count matching doesn't catch an object written to two slots.
+			std::ranges::sort(visibleObjects);
+			EXPECT_EQ(
+				std::ranges::adjacent_find(visibleObjects), std::end(visibleObjects)
+			) << "An object got more than one command.";
+			EXPECT_EQ(visibleObjects, expectedObjects) << "Visible objects don't match.";
+		}
+		else {
+			std::uint32_t expectedTaskGroupCount = 0u;
+			for (std::uint32_t objectIndex : expectedObjects)
+				expectedTaskGroupCount += objects[objectIndex].taskGroupCount;
+
+			EXPECT_EQ(taskGroupCount, expectedTaskGroupCount) << "Task group count doesn't match.";
+		}
+	}
+
+	vkDestroyFence(logicalDevice, cullFence, nullptr);
+	vkDestroyCommandPool(logicalDevice, commandPool, nullptr);
+	vkDestroyPipelineLayout(logicalDevice, drawLayout, nullptr);
+	vkDestroyFramebuffer(logicalDevice, framebuffer, nullptr);
+	vkDestroyRenderPass(logicalDevice, renderPass, nullptr);
+	vkDestroyImageView(logicalDevice, targetView, nullptr);
+	vkDestroyImage(logicalDevice, targetImage, nullptr);
+	descriptorObjects.StartCleanUp();
+
+	for (VkBuffer buffer : buffers)
+		vkDestroyBuffer(logicalDevice, buffer, nullptr);
+
+	for (VkBuffer buffer : drawBuffers)
+		vkDestroyBuffer(logicalDevice, buffer, nullptr);
+}
+
+TEST_F(RendererVKTest, VertexManagerInitTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	std::vector<Vertex> verticesTest;
+	verticesTest.emplace_back();
+	verticesTest.emplace_back();
+	verticesTest.emplace_back();
+
+	std::vector<std::uint32_t> indicesTest;
+	indicesTest.emplace_back();
+	indicesTest.emplace_back();
+	indicesTest.emplace_back();
+
+	std::vector<Vertex> verticesCopy = verticesTest;
+	std::vector<std::uint32_t> indicesCopy = indicesTest;
+
+	VertexManagerVertexShader vertexManagerVS{ logicalDevice };
+	vertexManagerVS.AddGVerticesAndIndices(
+		logicalDevice, std::move(verticesTest), std::move(indicesTest)
+	);
+
+	std::vector<std::uint32_t> primIndices = indicesCopy;
+
+	VertexManagerMeshShader vertexManagerMS{
+		logicalDevice, SpecificValues::bufferCount,
+		s_queFamilyMan.GetTransferAndGraphicsIndices()
+	};
+	vertexManagerMS.AddGVerticesAndPrimIndices(
+		logicalDevice, std::move(verticesCopy), std::move(indicesCopy), std::move(primIndices)
+	);
+}
+
+TEST_F(RendererVKTest, VertexManagerOptimizedMeshTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	const std::vector<Vertex> vertices(6u);
+	const std::vector<std::uint32_t> indices{ 0u, 1u, 2u, 3u, 4u, 5u };
+
+	OptimizedMesh<Vertex> mesh = OptimizeMesh(std::span<const Vertex>{ vertices }, indices);
+	EXPECT_EQ(std::size(mesh.vertices), 1u) << "Duplicate vertices weren't removed.";
+	EXPECT_EQ(std::size(mesh.indices16), std::size(indices)) << "16 bit indices weren't produced.";
+
+	VertexManagerVertexShader vertexManagerVS{ logicalDevice };
+	vertexManagerVS.AddGVerticesAndIndices(
+		logicalDevice, std::move(mesh.vertices), std::move(mesh.indices)
+	);
+}
+
+TEST_F(RendererVKTest, VertexManagerMeshletTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	const std::vector<MeshletFloat3> positions{
+		{ 0.f, 0.f, 0.f }, { 1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 1.f, 1.f, 0.f }
+	};
+	const std::vector<std::uint32_t> indices{ 0u, 1u, 2u, 1u, 3u, 2u };
+
+	MeshletData meshletData = BuildMeshlets(indices, positions);
+	ASSERT_EQ(std::size(meshletData.meshlets), 1u) << "A quad should fit in one meshlet.";
+
+	std::vector<Vertex> vertices(std::size(positions));
+
+	VertexManagerMeshShader vertexManagerMS{
+		logicalDevice, SpecificValues::bufferCount,
+		s_queFamilyMan.GetTransferAndGraphicsIndices()
+	};
+	vertexManagerMS.AddGVerticesAndPrimIndices(
+		logicalDevice, std::move(vertices), std::move(meshletData.vertexIndices),
+		std::move(meshletData.primitiveIndices)
+	);
+}
+
+TEST_F(RendererVKTest, VkPipelineLayoutTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+	VkObjectInitCheck("VkPipelineLayout", pipeLayout);
+}
+
+TEST_F(RendererVKTest, VkShaderInitTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	VkShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	VkShaderModule shaderModule = vertexShader.GetShaderModule();
+	VkObjectInitCheck("VkShaderModule", shaderModule);
+}
+
+TEST_F(RendererVKTest, VkEmbeddedShaderInitTest) {
+#ifdef TERRA_TEST_EMBEDDED_SHADERS
+	static_assert(
+		EmbeddedShaders::VertexShaderTest[0] == 0x07230203u,
+		"The embedded shader doesn't start with the SPIR-V magic number."
+	);
+
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	SpirvShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(logicalDevice, EmbeddedShaders::VertexShaderTest);
+
+	VkShaderModule shaderModule = vertexShader.GetShaderModule();
+	VkObjectInitCheck("VkShaderModule", shaderModule);
+#else
+	GTEST_SKIP() << "The shaders aren't embedded, configure with EMBED_SHADERS.";
+#endif
+}
+
+TEST_F(RendererVKTest, VkShaderLibraryTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	ShaderLibrary shaderLibrary{};
+
+	const std::wstring fragmentPath =
+		SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv");
+
+	ShaderLibrary::SharedShader fragmentShader = shaderLibrary.GetShader(
+		logicalDevice, fragmentPath
+	);
+	ObjectInitCheck("fragmentShader", fragmentShader);
+	VkObjectInitCheck("VkShaderModule", fragmentShader->GetShaderModule());
+
+	ShaderLibrary::SharedShader vertexShader = shaderLibrary.GetShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+	EXPECT_NE(
+		fragmentShader->GetShaderModule(), vertexShader->GetShaderModule()
+	) << "Different shaders share a module.";
+
+	ShaderLibrary::SharedShader fragmentShaderAgain = shaderLibrary.GetShader(
+		logicalDevice, fragmentPath
+	);
+	EXPECT_EQ(fragmentShader, fragmentShaderAgain) << "The same file created a new module.";
+
+	EXPECT_EQ(shaderLibrary.GetMissCount(), 2u) << "Miss count doesn't match.";
+	EXPECT_EQ(shaderLibrary.GetHitCount(), 1u) << "Hit count doesn't match.";
+
+	EXPECT_EQ(
+		shaderLibrary.GetShader(
+			logicalDevice, SpecificValues::shaderPath + std::wstring(L"MissingShader.spv")
+		), nullptr
+	) << "A missing file returned a shader.";
+	EXPECT_EQ(shaderLibrary.GetMissCount(), 2u) << "A missing file was counted as a miss.";
+
+	ThreadPool threadPool{ 4u };
+
+	std::vector<std::future<ShaderLibrary::SharedShader>> lookups;
+	for (size_t index = 0u; index < 16u; ++index)
+		lookups.emplace_back(threadPool.Submit([&shaderLibrary, logicalDevice, &fragmentPath] {
+			return shaderLibrary.GetShader(logicalDevice, fragmentPath);
+		}));
+
+	for (auto& lookup : lookups)
+		EXPECT_EQ(lookup.get(), fragmentShader) << "A concurrent lookup created a new module.";
+
+	EXPECT_EQ(shaderLibrary.GetMissCount(), 2u) << "Concurrent lookups missed.";
+	EXPECT_EQ(shaderLibrary.GetHitCount(), 17u) << "Concurrent hit count doesn't match.";
+	EXPECT_EQ(shaderLibrary.GetShaderCount(), 2u) << "Shader count doesn't match.";
+
+	vertexShader.reset();
+	EXPECT_EQ(shaderLibrary.GetShaderCount(), 1u) << "The unused module wasn't released.";
+}
+
+TEST_F(RendererVKTest, VkComputePSOTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	VkShader computeShader{ logicalDevice };
+	computeShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"ComputeShaderTest.spv")
+	);
+
+	VkShaderModule shaderModule = computeShader.GetShaderModule();
+
+	VkPipelineObject computePSO{ logicalDevice };
+	computePSO.CreateComputePipeline(logicalDevice, pipeLayout, shaderModule);
+
+	VkPipeline computePipeline = computePSO.GetPipeline();
+	VkObjectInitCheck("VkComputePipeline", computePipeline);
+}
+
+// VkPipelineObject doesn't take a cache, so the pipeline is created directly.
+[[nodiscard]]
+static std::chrono::microseconds TimeComputePipelineCreation(
+	VkDevice logicalDevice, VkPipelineLayout pipeLayout, VkShaderModule shaderModule,
+	VkPipelineCache pipelineCache
+) {
+	VkComputePipelineCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		.stage = VkPipelineShaderStageCreateInfo{
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+			.module = shaderModule,
+			.pName = "main"
+		},
+		.layout = pipeLayout
+	};
+
+	VkPipeline computePipeline = VK_NULL_HANDLE;
+
+	const auto startTime = std::chrono::steady_clock::now();
+	vkCreateComputePipelines(
+		logicalDevice, pipelineCache, 1u, &createInfo, nullptr, &computePipeline
+	);
+	const auto endTime = std::chrono::steady_clock::now();
+
+	VkObjectInitCheck("VkComputePipeline", computePipeline);
+	vkDestroyPipeline(logicalDevice, computePipeline, nullptr);
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+}
+
+TEST_F(RendererVKTest, VkPipelineCacheTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+	VkPhysicalDevice physicalDevice = Terra::device->GetPhysicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	SpirvShader computeShader{ logicalDevice };
+	computeShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"ComputeShaderTest.spv")
+	);
+
+	VkShaderModule shaderModule = computeShader.GetShaderModule();
+
+	const std::filesystem::path cacheDirectory = SpecificValues::pipelineCachePath;
+
+	// A single creation is too noisy to compare, so the fastest of a few is taken on both
+	// sides. Every cold creation starts from an empty directory.
+	constexpr size_t repetitionCount = 5u;
+
+	std::chrono::microseconds coldTime = std::chrono::microseconds::max();
+	size_t savedDataSize = 0u;
+
+	for (size_t repetition = 0u; repetition < repetitionCount; ++repetition) {
+		std::filesystem::remove_all(cacheDirectory);
+
+		PipelineCache coldCache{ logicalDevice };
+		coldCache.CreateCache(logicalDevice, physicalDevice, cacheDirectory);
+		VkObjectInitCheck("VkPipelineCache", coldCache.GetCache());
+		EXPECT_FALSE(coldCache.IsWarm()) << "The cache was loaded from an empty directory.";
+
+		coldTime = std::min(
+			coldTime, TimeComputePipelineCreation(
+				logicalDevice, pipeLayout, shaderModule, coldCache.GetCache()
+			)
+		);
+
+		if (repetition + 1u == repetitionCount) {
+			EXPECT_TRUE(coldCache.SaveCache(logicalDevice)) << "Failed to save the cache.";
+			EXPECT_TRUE(std::filesystem::exists(coldCache.GetFilePath()))
+				<< "The cache file doesn't exist.";
+
+			savedDataSize = coldCache.GetDataSize(logicalDevice);
+		}
+	}
+
+	std::chrono::microseconds warmTime = std::chrono::microseconds::max();
+
+	for (size_t repetition = 0u; repetition < repetitionCount; ++repetition) {
+		PipelineCache warmCache{ logicalDevice };
+		warmCache.CreateCache(logicalDevice, physicalDevice, cacheDirectory);
+		VkObjectInitCheck("VkPipelineCache", warmCache.GetCache());
+		ASSERT_TRUE(warmCache.IsWarm()) << "The saved cache wasn't loaded.";
+
+		// The loaded data has to be there before anything is created with it.
+		EXPECT_GE(warmCache.GetDataSize(logicalDevice), savedDataSize)
+			<< "The warm cache doesn't hold the saved data.";
+
+		warmTime = std::min(
+			warmTime, TimeComputePipelineCreation(
+				logicalDevice, pipeLayout, shaderModule, warmCache.GetCache()
+			)
+		);
+	}
+
+	RecordProperty("ColdPipelineMicroseconds", static_cast<int>(coldTime.count()));
+	RecordProperty("WarmPipelineMicroseconds", static_cast<int>(warmTime.count()));
+
+	// The driver may keep a cache of its own, which makes the cold runs warm as well, so
+	// only a regression is checked for. The slack covers timer noise on tiny pipelines.
+	EXPECT_LE(warmTime, coldTime * 3 / 2 + std::chrono::microseconds{ 500 })
+		<< "Creating with the warm cache was slower than without it.";
+}
+
+TEST_F(RendererVKTest, VkRenderPassInitTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+	VkObjectInitCheck("VkRenderPass", vkRenderPass);
+}
+
+TEST_F(RendererVKTest, VkGraphicsVertexPSOTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	VkShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	VkShaderModule vertexShaderModule = vertexShader.GetShaderModule();
+
+	VkShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VkShaderModule fragmentShaderModule = fragmentShader.GetShaderModule();
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	VkPipelineObject graphicsVertexPSO{ logicalDevice };
+	graphicsVertexPSO.CreateGraphicsPipelineVS(
+		logicalDevice, pipeLayout, vkRenderPass,
+		VertexLayout()
+		.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+		.InitLayout(), vertexShaderModule, fragmentShaderModule
+	);
+
+	VkPipeline graphicsVertexPipeline = graphicsVertexPSO.GetPipeline();
+	VkObjectInitCheck("VkGraphicsVertexPipeline", graphicsVertexPipeline);
+}
+
+TEST_F(RendererVKTest, VkGraphicsQuantizedVertexPSOTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	SpirvShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	SpirvShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	// The snorm16 position is read as a float vector, so the shader input doesn't change.
+	VkPipelineObject graphicsVertexPSO{ logicalDevice };
+	graphicsVertexPSO.CreateGraphicsPipelineVS(
+		logicalDevice, layout.GetLayout(), renderPass.GetRenderPass(),
+		QuantizedVertexLayout::ToVertexLayout(), vertexShader.GetShaderModule(),
+		fragmentShader.GetShaderModule()
+	);
+
+	VkPipeline graphicsVertexPipeline = graphicsVertexPSO.GetPipeline();
+	VkObjectInitCheck("VkGraphicsQuantizedVertexPipeline", graphicsVertexPipeline);
+}
+
+TEST_F(RendererVKTest, VkGraphicsMeshPSOTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	VkShader meshShader{ logicalDevice };
+	meshShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"MeshShaderTest.spv")
+	);
+
+	VkShaderModule meshShaderModule = meshShader.GetShaderModule();
+
+	VkShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VkShaderModule fragmentShaderModule = fragmentShader.GetShaderModule();
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	VkPipelineObject graphicsMeshPSO{ logicalDevice };
+	graphicsMeshPSO.CreateGraphicsPipelineMS(
+		logicalDevice, pipeLayout, vkRenderPass, meshShaderModule, fragmentShaderModule
+	);
+
+	VkPipeline graphicsMeshPipeline = graphicsMeshPSO.GetPipeline();
+	VkObjectInitCheck("VkGraphicsMeshPipeline", graphicsMeshPipeline);
+}
+
+// The pipelines of the PSO tests with the shaders loaded through LoadSpirv, so from the
+// embedded table when EMBED_SHADERS is on.
+TEST_F(RendererVKTest, VkEmbeddedShaderPSOTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	for (const wchar_t* shaderName : {
+		L"ComputeShaderTest.spv", L"VertexShaderTest.spv", L"MeshShaderTest.spv",
+		L"FragmentShaderTest.spv"
+	}) {
+		const std::vector<std::uint32_t> spirv = LoadSpirv(
+			SpecificValues::shaderPath + std::wstring(shaderName)
+		);
+		ASSERT_FALSE(std::empty(spirv)) << "A shader couldn't be loaded.";
+		EXPECT_EQ(spirv.front(), 0x07230203u) << "The SPIR-V magic number doesn't match.";
+	}
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	SpirvShader computeShader{ logicalDevice };
+	computeShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"ComputeShaderTest.spv")
+	);
+
+	SpirvShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	SpirvShader meshShader{ logicalDevice };
+	meshShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"MeshShaderTest.spv")
+	);
+
+	SpirvShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VkPipelineObject computePSO{ logicalDevice };
+	computePSO.CreateComputePipeline(
+		logicalDevice, pipeLayout, computeShader.GetShaderModule()
+	);
+	VkObjectInitCheck("Embedded VkComputePipeline", computePSO.GetPipeline());
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	VkPipelineObject graphicsVertexPSO{ logicalDevice };
+	graphicsVertexPSO.CreateGraphicsPipelineVS(
+		logicalDevice, pipeLayout, vkRenderPass,
+		VertexLayout()
+		.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+		.InitLayout(), vertexShader.GetShaderModule(), fragmentShader.GetShaderModule()
+	);
+	VkObjectInitCheck("Embedded VkGraphicsVertexPipeline", graphicsVertexPSO.GetPipeline());
+
+	VkPipelineObject graphicsMeshPSO{ logicalDevice };
+	graphicsMeshPSO.CreateGraphicsPipelineMS(
+		logicalDevice, pipeLayout, vkRenderPass, meshShader.GetShaderModule(),
+		fragmentShader.GetShaderModule()
+	);
+	VkObjectInitCheck("Embedded VkGraphicsMeshPipeline", graphicsMeshPSO.GetPipeline());
+}
+
+TEST_F(RendererVKTest, VkPipelineBatchTest) {
+	VkDevice logicalDevice = Terra::device->GetLogicalDevice();
+
+	DescriptorSetManager const* descManager = Terra::graphicsDescriptorSet.get();
+
+	PipelineLayout layout{ logicalDevice };
+	layout.CreateLayout(
+		descManager->GetDescriptorSetLayouts(), descManager->GetDescriptorSetCount()
+	);
+
+	VkPipelineLayout pipeLayout = layout.GetLayout();
+
+	SpirvShader computeShader{ logicalDevice };
+	computeShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"ComputeShaderTest.spv")
+	);
+
+	SpirvShader vertexShader{ logicalDevice };
+	vertexShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"VertexShaderTest.spv")
+	);
+
+	SpirvShader meshShader{ logicalDevice };
+	meshShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"MeshShaderTest.spv")
+	);
+
+	SpirvShader fragmentShader{ logicalDevice };
+	fragmentShader.CreateShader(
+		logicalDevice, SpecificValues::shaderPath + std::wstring(L"FragmentShaderTest.spv")
+	);
+
+	VKRenderPass renderPass{ logicalDevice };
+	renderPass.CreateRenderPass(logicalDevice, VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_D32_SFLOAT);
+
+	VkRenderPass vkRenderPass = renderPass.GetRenderPass();
+
+	std::vector<PipelineDesc> pipelineDescs{
+		ComputePipelineDesc{
+			.layout = pipeLayout,
+			.computeShader = computeShader.GetShaderModule()
+		},
+		GraphicsPipelineVSDesc{
+			.layout = pipeLayout,
+			.renderPass = vkRenderPass,
+			.vertexLayout = VertexLayout()
+				.AddInput(VK_FORMAT_R32G32B32_SFLOAT, 12u)
+				.InitLayout(),
+			.vertexShader = vertexShader.GetShaderModule(),
+			.fragmentShader = fragmentShader.GetShaderModule()
+		},
+		GraphicsPipelineMSDesc{
+			.layout = pipeLayout,
+			.renderPass = vkRenderPass,
+			.meshShader = meshShader.GetShaderModule(),
+			.fragmentShader = fragmentShader.GetShaderModule()
+		}
+	};
+
+	ThreadPool threadPool{};
+
+	{
+		auto pipelineFutures = CreatePipelinesAsync(threadPool, logicalDevice, pipelineDescs);
+
+		for (size_t index = 0u; index < std::size(pipelineFutures); ++index) {
+			std::unique_ptr<VkPipelineObject> pipeline = pipelineFutures[index].get();
+
+			ObjectInitCheck(FormatCompName("Batch", " Pipeline ", index), pipeline);
+			VkObjectInitCheck(
+				FormatCompName("Batch", " VkPipeline ", index), pipeline->GetPipeline()
+			);
+		}
+	}
+
+	{
+		std::promise<std::vector<std::unique_ptr<VkPipelineObject>>> batchPromise;
+		auto batchFuture = batchPromise.get_future();
+
+		CreatePipelinesAsync(
+			threadPool, logicalDevice, pipelineDescs,
+			[&batchPromise](std::vector<std::unique_ptr<VkPipelineObject>> pipelines) {
+				batchPromise.set_value(std::move(pipelines));
+			}
+		);
+
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines = batchFuture.get();
+		EXPECT_EQ(std::size(pipelines), std::size(pipelineDescs))
+			<< "The callback didn't receive every pipeline.";
+
+		for (size_t index = 0u; index < std::size(pipelines); ++index) {
+			ObjectInitCheck(FormatCompName("Callback", " Pipeline ", index), pipelines[index]);
+			VkObjectInitCheck(
+				FormatCompName("Callback", " VkPipeline ", index),
+				pipelines[index]->GetPipeline()
+			);
+		}
+	}
 }
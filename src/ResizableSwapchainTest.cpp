@@ -0,0 +1,121 @@
+#include <ResizableSwapchain.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <limits>
+
+TEST(ResizableSwapchainTest, PresentModeTest) {
+	const std::array supportedModes{ VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+
+	const std::array lowLatencyModes{ VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR };
+	EXPECT_EQ(ChoosePresentMode(supportedModes, lowLatencyModes), VK_PRESENT_MODE_IMMEDIATE_KHR)
+		<< "The first supported preference wasn't chosen.";
+
+	const std::array relaxedModes{ VK_PRESENT_MODE_FIFO_RELAXED_KHR };
+	EXPECT_EQ(ChoosePresentMode(supportedModes, relaxedModes), VK_PRESENT_MODE_FIFO_KHR)
+		<< "Unsupported modes should fall back to FIFO.";
+
+	EXPECT_EQ(ChoosePresentMode(supportedModes, {}), VK_PRESENT_MODE_FIFO_KHR)
+		<< "No preference should be FIFO.";
+}
+
+TEST(ResizableSwapchainTest, ImageCountAndExtentTest) {
+	VkSurfaceCapabilitiesKHR capabilities{
+		.minImageCount = 2u,
+		.maxImageCount = 4u,
+		.currentExtent = VkExtent2D{ .width = 800u, .height = 600u },
+		.minImageExtent = VkExtent2D{ .width = 1u, .height = 1u },
+		.maxImageExtent = VkExtent2D{ .width = 4'096u, .height = 4'096u }
+	};
+
+	EXPECT_EQ(ChooseImageCount(capabilities, 1u), 2u) << "Count wasn't raised to the minimum.";
+	EXPECT_EQ(ChooseImageCount(capabilities, 3u), 3u) << "Count doesn't match.";
+	EXPECT_EQ(ChooseImageCount(capabilities, 8u), 4u) << "Count wasn't limited to the maximum.";
+
+	capabilities.maxImageCount = 0u;
+	EXPECT_EQ(ChooseImageCount(capabilities, 8u), 8u) << "A maximum of 0 should mean no limit.";
+
+	// A window decides its own size.
+	VkExtent2D extent = ChooseExtent(capabilities, 1'920u, 1'080u);
+	EXPECT_EQ(extent.width, 800u) << "Width doesn't match.";
+	EXPECT_EQ(extent.height, 600u) << "Height doesn't match.";
+
+	// A surface without a size takes the requested one, within its limits.
+	capabilities.currentExtent.width = std::numeric_limits<std::uint32_t>::max();
+	capabilities.currentExtent.height = std::numeric_limits<std::uint32_t>::max();
+
+	extent = ChooseExtent(capabilities, 1'920u, 8'192u);
+	EXPECT_EQ(extent.width, 1'920u) << "Width doesn't match.";
+	EXPECT_EQ(extent.height, 4'096u) << "Height wasn't clamped.";
+}
+
+TEST(ResizableSwapchainTest, UsageAndCompositeAlphaTest) {
+	VkSurfaceCapabilitiesKHR capabilities{
+		.supportedCompositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR
+			| VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR,
+		.supportedUsageFlags = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+			| VK_IMAGE_USAGE_TRANSFER_DST_BIT
+	};
+
+	EXPECT_EQ(
+		ChooseImageUsage(
+			capabilities, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_STORAGE_BIT
+		),
+		static_cast<VkImageUsageFlags>(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT)
+	) << "An unsupported usage wasn't left out.";
+	EXPECT_EQ(
+		ChooseImageUsage(
+			capabilities, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT
+		),
+		static_cast<VkImageUsageFlags>(
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT
+		)
+	) << "Usage doesn't match.";
+
+	EXPECT_EQ(ChooseCompositeAlpha(capabilities), VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR)
+		<< "Opaque wasn't preferred.";
+
+	capabilities.supportedCompositeAlpha = VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR;
+	EXPECT_EQ(ChooseCompositeAlpha(capabilities), VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR)
+		<< "The supported mode wasn't chosen.";
+}
+
+TEST(ResizableSwapchainTest, FramePacingStatsTest) {
+	using namespace std::chrono_literals;
+
+	constexpr size_t windowSize = 20u;
+
+	FramePacingStats stats{ windowSize };
+
+	FramePacingSummary summary = stats.GetSummary();
+	EXPECT_EQ(summary.presentCount, 0u) << "Present count doesn't match.";
+	EXPECT_EQ(summary.presentInterval.sampleCount, 0u) << "Empty stats have samples.";
+
+	// Steady 16ms frames with one 50ms hitch, then more frames than the window holds.
+	FramePacingStats::Clock::time_point presentTime{};
+	for (size_t frame = 0u; frame < windowSize + 1u; ++frame) {
+		presentTime += frame == 10u ? 50ms : 16ms;
+
+		stats.AddAcquireWait(frame == 10u ? 30ms : 1ms);
+		stats.AddPresent(presentTime);
+	}
+
+	summary = stats.GetSummary();
+	EXPECT_EQ(summary.presentCount, windowSize + 1u) << "Present count doesn't match.";
+	// The first present has no interval.
+	EXPECT_EQ(summary.presentInterval.sampleCount, windowSize) << "Sample count doesn't match.";
+	EXPECT_DOUBLE_EQ(summary.presentInterval.maxUs, 50'000.0) << "The hitch is missing.";
+	EXPECT_DOUBLE_EQ(summary.presentInterval.percentile95Us, 16'000.0)
+		<< "A single hitch shouldn't move the 95th percentile.";
+	EXPECT_DOUBLE_EQ(
+		summary.presentInterval.averageUs, (19.0 * 16'000.0 + 50'000.0) / 20.0
+	) << "Average doesn't match.";
+
+	// The oldest acquire wait was pushed out of the window.
+	EXPECT_EQ(summary.acquireWait.sampleCount, windowSize) << "Window wasn't limited.";
+	EXPECT_DOUBLE_EQ(summary.acquireWait.maxUs, 30'000.0) << "Max wait doesn't match.";
+
+	stats.Reset();
+	summary = stats.GetSummary();
+	EXPECT_EQ(summary.presentCount, 0u) << "Reset didn't clear the presents.";
+	EXPECT_EQ(summary.acquireWait.sampleCount, 0u) << "Reset didn't clear the waits.";
+}
@@ -0,0 +1,105 @@
+#include <RingAllocator.hpp>
+#include <gtest/gtest.h>
+#include <deque>
+#include <random>
+#include <vector>
+
+struct RingRange {
+	VkDeviceSize offset;
+	VkDeviceSize size;
+};
+
+[[nodiscard]]
+static bool Overlaps(const RingRange& lhs, const RingRange& rhs) noexcept {
+	return lhs.offset < rhs.offset + rhs.size && rhs.offset < lhs.offset + lhs.size;
+}
+
+TEST(RingAllocatorTest, FrameReclaimTest) {
+	RingAllocator ringAllocator{ 1'024u };
+
+	std::optional<VkDeviceSize> first = ringAllocator.Allocate(500u, 256u);
+	ASSERT_TRUE(first) << "Allocation failed.";
+	ringAllocator.FinishFrame();
+
+	std::optional<VkDeviceSize> second = ringAllocator.Allocate(300u, 256u);
+	ASSERT_TRUE(second) << "Allocation failed.";
+	EXPECT_EQ(*second, 512u) << "Offset isn't aligned.";
+	ringAllocator.FinishFrame();
+
+	EXPECT_FALSE(ringAllocator.Allocate(300u, 256u))
+		<< "Allocated over memory the GPU could still be reading.";
+
+	ringAllocator.ReclaimFrame();
+	EXPECT_EQ(ringAllocator.GetFramesInFlight(), 1u) << "Frame count doesn't match.";
+
+	std::optional<VkDeviceSize> wrapped = ringAllocator.Allocate(300u, 256u);
+	ASSERT_TRUE(wrapped) << "The reclaimed space wasn't reused.";
+	EXPECT_EQ(*wrapped, 0u) << "The allocation didn't wrap around.";
+
+	ringAllocator.FinishFrame();
+	ringAllocator.ReclaimFrame();
+	ringAllocator.ReclaimFrame();
+	EXPECT_EQ(ringAllocator.GetUsedSize(), 0u) << "Memory wasn't returned.";
+}
+
+TEST(RingAllocatorTest, RandomFramesTest) {
+	constexpr VkDeviceSize ringSize = 64u * 1'024u;
+	constexpr size_t framesInFlight = 3u;
+	constexpr size_t frameCount = 2'000u;
+
+	RingAllocator ringAllocator{ ringSize };
+
+	std::mt19937 generator{ 7u };
+	std::uniform_int_distribution<size_t> allocationCount{ 1u, 24u };
+	std::uniform_int_distribution<VkDeviceSize> sizeDistribution{ 1u, 2'048u };
+	std::uniform_int_distribution<std::uint32_t> alignmentShift{ 0u, 8u };
+
+	std::deque<std::vector<RingRange>> liveFrames;
+	size_t failedAllocations = 0u;
+
+	for (size_t frame = 0u; frame < frameCount; ++frame) {
+		// The GPU is framesInFlight frames behind.
+		if (std::size(liveFrames) == framesInFlight) {
+			ringAllocator.ReclaimFrame();
+			liveFrames.pop_front();
+		}
+
+		std::vector<RingRange> frameRanges;
+		const size_t count = allocationCount(generator);
+
+		for (size_t index = 0u; index < count; ++index) {
+			const VkDeviceSize size = sizeDistribution(generator);
+			const VkDeviceSize alignment = VkDeviceSize{ 1u } << alignmentShift(generator);
+
+			std::optional<VkDeviceSize> offset = ringAllocator.Allocate(size, alignment);
+			if (!offset) {
+				++failedAllocations;
+
+				continue;
+			}
+
+			const RingRange range{ .offset = *offset, .size = size };
+
+			EXPECT_EQ(range.offset % alignment, 0u) << "Offset isn't aligned.";
+			EXPECT_LE(range.offset + range.size, ringSize) << "Allocation overflows the ring.";
+
+			for (const auto& liveFrame : liveFrames)
+				for (const RingRange& liveRange : liveFrame)
+					EXPECT_FALSE(Overlaps(range, liveRange))
+						<< "Offset " << range.offset << " overlaps a frame in flight.";
+
+			for (const RingRange& liveRange : frameRanges)
+				EXPECT_FALSE(Overlaps(range, liveRange))
+					<< "Offset " << range.offset << " overlaps the current frame.";
+
+			frameRanges.emplace_back(range);
+		}
+
+		ringAllocator.FinishFrame();
+		liveFrames.emplace_back(std::move(frameRanges));
+	}
+
+	// 3 frames of at most 24 * 2KiB fit in 64KiB most of the time.
+	EXPECT_LT(failedAllocations, frameCount) << "The ring is failing too often.";
+	RecordProperty("FailedAllocations", static_cast<int>(failedAllocations));
+}
@@ -0,0 +1,213 @@
+#include <SubAllocator.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace AllocatorValues {
+	constexpr VkDeviceSize heapSize = 1u << 20u;
+	constexpr size_t traceLength = 20'000u;
+	constexpr std::uint32_t seed = 42u;
+}
+
+struct LiveAllocation {
+	VkDeviceSize size;
+	VkDeviceSize alignment;
+};
+
+// Every live allocation has to be aligned, inside the heap and not overlap its neighbours.
+static void CheckLiveAllocations(
+	const std::map<VkDeviceSize, LiveAllocation>& liveAllocations, VkDeviceSize heapSize
+) {
+	VkDeviceSize previousEnd = 0u;
+
+	for (const auto& [offset, allocation] : liveAllocations) {
+		EXPECT_EQ(offset % allocation.alignment, 0u) << "Offset " << offset << " isn't aligned.";
+		EXPECT_GE(offset, previousEnd) << "Offset " << offset << " overlaps.";
+		EXPECT_LE(offset + allocation.size, heapSize) << "Offset " << offset << " overflows.";
+
+		previousEnd = offset + allocation.size;
+	}
+}
+
+TEST(SubAllocatorTest, BuddyRandomTraceTest) {
+	BuddyAllocator allocator{ AllocatorValues::heapSize };
+	EXPECT_EQ(allocator.GetSize(), AllocatorValues::heapSize) << "Size doesn't match.";
+
+	std::mt19937 generator{ AllocatorValues::seed };
+	std::uniform_int_distribution<VkDeviceSize> sizeDistribution{ 1u, 16'384u };
+	std::uniform_int_distribution<std::uint32_t> alignmentShift{ 0u, 12u };
+	std::bernoulli_distribution shouldAllocate{ 0.6 };
+
+	std::map<VkDeviceSize, LiveAllocation> liveAllocations;
+	VkDeviceSize liveSize = 0u;
+	VkDeviceSize worstFragmentedFree = 0u;
+	size_t failedAllocations = 0u;
+
+	for (size_t step = 0u; step < AllocatorValues::traceLength; ++step) {
+		if (shouldAllocate(generator) || std::empty(liveAllocations)) {
+			const LiveAllocation allocation{
+				.size = sizeDistribution(generator),
+				.alignment = VkDeviceSize{ 1u } << alignmentShift(generator)
+			};
+
+			std::optional<VkDeviceSize> offset = allocator.Allocate(
+				allocation.size, allocation.alignment
+			);
+
+			if (!offset) {
+				++failedAllocations;
+
+				// Fragmentation is how much of the free space is unusable for this request.
+				const VkDeviceSize freeSize = allocator.GetSize() - allocator.GetUsedSize();
+				if (freeSize > allocation.size)
+					worstFragmentedFree = std::max(worstFragmentedFree, freeSize);
+
+				continue;
+			}
+
+			EXPECT_TRUE(liveAllocations.emplace(*offset, allocation).second)
+				<< "Offset " << *offset << " was handed out twice.";
+			liveSize += allocation.size;
+		}
+		else {
+			std::uniform_int_distribution<size_t> pick{ 0u, std::size(liveAllocations) - 1u };
+			auto allocation = std::next(std::begin(liveAllocations), pick(generator));
+
+			liveSize -= allocation->second.size;
+			allocator.Free(allocation->first);
+			liveAllocations.erase(allocation);
+		}
+
+		EXPECT_GE(allocator.GetUsedSize(), liveSize) << "Used size is lower than the live size.";
+		// A buddy block is never more than twice the size of its allocation.
+		EXPECT_LE(allocator.GetUsedSize(), 2u * liveSize + 4'096u * std::size(liveAllocations))
+			<< "Internal fragmentation is too high.";
+	}
+
+	CheckLiveAllocations(liveAllocations, allocator.GetSize());
+
+	RecordProperty("FailedAllocations", static_cast<int>(failedAllocations));
+	RecordProperty("WorstFragmentedFreeBytes", static_cast<int>(worstFragmentedFree));
+
+	for (const auto& [offset, allocation] : liveAllocations)
+		allocator.Free(offset);
+
+	EXPECT_EQ(allocator.GetUsedSize(), 0u) << "Memory wasn't returned.";
+	EXPECT_EQ(allocator.GetLargestFreeBlock(), allocator.GetSize())
+		<< "The free blocks didn't merge back.";
+}
+
+TEST(SubAllocatorTest, BuddyReuseTest) {
+	BuddyAllocator allocator{ 4'096u, 256u };
+
+	std::vector<VkDeviceSize> offsets;
+	for (size_t index = 0u; index < 16u; ++index) {
+		std::optional<VkDeviceSize> offset = allocator.Allocate(256u, 256u);
+		ASSERT_TRUE(offset) << "The heap filled up too early.";
+
+		offsets.emplace_back(*offset);
+	}
+
+	EXPECT_FALSE(allocator.Allocate(1u, 1u)) << "Allocated past the end of the heap.";
+	EXPECT_EQ(allocator.GetLargestFreeBlock(), 0u) << "The heap should be full.";
+
+	allocator.Free(offsets[5]);
+	std::optional<VkDeviceSize> reused = allocator.Allocate(200u, 64u);
+	ASSERT_TRUE(reused) << "The freed block wasn't reused.";
+	EXPECT_EQ(*reused, offsets[5]) << "The freed block wasn't reused.";
+}
+
+TEST(SubAllocatorTest, BuddyBatchFreeTest) {
+	BuddyAllocator singleAllocator{ AllocatorValues::heapSize };
+	BuddyAllocator batchAllocator{ AllocatorValues::heapSize };
+
+	std::mt19937 generator{ AllocatorValues::seed };
+	std::uniform_int_distribution<VkDeviceSize> sizeDistribution{ 1u, 16'384u };
+
+	std::vector<VkDeviceSize> offsets;
+	for (size_t index = 0u; index < 48u; ++index) {
+		const VkDeviceSize size = sizeDistribution(generator);
+
+		std::optional<VkDeviceSize> singleOffset = singleAllocator.Allocate(size, 1u);
+		std::optional<VkDeviceSize> batchOffset = batchAllocator.Allocate(size, 1u);
+		ASSERT_TRUE(singleOffset && batchOffset) << "The heap filled up too early.";
+		ASSERT_EQ(*singleOffset, *batchOffset) << "Offset doesn't match.";
+
+		offsets.emplace_back(*singleOffset);
+	}
+
+	// Every other one, so some buddies are freed together and some stay allocated.
+	std::vector<VkDeviceSize> freedOffsets;
+	for (size_t index = 0u; index < std::size(offsets); index += 2u)
+		freedOffsets.emplace_back(offsets[index]);
+
+	for (VkDeviceSize offset : freedOffsets)
+		singleAllocator.Free(offset);
+	batchAllocator.Free(freedOffsets);
+
+	EXPECT_EQ(batchAllocator.GetUsedSize(), singleAllocator.GetUsedSize())
+		<< "Used size doesn't match.";
+	EXPECT_EQ(batchAllocator.GetLargestFreeBlock(), singleAllocator.GetLargestFreeBlock())
+		<< "The free blocks didn't merge like the single frees.";
+
+	for (size_t index = 0u; index < 16u; ++index) {
+		const VkDeviceSize size = sizeDistribution(generator);
+		EXPECT_EQ(batchAllocator.Allocate(size, 1u), singleAllocator.Allocate(size, 1u))
+			<< "Reused offset doesn't match.";
+	}
+
+	batchAllocator.Reset();
+	EXPECT_EQ(batchAllocator.GetLargestFreeBlock(), batchAllocator.GetSize())
+		<< "Reset didn't reclaim the heap.";
+
+	std::vector<VkDeviceSize> allOffsets;
+	for (size_t index = 0u; index < 64u; ++index)
+		if (std::optional<VkDeviceSize> offset = batchAllocator.Allocate(4'096u, 1u))
+			allOffsets.emplace_back(*offset);
+
+	batchAllocator.Free(allOffsets);
+	EXPECT_EQ(batchAllocator.GetUsedSize(), 0u) << "Memory wasn't returned.";
+	EXPECT_EQ(batchAllocator.GetLargestFreeBlock(), batchAllocator.GetSize())
+		<< "The free blocks didn't merge back.";
+}
+
+TEST(SubAllocatorTest, LinearTest) {
+	LinearAllocator allocator{ 1'024u };
+
+	std::optional<VkDeviceSize> first = allocator.Allocate(10u, 1u);
+	std::optional<VkDeviceSize> second = allocator.Allocate(10u, 64u);
+	ASSERT_TRUE(first && second) << "Allocation failed.";
+
+	EXPECT_EQ(*first, 0u) << "The first allocation isn't at the start.";
+	EXPECT_EQ(*second, 64u) << "The second allocation isn't aligned.";
+	EXPECT_EQ(allocator.GetUsedSize(), 74u) << "Used size doesn't match.";
+
+	EXPECT_FALSE(allocator.Allocate(1'000u, 1u)) << "Allocated past the end of the heap.";
+
+	allocator.Reset();
+	EXPECT_EQ(allocator.GetLargestFreeBlock(), 1'024u) << "Reset didn't reclaim the heap.";
+
+	std::mt19937 generator{ AllocatorValues::seed };
+	std::uniform_int_distribution<VkDeviceSize> sizeDistribution{ 1u, 64u };
+	std::uniform_int_distribution<std::uint32_t> alignmentShift{ 0u, 8u };
+
+	std::map<VkDeviceSize, LiveAllocation> liveAllocations;
+	while (true) {
+		const LiveAllocation allocation{
+			.size = sizeDistribution(generator),
+			.alignment = VkDeviceSize{ 1u } << alignmentShift(generator)
+		};
+
+		std::optional<VkDeviceSize> offset = allocator.Allocate(
+			allocation.size, allocation.alignment
+		);
+
+		if (!offset)
+			break;
+
+		liveAllocations.emplace(*offset, allocation);
+	}
+
+	CheckLiveAllocations(liveAllocations, allocator.GetSize());
+}
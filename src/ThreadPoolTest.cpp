@@ -0,0 +1,29 @@
+#include <ThreadPool.hpp>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+
+TEST(ThreadPoolTest, SubmitTest) {
+	ThreadPool threadPool{ 4u };
+	EXPECT_EQ(threadPool.GetThreadCount(), 4u) << "Worker count doesn't match.";
+
+	std::vector<std::future<size_t>> results;
+	for (size_t index = 0u; index < 64u; ++index)
+		results.emplace_back(threadPool.Submit([index] { return index * index; }));
+
+	for (size_t index = 0u; index < std::size(results); ++index)
+		EXPECT_EQ(results[index].get(), index * index) << "Task result doesn't match.";
+}
+
+TEST(ThreadPoolTest, DrainOnDestructionTest) {
+	std::atomic<size_t> completedTasks = 0u;
+
+	{
+		ThreadPool threadPool{ 2u };
+
+		for (size_t index = 0u; index < 32u; ++index)
+			static_cast<void>(threadPool.Submit([&completedTasks] { ++completedTasks; }));
+	}
+
+	EXPECT_EQ(completedTasks.load(), 32u) << "Queued tasks were dropped on destruction.";
+}
@@ -0,0 +1,74 @@
+#include <UploadScheduler.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+
+[[nodiscard]]
+static VkBuffer FakeBuffer(std::uintptr_t handle) noexcept {
+	return reinterpret_cast<VkBuffer>(handle);
+}
+
+TEST(UploadSchedulerTest, CoalesceCopiesTest) {
+	VkBuffer bufferA = FakeBuffer(0x10u);
+	VkBuffer bufferB = FakeBuffer(0x20u);
+
+	std::vector<PendingCopy> pendingCopies{
+		// Contiguous in both buffers, queued out of order.
+		{ .dstBuffer = bufferA, .srcOffset = 16u, .dstOffset = 116u, .size = 16u },
+		{ .dstBuffer = bufferA, .srcOffset = 0u, .dstOffset = 100u, .size = 16u },
+		// Contiguous in the destination only.
+		{ .dstBuffer = bufferA, .srcOffset = 64u, .dstOffset = 132u, .size = 8u },
+		{ .dstBuffer = bufferB, .srcOffset = 32u, .dstOffset = 0u, .size = 32u }
+	};
+
+	std::vector<CopyCommand> copyCommands = CoalesceCopies(std::move(pendingCopies));
+	ASSERT_EQ(std::size(copyCommands), 2u) << "There should be one command per buffer.";
+
+	const CopyCommand& commandA = copyCommands[0].dstBuffer == bufferA ?
+		copyCommands[0] : copyCommands[1];
+	ASSERT_EQ(std::size(commandA.regions), 2u) << "Contiguous copies weren't merged.";
+
+	EXPECT_EQ(commandA.regions[0].srcOffset, 0u) << "Merged srcOffset doesn't match.";
+	EXPECT_EQ(commandA.regions[0].dstOffset, 100u) << "Merged dstOffset doesn't match.";
+	EXPECT_EQ(commandA.regions[0].size, 32u) << "Merged size doesn't match.";
+	EXPECT_EQ(commandA.regions[1].srcOffset, 64u) << "Separate region doesn't match.";
+}
+
+TEST(UploadSchedulerTest, OverlappingCopiesTest) {
+	VkBuffer bufferA = FakeBuffer(0x10u);
+
+	std::vector<PendingCopy> pendingCopies{
+		// The second one writes the same range, so the first one is dropped.
+		{ .dstBuffer = bufferA, .srcOffset = 0u, .dstOffset = 0u, .size = 32u },
+		{ .dstBuffer = bufferA, .srcOffset = 32u, .dstOffset = 0u, .size = 32u },
+		// The second one lands in the middle of the first, which is split around it.
+		{ .dstBuffer = bufferA, .srcOffset = 64u, .dstOffset = 100u, .size = 32u },
+		{ .dstBuffer = bufferA, .srcOffset = 96u, .dstOffset = 116u, .size = 8u },
+		// Overwritten by a later copy which is contiguous with it in the staging buffer.
+		{ .dstBuffer = bufferA, .srcOffset = 104u, .dstOffset = 200u, .size = 16u },
+		{ .dstBuffer = bufferA, .srcOffset = 120u, .dstOffset = 200u, .size = 16u }
+	};
+
+	std::vector<CopyCommand> copyCommands = CoalesceCopies(std::move(pendingCopies));
+	ASSERT_EQ(std::size(copyCommands), 1u) << "There should be one command per buffer.";
+
+	const std::vector<VkBufferCopy>& regions = copyCommands.front().regions;
+	ASSERT_EQ(std::size(regions), 5u) << "Region count doesn't match.";
+
+	const std::array<VkBufferCopy, 5u> expectedRegions{
+		VkBufferCopy{ .srcOffset = 32u, .dstOffset = 0u, .size = 32u },
+		VkBufferCopy{ .srcOffset = 64u, .dstOffset = 100u, .size = 16u },
+		VkBufferCopy{ .srcOffset = 96u, .dstOffset = 116u, .size = 8u },
+		VkBufferCopy{ .srcOffset = 88u, .dstOffset = 124u, .size = 8u },
+		VkBufferCopy{ .srcOffset = 120u, .dstOffset = 200u, .size = 16u }
+	};
+
+	for (size_t index = 0u; index < std::size(expectedRegions); ++index) {
+		EXPECT_EQ(regions[index].srcOffset, expectedRegions[index].srcOffset)
+			<< "srcOffset of region " << index << " doesn't match.";
+		EXPECT_EQ(regions[index].dstOffset, expectedRegions[index].dstOffset)
+			<< "dstOffset of region " << index << " doesn't match.";
+		EXPECT_EQ(regions[index].size, expectedRegions[index].size)
+			<< "Size of region " << index << " doesn't match.";
+	}
+}
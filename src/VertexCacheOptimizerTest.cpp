@@ -0,0 +1,242 @@
+#include <VertexCacheOptimizer.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+struct TestVertex {
+	float position[3];
+	float uv[2];
+};
+
+[[nodiscard]]
+static std::vector<std::uint32_t> CreateGridIndices(std::uint32_t quadsPerSide) {
+	std::vector<std::uint32_t> indices;
+	const std::uint32_t verticesPerSide = quadsPerSide + 1u;
+
+	for (std::uint32_t y = 0u; y < quadsPerSide; ++y)
+		for (std::uint32_t x = 0u; x < quadsPerSide; ++x) {
+			const std::uint32_t topLeft = y * verticesPerSide + x;
+			const std::uint32_t bottomLeft = topLeft + verticesPerSide;
+
+			indices.insert(
+				std::end(indices),
+				{ topLeft, topLeft + 1u, bottomLeft, topLeft + 1u, bottomLeft + 1u, bottomLeft }
+			);
+		}
+
+	return indices;
+}
+
+[[nodiscard]]
+static std::vector<std::array<std::uint32_t, 3u>> GetSortedTriangles(
+	const std::vector<std::uint32_t>& indices
+) {
+	std::vector<std::array<std::uint32_t, 3u>> triangles;
+
+	for (size_t index = 0u; index < std::size(indices); index += 3u)
+		triangles.push_back({ indices[index], indices[index + 1u], indices[index + 2u] });
+
+	std::ranges::sort(triangles);
+
+	return triangles;
+}
+
+static void ShuffleTriangles(std::vector<std::uint32_t>& indices) {
+	std::vector<std::array<std::uint32_t, 3u>> triangles = GetSortedTriangles(indices);
+	std::ranges::shuffle(triangles, std::mt19937{ 7u });
+
+	indices.clear();
+	for (const auto& triangle : triangles)
+		indices.insert(std::end(indices), std::begin(triangle), std::end(triangle));
+}
+
+TEST(VertexCacheOptimizerTest, AnalyzeTest) {
+	const std::vector<std::uint32_t> triangle{ 0u, 1u, 2u };
+
+	VertexCacheStats stats = AnalyzeVertexCache(triangle, 3u);
+	EXPECT_FLOAT_EQ(stats.acmr, 3.f) << "ACMR doesn't match.";
+	EXPECT_FLOAT_EQ(stats.atvr, 1.f) << "ATVR doesn't match.";
+
+	// The second triangle only misses its new vertex.
+	const std::vector<std::uint32_t> strip{ 0u, 1u, 2u, 2u, 1u, 3u };
+
+	stats = AnalyzeVertexCache(strip, 4u);
+	EXPECT_FLOAT_EQ(stats.acmr, 2.f) << "ACMR doesn't match.";
+	EXPECT_FLOAT_EQ(stats.atvr, 1.f) << "ATVR doesn't match.";
+
+	// With a cache of 3, vertex 0 was evicted by the time it's used again.
+	const std::vector<std::uint32_t> evicted{ 0u, 1u, 2u, 3u, 4u, 5u, 0u, 4u, 5u };
+
+	stats = AnalyzeVertexCache(evicted, 6u, 3u);
+	EXPECT_FLOAT_EQ(stats.acmr, 7.f / 3.f) << "ACMR doesn't match.";
+	EXPECT_FLOAT_EQ(stats.atvr, 7.f / 6.f) << "ATVR doesn't match.";
+}
+
+TEST(VertexCacheOptimizerTest, OptimizeVertexCacheTest) {
+	constexpr std::uint32_t quadsPerSide = 32u;
+	constexpr size_t vertexCount = (quadsPerSide + 1u) * (quadsPerSide + 1u);
+
+	std::vector<std::uint32_t> indices = CreateGridIndices(quadsPerSide);
+	ShuffleTriangles(indices);
+
+	const VertexCacheStats statsBefore = AnalyzeVertexCache(indices, vertexCount);
+
+	const std::vector<std::uint32_t> optimizedIndices = OptimizeVertexCache(indices, vertexCount);
+
+	EXPECT_EQ(GetSortedTriangles(optimizedIndices), GetSortedTriangles(indices))
+		<< "The triangles or their winding changed.";
+
+	const VertexCacheStats statsAfter = AnalyzeVertexCache(optimizedIndices, vertexCount);
+
+	RecordProperty("ACMRBefore", std::to_string(statsBefore.acmr));
+	RecordProperty("ACMRAfter", std::to_string(statsAfter.acmr));
+
+	EXPECT_LT(statsAfter.acmr, statsBefore.acmr * 0.5f) << "The cache hits didn't improve.";
+	EXPECT_LT(statsAfter.acmr, 1.f) << "A grid should be well below 1 vertex per triangle.";
+	EXPECT_LT(statsAfter.atvr, 1.5f) << "Too many vertices were transformed more than once.";
+}
+
+TEST(VertexCacheOptimizerTest, OptimizeOverdrawTest) {
+	constexpr std::uint32_t quadsPerSide = 8u;
+	constexpr std::uint32_t verticesPerSide = quadsPerSide + 1u;
+	constexpr std::uint32_t patchVertexCount = verticesPerSide * verticesPerSide;
+
+	// Two grids facing +z, the one at z = -1 faces the centre of the mesh and is drawn first.
+	std::vector<std::array<float, 3u>> positions;
+	for (float z : { -1.f, 1.f })
+		for (std::uint32_t index = 0u; index < patchVertexCount; ++index)
+			positions.push_back({
+				static_cast<float>(index % verticesPerSide),
+				static_cast<float>(index / verticesPerSide), z
+			});
+
+	std::vector<std::uint32_t> indices = CreateGridIndices(quadsPerSide);
+	const size_t patchIndexCount = std::size(indices);
+
+	for (size_t index = 0u; index < patchIndexCount; ++index)
+		indices.emplace_back(indices[index] + patchVertexCount);
+
+	const std::vector<std::uint32_t> cacheIndices = OptimizeVertexCache(
+		indices, std::size(positions)
+	);
+	const std::vector<std::uint32_t> overdrawIndices = OptimizeOverdraw(cacheIndices, positions);
+
+	EXPECT_EQ(GetSortedTriangles(overdrawIndices), GetSortedTriangles(indices))
+		<< "The triangles or their winding changed.";
+
+	// The grids don't share any vertices, so the outer one has to come first as a whole.
+	for (size_t index = 0u; index < patchIndexCount; ++index)
+		ASSERT_GE(overdrawIndices[index], patchVertexCount)
+			<< "The inner grid is drawn before the outer one at " << index << ".";
+
+	const VertexCacheStats cacheStats = AnalyzeVertexCache(cacheIndices, std::size(positions));
+	const VertexCacheStats overdrawStats = AnalyzeVertexCache(
+		overdrawIndices, std::size(positions)
+	);
+
+	RecordProperty("ACMRCache", std::to_string(cacheStats.acmr));
+	RecordProperty("ACMROverdraw", std::to_string(overdrawStats.acmr));
+
+	EXPECT_LT(overdrawStats.acmr, 1.f) << "The clusters lost the cache hits.";
+}
+
+TEST(VertexCacheOptimizerTest, VertexFetchRemapTest) {
+	const std::vector<std::uint32_t> indices{ 3u, 1u, 0u, 0u, 1u, 4u };
+
+	const std::vector<std::uint32_t> remap = CreateVertexFetchRemap(indices, 6u);
+
+	const std::vector<std::uint32_t> expectedRemap{
+		2u, 1u, unusedVertex, 0u, 3u, unusedVertex
+	};
+	EXPECT_EQ(remap, expectedRemap) << "Vertices should be in their first use order.";
+
+	const std::vector<int> vertices{ 10, 11, 12, 13, 14, 15 };
+	const std::vector<int> newVertices = RemapVertices(std::span<const int>{ vertices }, remap);
+
+	const std::vector<int> expectedVertices{ 13, 11, 10, 14 };
+	EXPECT_EQ(newVertices, expectedVertices) << "Unused vertices should be dropped.";
+}
+
+TEST(VertexCacheOptimizerTest, OptimizeMeshTest) {
+	constexpr std::uint32_t quadsPerSide = 16u;
+	constexpr std::uint32_t verticesPerSide = quadsPerSide + 1u;
+
+	// The grid without indices, so every triangle has its own vertices.
+	const std::vector<std::uint32_t> gridIndices = CreateGridIndices(quadsPerSide);
+
+	std::vector<TestVertex> vertices;
+	std::vector<std::array<float, 3u>> positions;
+	std::vector<std::uint32_t> indices;
+
+	for (std::uint32_t gridIndex : gridIndices) {
+		const auto x = static_cast<float>(gridIndex % verticesPerSide);
+		const auto y = static_cast<float>(gridIndex / verticesPerSide);
+
+		indices.emplace_back(static_cast<std::uint32_t>(std::size(vertices)));
+		vertices.emplace_back(TestVertex{ { x, y, 0.f }, { x / quadsPerSide, y / quadsPerSide } });
+		positions.push_back({ x, y, 0.f });
+	}
+
+	const OptimizedMesh<TestVertex> mesh = OptimizeMesh(
+		std::span<const TestVertex>{ vertices }, indices, positions
+	);
+
+	EXPECT_EQ(std::size(mesh.vertices), verticesPerSide * verticesPerSide)
+		<< "Duplicate vertices weren't removed.";
+	EXPECT_EQ(std::size(mesh.indices), std::size(indices)) << "Index count changed.";
+	ASSERT_EQ(std::size(mesh.indices16), std::size(mesh.indices))
+		<< "16 bit indices weren't produced.";
+
+	for (size_t index = 0u; index < std::size(mesh.indices); ++index)
+		EXPECT_EQ(mesh.indices16[index], mesh.indices[index]) << "16 bit index doesn't match.";
+
+	RecordProperty("ACMRBefore", std::to_string(mesh.statsBefore.acmr));
+	RecordProperty("ACMRAfter", std::to_string(mesh.statsAfter.acmr));
+	RecordProperty("ATVRAfter", std::to_string(mesh.statsAfter.atvr));
+
+	EXPECT_FLOAT_EQ(mesh.statsBefore.acmr, 3.f) << "Unindexed triangles should miss every vertex.";
+	EXPECT_LT(mesh.statsAfter.acmr, 1.f) << "The cache hits didn't improve.";
+
+	// The optimised mesh must draw the same triangles.
+	std::vector<std::array<std::array<float, 3u>, 3u>> expectedTriangles;
+	std::vector<std::array<std::array<float, 3u>, 3u>> triangles;
+
+	for (size_t index = 0u; index < std::size(indices); index += 3u) {
+		std::array<std::array<float, 3u>, 3u>& expected = expectedTriangles.emplace_back();
+		std::array<std::array<float, 3u>, 3u>& optimized = triangles.emplace_back();
+
+		for (size_t corner = 0u; corner < 3u; ++corner) {
+			const TestVertex& expectedVertex = vertices[indices[index + corner]];
+			const TestVertex& optimizedVertex = mesh.vertices[mesh.indices[index + corner]];
+
+			expected[corner] = {
+				expectedVertex.position[0], expectedVertex.position[1], expectedVertex.position[2]
+			};
+			optimized[corner] = {
+				optimizedVertex.position[0], optimizedVertex.position[1],
+				optimizedVertex.position[2]
+			};
+		}
+	}
+
+	std::ranges::sort(expectedTriangles);
+	std::ranges::sort(triangles);
+
+	EXPECT_EQ(triangles, expectedTriangles) << "The optimised mesh draws different triangles.";
+
+	// The vertices should be fetched in order.
+	std::uint32_t highestIndex = 0u;
+	for (std::uint32_t index : mesh.indices) {
+		EXPECT_LE(index, highestIndex + 1u) << "Vertices aren't in their fetch order.";
+		highestIndex = std::max(highestIndex, index);
+	}
+}
+
+TEST(VertexCacheOptimizerTest, NarrowIndicesTest) {
+	const std::vector<std::uint32_t> indices{ 0u, 1u, 65'535u };
+
+	EXPECT_TRUE(NarrowIndices(indices, 65'536u)) << "65536 vertices fit in 16 bits.";
+	EXPECT_FALSE(NarrowIndices(indices, 65'537u)) << "65537 vertices don't fit in 16 bits.";
+}
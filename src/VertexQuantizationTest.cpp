@@ -0,0 +1,124 @@
+#include <VertexQuantization.hpp>
+#include <StaticVertexLayout.hpp>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST(VertexQuantizationTest, StaticLayoutTest) {
+	static_assert(FullVertexLayout::stride == 32u);
+	static_assert(QuantizedVertexLayout::stride == 16u);
+
+	constexpr auto attributes = QuantizedVertexLayout::GetAttributeDescriptions(1u);
+	static_assert(std::size(attributes) == 3u);
+	static_assert(attributes[1].offset == 8u && attributes[2].offset == 12u);
+
+	EXPECT_EQ(attributes[0].format, VK_FORMAT_R16G16B16A16_SNORM) << "Format doesn't match.";
+	EXPECT_EQ(attributes[1].format, VK_FORMAT_R16G16_SNORM) << "Format doesn't match.";
+	EXPECT_EQ(attributes[2].format, VK_FORMAT_R16G16_SFLOAT) << "Format doesn't match.";
+
+	for (std::uint32_t index = 0u; index < std::size(attributes); ++index) {
+		EXPECT_EQ(attributes[index].location, index) << "Location doesn't match.";
+		EXPECT_EQ(attributes[index].binding, 1u) << "Binding doesn't match.";
+	}
+
+	constexpr VkVertexInputBindingDescription binding
+		= QuantizedVertexLayout::GetBindingDescription();
+	EXPECT_EQ(binding.stride, sizeof(QuantizedVertex)) << "Stride doesn't match.";
+}
+
+TEST(VertexQuantizationTest, PositionTest) {
+	std::mt19937 generator{ 3u };
+	std::uniform_real_distribution<float> distribution{ -50.f, 120.f };
+
+	std::vector<Float3> positions;
+	for (size_t index = 0u; index < 256u; ++index)
+		positions.emplace_back(
+			Float3{ distribution(generator), distribution(generator), distribution(generator) }
+		);
+
+	const QuantizationBounds bounds = ComputeQuantizationBounds(positions);
+
+	for (const Float3& position : positions) {
+		const std::array<std::int16_t, 4u> encoded = EncodePosition(position, bounds);
+		EXPECT_EQ(encoded[3], 32'767) << "W should be 1.";
+
+		const Float3 decoded = DecodePosition(encoded, bounds);
+
+		// Half a quantization step of the largest axis.
+		for (size_t axis = 0u; axis < 3u; ++axis)
+			EXPECT_NEAR(decoded[axis], position[axis], bounds.extent[axis] / 32'767.f)
+				<< "Position precision lost.";
+	}
+
+	// A flat mesh shouldn't produce NaNs.
+	const std::vector<Float3> flatPositions{ { 0.f, 1.f, 2.f }, { 4.f, 1.f, 2.f } };
+	const QuantizationBounds flatBounds = ComputeQuantizationBounds(flatPositions);
+	const Float3 decoded = DecodePosition(EncodePosition(flatPositions[1], flatBounds), flatBounds);
+
+	EXPECT_NEAR(decoded[0], 4.f, 0.001f) << "Position doesn't match.";
+	EXPECT_NEAR(decoded[1], 1.f, 0.001f) << "Position doesn't match.";
+}
+
+TEST(VertexQuantizationTest, OctahedralTest) {
+	std::mt19937 generator{ 5u };
+	std::normal_distribution<float> distribution{};
+
+	const std::vector<Float3> axes{
+		{ 1.f, 0.f, 0.f }, { -1.f, 0.f, 0.f }, { 0.f, 1.f, 0.f }, { 0.f, -1.f, 0.f },
+		{ 0.f, 0.f, 1.f }, { 0.f, 0.f, -1.f }
+	};
+
+	std::vector<Float3> normals = axes;
+	for (size_t index = 0u; index < 1'024u; ++index) {
+		Float3 normal{ distribution(generator), distribution(generator), distribution(generator) };
+		const float length = std::sqrt(
+			normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]
+		);
+
+		normals.emplace_back(Float3{ normal[0] / length, normal[1] / length, normal[2] / length });
+	}
+
+	for (const Float3& normal : normals) {
+		const Float3 decoded = DecodeOctahedral(EncodeOctahedral(normal));
+
+		// A 16 bit octahedral step is about 3e-5 on the unit sphere.
+		for (size_t axis = 0u; axis < 3u; ++axis)
+			EXPECT_NEAR(decoded[axis], normal[axis], 1e-4f) << "Normal precision lost.";
+	}
+}
+
+TEST(VertexQuantizationTest, HalfTest) {
+	EXPECT_EQ(EncodeHalf(0.f), 0x0000u) << "Zero doesn't match.";
+	EXPECT_EQ(EncodeHalf(-0.f), 0x8000u) << "Negative zero doesn't match.";
+	EXPECT_EQ(EncodeHalf(1.f), 0x3C00u) << "One doesn't match.";
+	EXPECT_EQ(EncodeHalf(-2.f), 0xC000u) << "Minus two doesn't match.";
+	EXPECT_EQ(EncodeHalf(65'504.f), 0x7BFFu) << "The largest half doesn't match.";
+	EXPECT_EQ(EncodeHalf(1e6f), 0x7C00u) << "Overflow should be infinity.";
+	EXPECT_EQ(EncodeHalf(std::ldexp(1.f, -24)), 0x0001u) << "The smallest denormal doesn't match.";
+	EXPECT_TRUE(std::isnan(DecodeHalf(EncodeHalf(std::nanf(""))))) << "NaN wasn't kept.";
+
+	// 1 + 2^-11 is exactly between two halves, so it rounds to the even one.
+	EXPECT_EQ(EncodeHalf(1.f + std::ldexp(1.f, -11)), 0x3C00u) << "Ties should round to even.";
+	EXPECT_EQ(EncodeHalf(1.f + 3.f * std::ldexp(1.f, -11)), 0x3C02u)
+		<< "Ties should round to even.";
+
+	for (float uv = 0.f; uv <= 1.f; uv += 1.f / 512.f)
+		EXPECT_NEAR(DecodeHalf(EncodeHalf(uv)), uv, 1.f / 4'096.f) << "UV precision lost.";
+}
+
+TEST(VertexQuantizationTest, QuantizeVertexTest) {
+	const QuantizationBounds bounds{ .center = { 0.f, 0.f, 0.f }, .extent = { 2.f, 2.f, 2.f } };
+
+	const QuantizedVertex vertex = QuantizeVertex(
+		{ 1.f, -2.f, 0.f }, { 0.f, 0.f, 1.f }, { 0.25f, 0.75f }, bounds
+	);
+
+	EXPECT_EQ(vertex.position[0], 16'384) << "Position doesn't match.";
+	EXPECT_EQ(vertex.position[1], -32'767) << "Position doesn't match.";
+	EXPECT_EQ(vertex.position[2], 0) << "Position doesn't match.";
+	EXPECT_EQ(vertex.normal[0], 0) << "Normal doesn't match.";
+	EXPECT_EQ(vertex.normal[1], 0) << "Normal doesn't match.";
+	EXPECT_FLOAT_EQ(DecodeHalf(vertex.uv[0]), 0.25f) << "UV doesn't match.";
+	EXPECT_FLOAT_EQ(DecodeHalf(vertex.uv[1]), 0.75f) << "UV doesn't match.";
+}
@@ -0,0 +1,176 @@
+#include <AsyncComputeScheduler.hpp>
+
+AsyncComputeScheduler::QueueSide::QueueSide(
+	VkDevice device, VkQueue queue, std::uint32_t familyIndex
+) noexcept
+	: timeline{ device, QueueTimeline::Args{ .queue = queue } }, familyIndex{ familyIndex },
+	commandPool{ VK_NULL_HANDLE } {
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+		.queueFamilyIndex = familyIndex
+	};
+
+	vkCreateCommandPool(device, &poolInfo, nullptr, &commandPool);
+}
+
+AsyncComputeScheduler::AsyncComputeScheduler(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device },
+	m_graphics{ device, arguments.graphicsQueue, arguments.graphicsFamilyIndex },
+	m_compute{
+		device,
+		arguments.computeFamilyIndex == arguments.graphicsFamilyIndex ?
+			arguments.graphicsQueue : arguments.computeQueue,
+		arguments.computeFamilyIndex
+	} {}
+
+AsyncComputeScheduler::~AsyncComputeScheduler() noexcept {
+	// The command buffers can't be freed while they are still executing.
+	WaitIdle(m_deviceRef);
+
+	vkDestroyCommandPool(m_deviceRef, m_graphics.commandPool, nullptr);
+	vkDestroyCommandPool(m_deviceRef, m_compute.commandPool, nullptr);
+}
+
+std::optional<TimelinePoint> AsyncComputeScheduler::SubmitGraphics(
+	VkDevice device, const RecordFunction& recordFunction, const PassBuffers& passBuffers,
+	std::span<const TimelineWait> waits
+) {
+	return Submit(device, m_graphics, true, recordFunction, passBuffers, waits);
+}
+
+std::optional<TimelinePoint> AsyncComputeScheduler::SubmitCompute(
+	VkDevice device, const RecordFunction& recordFunction, const PassBuffers& passBuffers,
+	std::span<const TimelineWait> waits
+) {
+	return Submit(device, m_compute, false, recordFunction, passBuffers, waits);
+}
+
+bool AsyncComputeScheduler::IsAsync() const noexcept {
+	return m_graphics.familyIndex != m_compute.familyIndex;
+}
+
+const QueueTimeline& AsyncComputeScheduler::GetGraphicsTimeline() const noexcept {
+	return m_graphics.timeline;
+}
+
+const QueueTimeline& AsyncComputeScheduler::GetComputeTimeline() const noexcept {
+	return m_compute.timeline;
+}
+
+void AsyncComputeScheduler::WaitIdle(VkDevice device) const noexcept {
+	m_graphics.timeline.WaitIdle(device);
+	m_compute.timeline.WaitIdle(device);
+}
+
+std::optional<TimelinePoint> AsyncComputeScheduler::Submit(
+	VkDevice device, QueueSide& side, bool graphicsSide, const RecordFunction& recordFunction,
+	const PassBuffers& passBuffers, std::span<const TimelineWait> waits
+) {
+	VkCommandBuffer commandBuffer = AcquireCommandBuffer(device, side);
+
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
+
+	vkBeginCommandBuffer(commandBuffer, &beginInfo);
+	RecordOwnershipTransfers(commandBuffer, passBuffers.acquire, graphicsSide, false);
+	recordFunction(commandBuffer);
+	RecordOwnershipTransfers(commandBuffer, passBuffers.release, graphicsSide, true);
+	vkEndCommandBuffer(commandBuffer);
+
+	const std::optional<TimelinePoint> point = side.timeline.Submit(
+		std::span{ &commandBuffer, 1u }, waits
+	);
+
+	// The command buffer wasn't submitted, so it can be recorded again straight away.
+	if (point)
+		side.commandBuffersInFlight.emplace_back(commandBuffer, point->value);
+	else
+		side.freeCommandBuffers.emplace_back(commandBuffer);
+
+	return point;
+}
+
+void AsyncComputeScheduler::RecordOwnershipTransfers(
+	VkCommandBuffer commandBuffer, std::span<const SharedBuffer> buffers, bool graphicsSide,
+	bool release
+) const {
+	if (!IsAsync() || std::empty(buffers))
+		return;
+
+	// A release goes from this queue's family to the other one and an acquire the other way.
+	const bool fromGraphics = graphicsSide == release;
+	const std::uint32_t srcFamilyIndex = fromGraphics ?
+		m_graphics.familyIndex : m_compute.familyIndex;
+	const std::uint32_t dstFamilyIndex = fromGraphics ?
+		m_compute.familyIndex : m_graphics.familyIndex;
+
+	std::vector<VkBufferMemoryBarrier> barriers;
+	VkPipelineStageFlags sideStages = graphicsSide ? 0u : VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+	for (const SharedBuffer& sharedBuffer : buffers) {
+		const VkAccessFlags sideAccess = graphicsSide ?
+			sharedBuffer.graphicsAccess : sharedBuffer.computeAccess;
+
+		if (graphicsSide)
+			sideStages |= sharedBuffer.graphicsStages;
+
+		// The access mask of the other queue is ignored, its half of the transfer covers it.
+		barriers.emplace_back(VkBufferMemoryBarrier{
+			.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+			.srcAccessMask = release ? sideAccess : 0u,
+			.dstAccessMask = release ? 0u : sideAccess,
+			.srcQueueFamilyIndex = srcFamilyIndex,
+			.dstQueueFamilyIndex = dstFamilyIndex,
+			.buffer = sharedBuffer.buffer,
+			.offset = 0u,
+			.size = VK_WHOLE_SIZE
+		});
+	}
+
+	// A stage mask can't be empty.
+	if (sideStages == 0u)
+		sideStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+	vkCmdPipelineBarrier(
+		commandBuffer,
+		release ? sideStages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		release ? VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT : sideStages,
+		0u, 0u, nullptr, static_cast<std::uint32_t>(std::size(barriers)), std::data(barriers),
+		0u, nullptr
+	);
+}
+
+VkCommandBuffer AsyncComputeScheduler::AcquireCommandBuffer(
+	VkDevice device, QueueSide& side
+) noexcept {
+	const std::uint64_t completedValue = side.timeline.GetCompletedValue(device);
+
+	while (!std::empty(side.commandBuffersInFlight)
+		&& side.commandBuffersInFlight.front().second <= completedValue) {
+		side.freeCommandBuffers.emplace_back(side.commandBuffersInFlight.front().first);
+		side.commandBuffersInFlight.pop_front();
+	}
+
+	if (!std::empty(side.freeCommandBuffers)) {
+		VkCommandBuffer commandBuffer = side.freeCommandBuffers.back();
+		side.freeCommandBuffers.pop_back();
+
+		// Beginning it again resets it, the pool allows that.
+		return commandBuffer;
+	}
+
+	VkCommandBufferAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.commandPool = side.commandPool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+	vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer);
+
+	return commandBuffer;
+}
@@ -0,0 +1,103 @@
+#ifndef ASYNC_COMPUTE_SCHEDULER_HPP_
+#define ASYNC_COMPUTE_SCHEDULER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <TimelineSemaphore.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+// A buffer with exclusive sharing which is passed between the graphics and the compute queue.
+struct SharedBuffer {
+	VkBuffer buffer;
+	// TOP_OF_PIPE is used if none of the buffers of a transfer have any.
+	VkPipelineStageFlags graphicsStages;
+	VkAccessFlags graphicsAccess;
+	VkAccessFlags computeAccess;
+};
+
+// Submits graphics and compute passes on their own queues, so compute can overlap
+// rasterisation. Passes only wait for the timeline points they are given. Buffers which are
+// handed from one queue to the other are released at the end of one pass and acquired at the
+// start of the next. If both queues are in the same family, everything goes to the graphics
+// queue and no ownership transfer is recorded, the timeline wait already orders the passes.
+class AsyncComputeScheduler {
+public:
+	struct Args {
+		VkQueue graphicsQueue;
+		std::uint32_t graphicsFamilyIndex;
+		VkQueue computeQueue;
+		std::uint32_t computeFamilyIndex;
+	};
+
+	using RecordFunction = std::function<void(VkCommandBuffer)>;
+
+	// The ownership transfers of a pass, from the other queue and to it.
+	struct PassBuffers {
+		std::span<const SharedBuffer> acquire;
+		std::span<const SharedBuffer> release;
+	};
+
+public:
+	AsyncComputeScheduler(VkDevice device, const Args& arguments);
+	~AsyncComputeScheduler() noexcept;
+
+	AsyncComputeScheduler(const AsyncComputeScheduler&) = delete;
+	AsyncComputeScheduler& operator=(const AsyncComputeScheduler&) = delete;
+
+	// Nothing if the submission failed, like QueueTimeline::Submit.
+	[[nodiscard]]
+	std::optional<TimelinePoint> SubmitGraphics(
+		VkDevice device, const RecordFunction& recordFunction, const PassBuffers& passBuffers = {},
+		std::span<const TimelineWait> waits = {}
+	);
+	[[nodiscard]]
+	std::optional<TimelinePoint> SubmitCompute(
+		VkDevice device, const RecordFunction& recordFunction, const PassBuffers& passBuffers = {},
+		std::span<const TimelineWait> waits = {}
+	);
+
+	// False when compute falls back to the graphics queue.
+	[[nodiscard]]
+	bool IsAsync() const noexcept;
+	[[nodiscard]]
+	const QueueTimeline& GetGraphicsTimeline() const noexcept;
+	[[nodiscard]]
+	const QueueTimeline& GetComputeTimeline() const noexcept;
+
+	void WaitIdle(VkDevice device) const noexcept;
+
+private:
+	struct QueueSide {
+		QueueSide(VkDevice device, VkQueue queue, std::uint32_t familyIndex) noexcept;
+
+		QueueTimeline timeline;
+		std::uint32_t familyIndex;
+		VkCommandPool commandPool;
+		std::deque<std::pair<VkCommandBuffer, std::uint64_t>> commandBuffersInFlight;
+		std::vector<VkCommandBuffer> freeCommandBuffers;
+	};
+
+private:
+	[[nodiscard]]
+	std::optional<TimelinePoint> Submit(
+		VkDevice device, QueueSide& side, bool graphicsSide, const RecordFunction& recordFunction,
+		const PassBuffers& passBuffers, std::span<const TimelineWait> waits
+	);
+
+	void RecordOwnershipTransfers(
+		VkCommandBuffer commandBuffer, std::span<const SharedBuffer> buffers, bool graphicsSide,
+		bool release
+	) const;
+
+	[[nodiscard]]
+	static VkCommandBuffer AcquireCommandBuffer(VkDevice device, QueueSide& side) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	QueueSide m_graphics;
+	QueueSide m_compute;
+};
+#endif
@@ -0,0 +1,284 @@
+#include <BindlessDescriptorTable.hpp>
+#include <algorithm>
+
+BindlessDescriptorTable::BindlessDescriptorTable(
+	VkDevice device, const Args& arguments
+) noexcept
+	: BindlessDescriptorTable{
+		device, arguments, ClampCounts(arguments.physicalDevice, arguments)
+	} {}
+
+BindlessDescriptorTable::BindlessDescriptorTable(
+	VkDevice device, const Args& arguments, const std::array<std::uint32_t, 3u>& counts
+) noexcept
+	: m_deviceRef{ device }, m_layout{ VK_NULL_HANDLE }, m_pool{ VK_NULL_HANDLE },
+	m_descriptorSet{ VK_NULL_HANDLE },
+	m_arrays{
+		DescriptorArray{
+			VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, DescriptorSlotAllocator{ counts[0] }, {}
+		},
+		DescriptorArray{
+			VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, DescriptorSlotAllocator{ counts[1] }, {}
+		},
+		DescriptorArray{
+			VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, DescriptorSlotAllocator{ counts[2] }, {}
+		}
+	},
+	m_bufferInfos(counts[0]), m_sampledImageInfos(counts[1]), m_storageImageInfos(counts[2]) {
+	std::array<VkDescriptorSetLayoutBinding, 3u> bindings{};
+	std::array<VkDescriptorBindingFlags, 3u> bindingFlags{};
+	std::vector<VkDescriptorPoolSize> poolSizes;
+
+	for (std::uint32_t index = 0u; index < std::size(bindings); ++index) {
+		bindings[index] = VkDescriptorSetLayoutBinding{
+			.binding = index,
+			.descriptorType = m_arrays[index].type,
+			.descriptorCount = counts[index],
+			.stageFlags = arguments.stages
+		};
+		bindingFlags[index] = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+			| VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+			| VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT;
+
+		// An empty binding only reserves its number.
+		if (counts[index] != 0u)
+			poolSizes.emplace_back(VkDescriptorPoolSize{
+				.type = m_arrays[index].type,
+				.descriptorCount = counts[index]
+			});
+	}
+
+	VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO,
+		.bindingCount = static_cast<std::uint32_t>(std::size(bindingFlags)),
+		.pBindingFlags = std::data(bindingFlags)
+	};
+
+	VkDescriptorSetLayoutCreateInfo layoutInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = &bindingFlagsInfo,
+		.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+		.bindingCount = static_cast<std::uint32_t>(std::size(bindings)),
+		.pBindings = std::data(bindings)
+	};
+
+	if (vkCreateDescriptorSetLayout(device, &layoutInfo, nullptr, &m_layout) != VK_SUCCESS)
+		return;
+
+	if (std::empty(poolSizes))
+		return;
+
+	VkDescriptorPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+		.maxSets = 1u,
+		.poolSizeCount = static_cast<std::uint32_t>(std::size(poolSizes)),
+		.pPoolSizes = std::data(poolSizes)
+	};
+
+	if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_pool) != VK_SUCCESS)
+		return;
+
+	VkDescriptorSetAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		.descriptorPool = m_pool,
+		.descriptorSetCount = 1u,
+		.pSetLayouts = &m_layout
+	};
+
+	vkAllocateDescriptorSets(device, &allocInfo, &m_descriptorSet);
+}
+
+BindlessDescriptorTable::~BindlessDescriptorTable() noexcept {
+	// Destroying the pool frees the set.
+	vkDestroyDescriptorPool(m_deviceRef, m_pool, nullptr);
+	vkDestroyDescriptorSetLayout(m_deviceRef, m_layout, nullptr);
+}
+
+std::optional<std::uint32_t> BindlessDescriptorTable::AddStorageBuffer(
+	const VkDescriptorBufferInfo& bufferInfo
+) noexcept {
+	std::optional<std::uint32_t> slot
+		= GetArray(BindlessType::StorageBuffer).slotAllocator.Allocate();
+
+	if (slot)
+		UpdateStorageBuffer(*slot, bufferInfo);
+
+	return slot;
+}
+
+std::optional<std::uint32_t> BindlessDescriptorTable::AddSampledImage(
+	const VkDescriptorImageInfo& imageInfo
+) noexcept {
+	std::optional<std::uint32_t> slot
+		= GetArray(BindlessType::SampledImage).slotAllocator.Allocate();
+
+	if (slot)
+		UpdateSampledImage(*slot, imageInfo);
+
+	return slot;
+}
+
+std::optional<std::uint32_t> BindlessDescriptorTable::AddStorageImage(
+	const VkDescriptorImageInfo& imageInfo
+) noexcept {
+	std::optional<std::uint32_t> slot
+		= GetArray(BindlessType::StorageImage).slotAllocator.Allocate();
+
+	if (slot)
+		UpdateStorageImage(*slot, imageInfo);
+
+	return slot;
+}
+
+void BindlessDescriptorTable::UpdateStorageBuffer(
+	std::uint32_t slot, const VkDescriptorBufferInfo& bufferInfo
+) noexcept {
+	m_bufferInfos[slot] = bufferInfo;
+	GetArray(BindlessType::StorageBuffer).dirtySlots.emplace_back(slot);
+}
+
+void BindlessDescriptorTable::UpdateSampledImage(
+	std::uint32_t slot, const VkDescriptorImageInfo& imageInfo
+) noexcept {
+	m_sampledImageInfos[slot] = imageInfo;
+	GetArray(BindlessType::SampledImage).dirtySlots.emplace_back(slot);
+}
+
+void BindlessDescriptorTable::UpdateStorageImage(
+	std::uint32_t slot, const VkDescriptorImageInfo& imageInfo
+) noexcept {
+	m_storageImageInfos[slot] = imageInfo;
+	GetArray(BindlessType::StorageImage).dirtySlots.emplace_back(slot);
+}
+
+void BindlessDescriptorTable::Remove(BindlessType type, std::uint32_t slot) noexcept {
+	DescriptorArray& descriptorArray = GetArray(type);
+
+	std::erase(descriptorArray.dirtySlots, slot);
+	descriptorArray.slotAllocator.Free(slot);
+}
+
+std::uint32_t BindlessDescriptorTable::Flush(VkDevice device) {
+	std::vector<VkWriteDescriptorSet> descriptorWrites;
+	std::uint32_t descriptorCount = 0u;
+
+	for (std::uint32_t binding = 0u; binding < std::size(m_arrays); ++binding) {
+		DescriptorArray& descriptorArray = m_arrays[binding];
+
+		for (const SlotRange& range : CoalesceSlots(std::move(descriptorArray.dirtySlots))) {
+			// The infos are stored by slot, so a range of slots is already a contiguous array.
+			VkWriteDescriptorSet descriptorWrite{
+				.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+				.dstSet = m_descriptorSet,
+				.dstBinding = binding,
+				.dstArrayElement = range.firstSlot,
+				.descriptorCount = range.count,
+				.descriptorType = descriptorArray.type
+			};
+
+			if (descriptorArray.type == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+				descriptorWrite.pBufferInfo = &m_bufferInfos[range.firstSlot];
+			else if (descriptorArray.type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE)
+				descriptorWrite.pImageInfo = &m_sampledImageInfos[range.firstSlot];
+			else
+				descriptorWrite.pImageInfo = &m_storageImageInfos[range.firstSlot];
+
+			descriptorWrites.emplace_back(descriptorWrite);
+			descriptorCount += range.count;
+		}
+
+		descriptorArray.dirtySlots.clear();
+	}
+
+	if (!std::empty(descriptorWrites))
+		vkUpdateDescriptorSets(
+			device, static_cast<std::uint32_t>(std::size(descriptorWrites)),
+			std::data(descriptorWrites), 0u, nullptr
+		);
+
+	return descriptorCount;
+}
+
+VkDescriptorSetLayout BindlessDescriptorTable::GetLayout() const noexcept {
+	return m_layout;
+}
+
+VkDescriptorSet BindlessDescriptorTable::GetDescriptorSet() const noexcept {
+	return m_descriptorSet;
+}
+
+std::uint32_t BindlessDescriptorTable::GetCapacity(BindlessType type) const noexcept {
+	return m_arrays[static_cast<size_t>(type)].slotAllocator.GetCapacity();
+}
+
+std::uint32_t BindlessDescriptorTable::GetUsedCount(BindlessType type) const noexcept {
+	return m_arrays[static_cast<size_t>(type)].slotAllocator.GetUsedCount();
+}
+
+size_t BindlessDescriptorTable::GetPendingSlotCount() const noexcept {
+	size_t pendingSlotCount = 0u;
+
+	for (const DescriptorArray& descriptorArray : m_arrays)
+		pendingSlotCount += std::size(descriptorArray.dirtySlots);
+
+	return pendingSlotCount;
+}
+
+BindlessDescriptorTable::DescriptorArray& BindlessDescriptorTable::GetArray(
+	BindlessType type
+) noexcept {
+	return m_arrays[static_cast<size_t>(type)];
+}
+
+bool BindlessDescriptorTable::IsSupported(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES
+	};
+
+	VkPhysicalDeviceFeatures2 features{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext = &indexingFeatures
+	};
+
+	vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+	return indexingFeatures.descriptorBindingPartiallyBound
+		&& indexingFeatures.descriptorBindingUpdateUnusedWhilePending
+		&& indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind
+		&& indexingFeatures.descriptorBindingSampledImageUpdateAfterBind
+		&& indexingFeatures.descriptorBindingStorageImageUpdateAfterBind;
+}
+
+std::array<std::uint32_t, 3u> BindlessDescriptorTable::ClampCounts(
+	VkPhysicalDevice physicalDevice, const Args& arguments
+) noexcept {
+	VkPhysicalDeviceDescriptorIndexingProperties indexingProperties{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES
+	};
+
+	VkPhysicalDeviceProperties2 properties{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2,
+		.pNext = &indexingProperties
+	};
+
+	vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+	return {
+		std::min({
+			arguments.storageBufferCount,
+			indexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+			indexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers
+		}),
+		std::min({
+			arguments.sampledImageCount,
+			indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages,
+			indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages
+		}),
+		std::min({
+			arguments.storageImageCount,
+			indexingProperties.maxDescriptorSetUpdateAfterBindStorageImages,
+			indexingProperties.maxPerStageDescriptorUpdateAfterBindStorageImages
+		})
+	};
+}
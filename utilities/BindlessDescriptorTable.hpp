@@ -0,0 +1,106 @@
+#ifndef BINDLESS_DESCRIPTOR_TABLE_HPP_
+#define BINDLESS_DESCRIPTOR_TABLE_HPP_
+#include <vulkan/vulkan.hpp>
+#include <DescriptorSlotAllocator.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// The binding of each array in the set.
+enum class BindlessType : std::uint32_t {
+	StorageBuffer,
+	SampledImage,
+	StorageImage
+};
+
+// A single descriptor set of large UPDATE_AFTER_BIND and PARTIALLY_BOUND arrays, which shaders
+// index into with the slots this returns. Adding a resource only writes its own slot, so
+// nothing has to be rebound or recreated. The set can be bound alongside the graphics and
+// compute DescriptorSetManager sets, with the stages passed in Args. The device needs the
+// descriptor indexing features IsSupported checks for to be enabled.
+class BindlessDescriptorTable {
+public:
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		VkShaderStageFlags stages;
+		std::uint32_t storageBufferCount;
+		std::uint32_t sampledImageCount;
+		std::uint32_t storageImageCount;
+	};
+
+public:
+	BindlessDescriptorTable(VkDevice device, const Args& arguments) noexcept;
+	~BindlessDescriptorTable() noexcept;
+
+	BindlessDescriptorTable(const BindlessDescriptorTable&) = delete;
+	BindlessDescriptorTable& operator=(const BindlessDescriptorTable&) = delete;
+
+	[[nodiscard]]
+	std::optional<std::uint32_t> AddStorageBuffer(
+		const VkDescriptorBufferInfo& bufferInfo
+	) noexcept;
+	[[nodiscard]]
+	std::optional<std::uint32_t> AddSampledImage(const VkDescriptorImageInfo& imageInfo) noexcept;
+	[[nodiscard]]
+	std::optional<std::uint32_t> AddStorageImage(const VkDescriptorImageInfo& imageInfo) noexcept;
+
+	void UpdateStorageBuffer(
+		std::uint32_t slot, const VkDescriptorBufferInfo& bufferInfo
+	) noexcept;
+	void UpdateSampledImage(std::uint32_t slot, const VkDescriptorImageInfo& imageInfo) noexcept;
+	void UpdateStorageImage(std::uint32_t slot, const VkDescriptorImageInfo& imageInfo) noexcept;
+
+	// A freed slot isn't written, partially bound slots only have to be valid when used.
+	void Remove(BindlessType type, std::uint32_t slot) noexcept;
+
+	// Writes the changed slots with a single vkUpdateDescriptorSets call and returns how many
+	// descriptors were written. Slots which aren't used by a pending submission can be updated
+	// while the set is bound.
+	std::uint32_t Flush(VkDevice device);
+
+	[[nodiscard]]
+	VkDescriptorSetLayout GetLayout() const noexcept;
+	[[nodiscard]]
+	VkDescriptorSet GetDescriptorSet() const noexcept;
+	[[nodiscard]]
+	std::uint32_t GetCapacity(BindlessType type) const noexcept;
+	[[nodiscard]]
+	std::uint32_t GetUsedCount(BindlessType type) const noexcept;
+	[[nodiscard]]
+	size_t GetPendingSlotCount() const noexcept;
+
+	[[nodiscard]]
+	static bool IsSupported(VkPhysicalDevice physicalDevice) noexcept;
+
+private:
+	struct DescriptorArray {
+		VkDescriptorType type;
+		DescriptorSlotAllocator slotAllocator;
+		std::vector<std::uint32_t> dirtySlots;
+	};
+
+private:
+	BindlessDescriptorTable(
+		VkDevice device, const Args& arguments, const std::array<std::uint32_t, 3u>& counts
+	) noexcept;
+
+	[[nodiscard]]
+	DescriptorArray& GetArray(BindlessType type) noexcept;
+
+	[[nodiscard]]
+	static std::array<std::uint32_t, 3u> ClampCounts(
+		VkPhysicalDevice physicalDevice, const Args& arguments
+	) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkDescriptorSetLayout m_layout;
+	VkDescriptorPool m_pool;
+	VkDescriptorSet m_descriptorSet;
+	std::array<DescriptorArray, 3u> m_arrays;
+	std::vector<VkDescriptorBufferInfo> m_bufferInfos;
+	std::vector<VkDescriptorImageInfo> m_sampledImageInfos;
+	std::vector<VkDescriptorImageInfo> m_storageImageInfos;
+};
+#endif
@@ -0,0 +1,90 @@
+#include <ChromeTrace.hpp>
+#include <JSONEscape.hpp>
+#include <iomanip>
+#include <sstream>
+
+ChromeTrace::ChromeTrace() noexcept : m_origin{ Clock::now() } {}
+
+void ChromeTrace::AddEvent(TraceEvent event) {
+	m_events.emplace_back(std::move(event));
+}
+
+void ChromeTrace::SetThreadName(
+	std::uint32_t processId, std::uint32_t threadId, std::string name
+) {
+	m_threadNames.emplace_back(ThreadName{
+		.processId = processId, .threadId = threadId, .name = std::move(name)
+	});
+}
+
+double ChromeTrace::ToTraceTime(Clock::time_point timePoint) const noexcept {
+	return std::chrono::duration<double, std::micro>{ timePoint - m_origin }.count();
+}
+
+const std::vector<TraceEvent>& ChromeTrace::GetEvents() const noexcept {
+	return m_events;
+}
+
+std::string ChromeTrace::ToJSON() const {
+	std::ostringstream json{};
+	// The viewers want microseconds, a nanosecond precision is plenty for GPU scopes.
+	json << std::fixed << std::setprecision(3);
+
+	json << "{\"traceEvents\":[";
+
+	bool firstEvent = true;
+	auto separator = [&firstEvent] {
+		const char* text = firstEvent ? "" : ",";
+		firstEvent = false;
+
+		return text;
+	};
+
+	for (const ThreadName& threadName : m_threadNames)
+		json << separator()
+			<< "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << threadName.processId
+			<< ",\"tid\":" << threadName.threadId
+			<< ",\"args\":{\"name\":\"" << EscapeJSON(threadName.name) << "\"}}";
+
+	const std::pair<std::uint32_t, const char*> processNames[]{
+		{ cpuProcessId, "CPU" }, { gpuProcessId, "GPU" }
+	};
+
+	for (const auto& [processId, processName] : processNames)
+		json << separator()
+			<< "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << processId
+			<< ",\"args\":{\"name\":\"" << processName << "\"}}";
+
+	for (const TraceEvent& event : m_events)
+		json << separator()
+			<< "{\"name\":\"" << EscapeJSON(event.name) << '"'
+			<< ",\"cat\":\"" << EscapeJSON(event.category) << '"'
+			<< ",\"ph\":\"X\",\"pid\":" << event.processId
+			<< ",\"tid\":" << event.threadId
+			<< ",\"ts\":" << event.startUs
+			<< ",\"dur\":" << event.durationUs << '}';
+
+	json << "],\"displayTimeUnit\":\"ms\"}";
+
+	return json.str();
+}
+
+CpuTraceScope::CpuTraceScope(
+	ChromeTrace& trace, std::string name, std::uint32_t threadId
+) noexcept
+	: m_trace{ trace }, m_name{ std::move(name) }, m_threadId{ threadId },
+	m_startTime{ ChromeTrace::Clock::now() } {}
+
+CpuTraceScope::~CpuTraceScope() noexcept {
+	const ChromeTrace::Clock::time_point endTime = ChromeTrace::Clock::now();
+	const double startUs = m_trace.ToTraceTime(m_startTime);
+
+	m_trace.AddEvent(TraceEvent{
+		.name = std::move(m_name),
+		.category = "cpu",
+		.processId = ChromeTrace::cpuProcessId,
+		.threadId = m_threadId,
+		.startUs = startUs,
+		.durationUs = m_trace.ToTraceTime(endTime) - startUs
+	});
+}
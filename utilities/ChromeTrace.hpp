@@ -0,0 +1,70 @@
+#ifndef CHROME_TRACE_HPP_
+#define CHROME_TRACE_HPP_
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct TraceEvent {
+	std::string name;
+	std::string category;
+	std::uint32_t processId;
+	std::uint32_t threadId;
+	// From the origin of the trace.
+	double startUs;
+	double durationUs;
+};
+
+// Collects complete events and writes them in the Chrome trace event format, which
+// chrome://tracing and Perfetto open. The CPU and the GPU are shown as two processes, with a
+// thread per CPU thread or per queue, on one timeline that starts when the trace is created.
+class ChromeTrace {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr std::uint32_t cpuProcessId = 1u;
+	static constexpr std::uint32_t gpuProcessId = 2u;
+
+public:
+	ChromeTrace() noexcept;
+
+	void AddEvent(TraceEvent event);
+	void SetThreadName(std::uint32_t processId, std::uint32_t threadId, std::string name);
+
+	[[nodiscard]]
+	double ToTraceTime(Clock::time_point timePoint) const noexcept;
+	[[nodiscard]]
+	const std::vector<TraceEvent>& GetEvents() const noexcept;
+
+	[[nodiscard]]
+	std::string ToJSON() const;
+
+private:
+	struct ThreadName {
+		std::uint32_t processId;
+		std::uint32_t threadId;
+		std::string name;
+	};
+
+private:
+	Clock::time_point m_origin;
+	std::vector<TraceEvent> m_events;
+	std::vector<ThreadName> m_threadNames;
+};
+
+// Adds an event for the CPU work of its lifetime.
+class CpuTraceScope {
+public:
+	CpuTraceScope(ChromeTrace& trace, std::string name, std::uint32_t threadId = 0u) noexcept;
+	~CpuTraceScope() noexcept;
+
+	CpuTraceScope(const CpuTraceScope&) = delete;
+	CpuTraceScope& operator=(const CpuTraceScope&) = delete;
+
+private:
+	ChromeTrace& m_trace;
+	std::string m_name;
+	std::uint32_t m_threadId;
+	ChromeTrace::Clock::time_point m_startTime;
+};
+#endif
@@ -0,0 +1,126 @@
+#include <DeferredDestructionQueue.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+DeferredDestructionQueue::DeferredDestructionQueue(VkDevice device) noexcept
+	: m_deviceRef{ device }, m_pendingMemorySize{ 0u } {}
+
+DeferredDestructionQueue::~DeferredDestructionQueue() noexcept {
+	// Expects the device to be idle by now, like the other destructors.
+	Flush(m_deviceRef);
+}
+
+template<typename Pending>
+void DeferredDestructionQueue::InsertSorted(std::deque<Pending>& queue, Pending&& pending) {
+	if (std::empty(queue) || queue.back().lastUseValue <= pending.lastUseValue) {
+		queue.emplace_back(std::move(pending));
+
+		return;
+	}
+
+	// After the ones with the same value, so objects are destroyed in the order they came.
+	auto position = std::ranges::upper_bound(
+		queue, pending.lastUseValue, {}, &Pending::lastUseValue
+	);
+	queue.insert(position, std::move(pending));
+}
+
+void DeferredDestructionQueue::Enqueue(std::uint64_t lastUseValue, Deleter deleter) {
+	InsertSorted(
+		m_objects, PendingObject{ .lastUseValue = lastUseValue, .deleter = std::move(deleter) }
+	);
+}
+
+void DeferredDestructionQueue::EnqueueBuffer(std::uint64_t lastUseValue, VkBuffer buffer) {
+	Enqueue(lastUseValue, [buffer](VkDevice device) {
+		vkDestroyBuffer(device, buffer, nullptr);
+	});
+}
+
+void DeferredDestructionQueue::EnqueueImage(std::uint64_t lastUseValue, VkImage image) {
+	Enqueue(lastUseValue, [image](VkDevice device) {
+		vkDestroyImage(device, image, nullptr);
+	});
+}
+
+void DeferredDestructionQueue::EnqueueImageView(
+	std::uint64_t lastUseValue, VkImageView imageView
+) {
+	Enqueue(lastUseValue, [imageView](VkDevice device) {
+		vkDestroyImageView(device, imageView, nullptr);
+	});
+}
+
+void DeferredDestructionQueue::EnqueuePipeline(std::uint64_t lastUseValue, VkPipeline pipeline) {
+	Enqueue(lastUseValue, [pipeline](VkDevice device) {
+		vkDestroyPipeline(device, pipeline, nullptr);
+	});
+}
+
+void DeferredDestructionQueue::EnqueueMemory(
+	std::uint64_t lastUseValue, DeviceMemoryPool& pool, const MemoryAllocation& allocation
+) {
+	InsertSorted(
+		m_allocations,
+		PendingMemory{ .lastUseValue = lastUseValue, .pool = &pool, .allocation = allocation }
+	);
+
+	m_pendingMemorySize += allocation.size;
+}
+
+size_t DeferredDestructionQueue::Collect(VkDevice device, std::uint64_t completedValue) {
+	size_t releasedCount = 0u;
+
+	// The objects first, a buffer has to be gone before its memory can be reused.
+	while (!std::empty(m_objects) && m_objects.front().lastUseValue <= completedValue) {
+		m_objects.front().deleter(device);
+		m_objects.pop_front();
+
+		++releasedCount;
+	}
+
+	auto firstPending = std::ranges::find_if(
+		m_allocations,
+		[completedValue](const PendingMemory& pending) noexcept {
+			return pending.lastUseValue > completedValue;
+		}
+	);
+
+	if (firstPending == std::begin(m_allocations))
+		return releasedCount;
+
+	std::vector<PendingMemory> releasedMemory{ std::begin(m_allocations), firstPending };
+	m_allocations.erase(std::begin(m_allocations), firstPending);
+
+	std::ranges::stable_sort(releasedMemory, {}, &PendingMemory::pool);
+
+	std::vector<MemoryAllocation> poolAllocations;
+	for (auto poolBegin = std::begin(releasedMemory); poolBegin != std::end(releasedMemory);) {
+		DeviceMemoryPool* pool = poolBegin->pool;
+
+		poolAllocations.clear();
+		auto poolEnd = poolBegin;
+		for (; poolEnd != std::end(releasedMemory) && poolEnd->pool == pool; ++poolEnd) {
+			poolAllocations.emplace_back(poolEnd->allocation);
+			m_pendingMemorySize -= poolEnd->allocation.size;
+		}
+
+		pool->Free(poolAllocations);
+		poolBegin = poolEnd;
+	}
+
+	return releasedCount + std::size(releasedMemory);
+}
+
+size_t DeferredDestructionQueue::Flush(VkDevice device) {
+	return Collect(device, std::numeric_limits<std::uint64_t>::max());
+}
+
+size_t DeferredDestructionQueue::GetPendingCount() const noexcept {
+	return std::size(m_objects) + std::size(m_allocations);
+}
+
+VkDeviceSize DeferredDestructionQueue::GetPendingMemorySize() const noexcept {
+	return m_pendingMemorySize;
+}
@@ -0,0 +1,70 @@
+#ifndef DEFERRED_DESTRUCTION_QUEUE_HPP_
+#define DEFERRED_DESTRUCTION_QUEUE_HPP_
+#include <vulkan/vulkan.hpp>
+#include <DeviceMemoryPool.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+// Keeps objects which were replaced or dropped while frames are in flight until the GPU is done
+// with them. Everything is tagged with the value of the last submission that used it, either a
+// frame number or a QueueTimeline value, and Collect destroys what the completed value has
+// passed. The values should be on a single timeline; objects used on several queues take the
+// value of the queue that finishes last. Nothing here is thread safe.
+class DeferredDestructionQueue {
+public:
+	using Deleter = std::function<void(VkDevice)>;
+
+public:
+	explicit DeferredDestructionQueue(VkDevice device) noexcept;
+	~DeferredDestructionQueue() noexcept;
+
+	DeferredDestructionQueue(const DeferredDestructionQueue&) = delete;
+	DeferredDestructionQueue& operator=(const DeferredDestructionQueue&) = delete;
+
+	void Enqueue(std::uint64_t lastUseValue, Deleter deleter);
+	void EnqueueBuffer(std::uint64_t lastUseValue, VkBuffer buffer);
+	void EnqueueImage(std::uint64_t lastUseValue, VkImage image);
+	void EnqueueImageView(std::uint64_t lastUseValue, VkImageView imageView);
+	void EnqueuePipeline(std::uint64_t lastUseValue, VkPipeline pipeline);
+	// The allocation goes back to the pool after the objects with the same value are destroyed.
+	void EnqueueMemory(
+		std::uint64_t lastUseValue, DeviceMemoryPool& pool, const MemoryAllocation& allocation
+	);
+
+	// Destroys every object whose value is at most completedValue, then returns their memory
+	// with one Free per pool. Returns the number of objects and allocations released.
+	size_t Collect(VkDevice device, std::uint64_t completedValue);
+	// Releases everything regardless of its value, once the device is idle.
+	size_t Flush(VkDevice device);
+
+	[[nodiscard]]
+	size_t GetPendingCount() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetPendingMemorySize() const noexcept;
+
+private:
+	struct PendingObject {
+		std::uint64_t lastUseValue;
+		Deleter deleter;
+	};
+
+	struct PendingMemory {
+		std::uint64_t lastUseValue;
+		DeviceMemoryPool* pool;
+		MemoryAllocation allocation;
+	};
+
+private:
+	// Both queues are kept sorted by value. Values usually come in increasing order, so
+	// inserting is a push_back and collecting pops from the front.
+	template<typename Pending>
+	static void InsertSorted(std::deque<Pending>& queue, Pending&& pending);
+
+private:
+	VkDevice m_deviceRef;
+	std::deque<PendingObject> m_objects;
+	std::deque<PendingMemory> m_allocations;
+	VkDeviceSize m_pendingMemorySize;
+};
+#endif
@@ -0,0 +1,55 @@
+#include <DescriptorSlotAllocator.hpp>
+#include <algorithm>
+
+DescriptorSlotAllocator::DescriptorSlotAllocator(std::uint32_t capacity) noexcept
+	: m_capacity{ capacity }, m_nextSlot{ 0u }, m_usedSlots(capacity, false) {}
+
+std::optional<std::uint32_t> DescriptorSlotAllocator::Allocate() noexcept {
+	if (!std::empty(m_freeSlots)) {
+		const std::uint32_t slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+		m_usedSlots[slot] = true;
+
+		return slot;
+	}
+
+	if (m_nextSlot == m_capacity)
+		return {};
+
+	m_usedSlots[m_nextSlot] = true;
+
+	return m_nextSlot++;
+}
+
+void DescriptorSlotAllocator::Free(std::uint32_t slot) noexcept {
+	if (slot >= m_capacity || !m_usedSlots[slot])
+		return;
+
+	m_usedSlots[slot] = false;
+	m_freeSlots.emplace_back(slot);
+}
+
+std::uint32_t DescriptorSlotAllocator::GetCapacity() const noexcept {
+	return m_capacity;
+}
+
+std::uint32_t DescriptorSlotAllocator::GetUsedCount() const noexcept {
+	return m_nextSlot - static_cast<std::uint32_t>(std::size(m_freeSlots));
+}
+
+std::vector<SlotRange> CoalesceSlots(std::vector<std::uint32_t> slots) {
+	std::ranges::sort(slots);
+	const auto duplicates = std::ranges::unique(slots);
+	slots.erase(std::begin(duplicates), std::end(duplicates));
+
+	std::vector<SlotRange> ranges;
+
+	for (std::uint32_t slot : slots) {
+		if (!std::empty(ranges) && ranges.back().firstSlot + ranges.back().count == slot)
+			++ranges.back().count;
+		else
+			ranges.emplace_back(SlotRange{ .firstSlot = slot, .count = 1u });
+	}
+
+	return ranges;
+}
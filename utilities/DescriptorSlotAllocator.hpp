@@ -0,0 +1,39 @@
+#ifndef DESCRIPTOR_SLOT_ALLOCATOR_HPP_
+#define DESCRIPTOR_SLOT_ALLOCATOR_HPP_
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// Hands out array elements of a bindless descriptor binding. Freed slots are reused first, most
+// recently freed first, so the highest slot in use stays low.
+class DescriptorSlotAllocator {
+public:
+	DescriptorSlotAllocator(std::uint32_t capacity) noexcept;
+
+	[[nodiscard]]
+	std::optional<std::uint32_t> Allocate() noexcept;
+	// A slot which isn't in use is ignored, so a second free can't hand it out twice.
+	void Free(std::uint32_t slot) noexcept;
+
+	[[nodiscard]]
+	std::uint32_t GetCapacity() const noexcept;
+	[[nodiscard]]
+	std::uint32_t GetUsedCount() const noexcept;
+
+private:
+	std::uint32_t m_capacity;
+	std::uint32_t m_nextSlot;
+	std::vector<std::uint32_t> m_freeSlots;
+	std::vector<bool> m_usedSlots;
+};
+
+struct SlotRange {
+	std::uint32_t firstSlot;
+	std::uint32_t count;
+};
+
+// Sorts the changed slots and merges the consecutive ones, so each range can be written with a
+// single VkWriteDescriptorSet. Duplicates are only written once.
+[[nodiscard]]
+std::vector<SlotRange> CoalesceSlots(std::vector<std::uint32_t> slots);
+#endif
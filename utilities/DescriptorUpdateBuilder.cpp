@@ -0,0 +1,129 @@
+#include <DescriptorUpdateBuilder.hpp>
+#include <algorithm>
+#include <type_traits>
+
+DescriptorUpdateBuilder::DescriptorUpdateBuilder(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device }, m_flushCount{ 0u } {
+	// Nothing is ever added past these, so the info pointers in the writes stay valid.
+	m_writes.reserve(std::max<size_t>(arguments.writeCapacity, 1u));
+	m_bufferInfos.reserve(std::max<size_t>(arguments.bufferInfoCapacity, 1u));
+	m_imageInfos.reserve(std::max<size_t>(arguments.imageInfoCapacity, 1u));
+}
+
+void DescriptorUpdateBuilder::AddBuffer(
+	VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+	VkDescriptorType type, const VkDescriptorBufferInfo& bufferInfo
+) noexcept {
+	AddDescriptor(descriptorSet, binding, arrayElement, type, bufferInfo, m_bufferInfos);
+}
+
+void DescriptorUpdateBuilder::AddBuffers(
+	VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t firstArrayElement,
+	VkDescriptorType type, std::span<const VkDescriptorBufferInfo> bufferInfos
+) noexcept {
+	for (size_t index = 0u; index < std::size(bufferInfos); ++index)
+		AddDescriptor(
+			descriptorSet, binding, firstArrayElement + static_cast<std::uint32_t>(index), type,
+			bufferInfos[index], m_bufferInfos
+		);
+}
+
+void DescriptorUpdateBuilder::AddImage(
+	VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+	VkDescriptorType type, const VkDescriptorImageInfo& imageInfo
+) noexcept {
+	AddDescriptor(descriptorSet, binding, arrayElement, type, imageInfo, m_imageInfos);
+}
+
+void DescriptorUpdateBuilder::AddImages(
+	VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t firstArrayElement,
+	VkDescriptorType type, std::span<const VkDescriptorImageInfo> imageInfos
+) noexcept {
+	for (size_t index = 0u; index < std::size(imageInfos); ++index)
+		AddDescriptor(
+			descriptorSet, binding, firstArrayElement + static_cast<std::uint32_t>(index), type,
+			imageInfos[index], m_imageInfos
+		);
+}
+
+template<typename DescriptorInfo>
+void DescriptorUpdateBuilder::AddDescriptor(
+	VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+	VkDescriptorType type, const DescriptorInfo& descriptorInfo,
+	std::vector<DescriptorInfo>& descriptorInfos
+) noexcept {
+	if (std::size(descriptorInfos) == descriptorInfos.capacity())
+		Flush();
+
+	DescriptorInfo* info = &descriptorInfos.emplace_back(descriptorInfo);
+
+	if (!std::empty(m_writes)) {
+		VkWriteDescriptorSet& lastWrite = m_writes.back();
+
+		DescriptorInfo const* lastInfo = nullptr;
+		if constexpr (std::is_same_v<DescriptorInfo, VkDescriptorBufferInfo>)
+			lastInfo = lastWrite.pBufferInfo;
+		else
+			lastInfo = lastWrite.pImageInfo;
+
+		// Only the next element of the same binding, with its info right after the last one.
+		if (lastInfo && lastWrite.dstSet == descriptorSet && lastWrite.dstBinding == binding
+			&& lastWrite.descriptorType == type
+			&& lastWrite.dstArrayElement + lastWrite.descriptorCount == arrayElement
+			&& lastInfo + lastWrite.descriptorCount == info) {
+			++lastWrite.descriptorCount;
+
+			return;
+		}
+	}
+
+	if (std::size(m_writes) == m_writes.capacity()) {
+		// The info was already added, so it has to be flushed with its own write.
+		const DescriptorInfo pendingInfo = descriptorInfos.back();
+		descriptorInfos.pop_back();
+
+		Flush();
+
+		info = &descriptorInfos.emplace_back(pendingInfo);
+	}
+
+	VkWriteDescriptorSet descriptorWrite{
+		.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+		.dstSet = descriptorSet,
+		.dstBinding = binding,
+		.dstArrayElement = arrayElement,
+		.descriptorCount = 1u,
+		.descriptorType = type
+	};
+
+	if constexpr (std::is_same_v<DescriptorInfo, VkDescriptorBufferInfo>)
+		descriptorWrite.pBufferInfo = info;
+	else
+		descriptorWrite.pImageInfo = info;
+
+	m_writes.emplace_back(descriptorWrite);
+}
+
+std::uint32_t DescriptorUpdateBuilder::Flush() noexcept {
+	const auto writeCount = static_cast<std::uint32_t>(std::size(m_writes));
+
+	if (writeCount != 0u) {
+		vkUpdateDescriptorSets(m_deviceRef, writeCount, std::data(m_writes), 0u, nullptr);
+		++m_flushCount;
+	}
+
+	// Clearing keeps the capacity.
+	m_writes.clear();
+	m_bufferInfos.clear();
+	m_imageInfos.clear();
+
+	return writeCount;
+}
+
+size_t DescriptorUpdateBuilder::GetPendingWriteCount() const noexcept {
+	return std::size(m_writes);
+}
+
+size_t DescriptorUpdateBuilder::GetFlushCount() const noexcept {
+	return m_flushCount;
+}
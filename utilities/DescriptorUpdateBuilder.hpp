@@ -0,0 +1,64 @@
+#ifndef DESCRIPTOR_UPDATE_BUILDER_HPP_
+#define DESCRIPTOR_UPDATE_BUILDER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Gathers descriptor writes into arrays which are allocated once, at construction, and
+// submits them with a single vkUpdateDescriptorSets call. A write which continues the previous
+// one, the next elements of the same binding, is merged into it. When an array fills up, the
+// pending writes are flushed early instead of growing it, so adding never allocates.
+class DescriptorUpdateBuilder {
+public:
+	struct Args {
+		size_t writeCapacity;
+		size_t bufferInfoCapacity;
+		size_t imageInfoCapacity;
+	};
+
+public:
+	DescriptorUpdateBuilder(VkDevice device, const Args& arguments);
+
+	void AddBuffer(
+		VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+		VkDescriptorType type, const VkDescriptorBufferInfo& bufferInfo
+	) noexcept;
+	void AddBuffers(
+		VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t firstArrayElement,
+		VkDescriptorType type, std::span<const VkDescriptorBufferInfo> bufferInfos
+	) noexcept;
+	void AddImage(
+		VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+		VkDescriptorType type, const VkDescriptorImageInfo& imageInfo
+	) noexcept;
+	void AddImages(
+		VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t firstArrayElement,
+		VkDescriptorType type, std::span<const VkDescriptorImageInfo> imageInfos
+	) noexcept;
+
+	// Returns the number of VkWriteDescriptorSet submitted.
+	std::uint32_t Flush() noexcept;
+
+	[[nodiscard]]
+	size_t GetPendingWriteCount() const noexcept;
+	// Includes the early flushes.
+	[[nodiscard]]
+	size_t GetFlushCount() const noexcept;
+
+private:
+	template<typename DescriptorInfo>
+	void AddDescriptor(
+		VkDescriptorSet descriptorSet, std::uint32_t binding, std::uint32_t arrayElement,
+		VkDescriptorType type, const DescriptorInfo& descriptorInfo,
+		std::vector<DescriptorInfo>& descriptorInfos
+	) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	std::vector<VkWriteDescriptorSet> m_writes;
+	std::vector<VkDescriptorBufferInfo> m_bufferInfos;
+	std::vector<VkDescriptorImageInfo> m_imageInfos;
+	size_t m_flushCount;
+};
+#endif
@@ -0,0 +1,147 @@
+#include <DeviceAddressBufferView.hpp>
+
+DeviceAddressBufferView::DeviceAddressBufferView(VkDevice device) noexcept
+	: m_deviceRef{ device }, m_buffer{ VK_NULL_HANDLE }, m_subBufferSize{ 0u },
+	m_subAllocationSize{ 0u }, m_bufferSize{ 0u }, m_subAllocationCount{ 0u },
+	m_baseAddress{ 0u }, m_memoryPool{ nullptr }, m_allocation{} {}
+
+DeviceAddressBufferView::~DeviceAddressBufferView() noexcept {
+	vkDestroyBuffer(m_deviceRef, m_buffer, nullptr);
+
+	if (m_memoryPool && m_allocation)
+		m_memoryPool->Free(*m_allocation);
+}
+
+bool DeviceAddressBufferView::CreateResource(
+	VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize subBufferSize,
+	std::uint32_t subAllocationCount, VkBufferUsageFlags usageFlags
+) {
+	// A second buffer would leak the first one.
+	if (subAllocationCount == 0u || m_buffer != VK_NULL_HANDLE)
+		return false;
+
+	VkPhysicalDeviceProperties deviceProperties{};
+	vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+
+	const VkDeviceSize alignment = deviceProperties.limits.minStorageBufferOffsetAlignment;
+
+	m_subBufferSize = subBufferSize;
+	m_subAllocationSize = alignment > 1u ?
+		(subBufferSize + alignment - 1u) / alignment * alignment : subBufferSize;
+	// The last split doesn't need the padding.
+	m_bufferSize = m_subAllocationSize * (subAllocationCount - 1u) + subBufferSize;
+
+	VkBufferCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size = m_bufferSize,
+		.usage = usageFlags | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE
+	};
+
+	if (vkCreateBuffer(device, &createInfo, nullptr, &m_buffer) != VK_SUCCESS) {
+		m_buffer = VK_NULL_HANDLE;
+
+		return false;
+	}
+
+	m_subAllocationCount = subAllocationCount;
+
+	return true;
+}
+
+bool DeviceAddressBufferView::BindResourceToMemory(
+	VkDevice device, DeviceMemoryPool& memoryPool
+) {
+	// A buffer can only be bound once.
+	if (m_buffer == VK_NULL_HANDLE || m_allocation)
+		return false;
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(device, m_buffer, &requirements);
+
+	m_allocation = memoryPool.Allocate(device, requirements);
+
+	if (!m_allocation)
+		return false;
+
+	if (vkBindBufferMemory(device, m_buffer, m_allocation->memory, m_allocation->offset)
+		!= VK_SUCCESS) {
+		memoryPool.Free(*m_allocation);
+		m_allocation.reset();
+
+		return false;
+	}
+
+	m_memoryPool = &memoryPool;
+
+	VkBufferDeviceAddressInfo addressInfo{
+		.sType = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO,
+		.buffer = m_buffer
+	};
+
+	// The address doesn't change while the buffer is bound, so it is only queried once.
+	m_baseAddress = vkGetBufferDeviceAddress(device, &addressInfo);
+
+	return true;
+}
+
+VkDeviceAddress DeviceAddressBufferView::GetDeviceAddress(
+	std::uint32_t subAllocationIndex
+) const noexcept {
+	return m_baseAddress + GetSubAllocationOffset(subAllocationIndex);
+}
+
+std::vector<VkDeviceAddress> DeviceAddressBufferView::GetDeviceAddressSplit(
+	std::uint32_t splitCount
+) const {
+	std::vector<VkDeviceAddress> deviceAddresses;
+
+	if (splitCount > m_subAllocationCount)
+		return deviceAddresses;
+
+	for (std::uint32_t index = 0u; index < splitCount; ++index)
+		deviceAddresses.emplace_back(GetDeviceAddress(index));
+
+	return deviceAddresses;
+}
+
+void* DeviceAddressBufferView::GetCPUAddress(std::uint32_t subAllocationIndex) const noexcept {
+	if (!m_allocation || !m_allocation->cpuAddress)
+		return nullptr;
+
+	return static_cast<std::uint8_t*>(m_allocation->cpuAddress)
+		+ GetSubAllocationOffset(subAllocationIndex);
+}
+
+VkDeviceSize DeviceAddressBufferView::GetSubAllocationOffset(
+	std::uint32_t subAllocationIndex
+) const noexcept {
+	return m_subAllocationSize * subAllocationIndex;
+}
+
+VkDeviceSize DeviceAddressBufferView::GetSubBufferSize() const noexcept {
+	return m_subBufferSize;
+}
+
+VkDeviceSize DeviceAddressBufferView::GetBufferSize() const noexcept {
+	return m_bufferSize;
+}
+
+VkBuffer DeviceAddressBufferView::GetResource() const noexcept {
+	return m_buffer;
+}
+
+bool DeviceAddressBufferView::IsSupported(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceBufferDeviceAddressFeatures addressFeatures{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES
+	};
+
+	VkPhysicalDeviceFeatures2 features{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext = &addressFeatures
+	};
+
+	vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+	return addressFeatures.bufferDeviceAddress;
+}
@@ -0,0 +1,67 @@
+#ifndef DEVICE_ADDRESS_BUFFER_VIEW_HPP_
+#define DEVICE_ADDRESS_BUFFER_VIEW_HPP_
+#include <vulkan/vulkan.hpp>
+#include <DeviceMemoryPool.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+// The split buffer layout of VkResourceView, but reached through 64-bit GPU addresses instead
+// of descriptors. The addresses can be passed in push constants or stored in other buffers, so
+// shaders can follow pointers and nothing has to be written into a descriptor set. The buffer
+// is created with SHADER_DEVICE_ADDRESS usage and has to be bound to a pool created with
+// deviceAddress, and the device needs the bufferDeviceAddress feature enabled.
+class DeviceAddressBufferView {
+public:
+	explicit DeviceAddressBufferView(VkDevice device) noexcept;
+	~DeviceAddressBufferView() noexcept;
+
+	DeviceAddressBufferView(const DeviceAddressBufferView&) = delete;
+	DeviceAddressBufferView& operator=(const DeviceAddressBufferView&) = delete;
+
+	// The splits are aligned to minStorageBufferOffsetAlignment, like VkResourceView's. Returns
+	// false if there are no splits, the view already has a buffer or it couldn't be created.
+	[[nodiscard]]
+	bool CreateResource(
+		VkDevice device, VkPhysicalDevice physicalDevice, VkDeviceSize subBufferSize,
+		std::uint32_t subAllocationCount, VkBufferUsageFlags usageFlags
+	);
+	// The memory goes back to the pool when the view is destroyed. Returns false if there is no
+	// buffer, it is already bound, or it couldn't be allocated or bound.
+	[[nodiscard]]
+	bool BindResourceToMemory(VkDevice device, DeviceMemoryPool& memoryPool);
+
+	// Only valid after the buffer is bound.
+	[[nodiscard]]
+	VkDeviceAddress GetDeviceAddress(std::uint32_t subAllocationIndex) const noexcept;
+	// Empty if the buffer has fewer than splitCount sub allocations.
+	[[nodiscard]]
+	std::vector<VkDeviceAddress> GetDeviceAddressSplit(std::uint32_t splitCount) const;
+	// Null unless the pool's memory is host visible.
+	[[nodiscard]]
+	void* GetCPUAddress(std::uint32_t subAllocationIndex) const noexcept;
+
+	[[nodiscard]]
+	VkDeviceSize GetSubAllocationOffset(std::uint32_t subAllocationIndex) const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetSubBufferSize() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetBufferSize() const noexcept;
+	[[nodiscard]]
+	VkBuffer GetResource() const noexcept;
+
+	[[nodiscard]]
+	static bool IsSupported(VkPhysicalDevice physicalDevice) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkBuffer m_buffer;
+	VkDeviceSize m_subBufferSize;
+	VkDeviceSize m_subAllocationSize;
+	VkDeviceSize m_bufferSize;
+	std::uint32_t m_subAllocationCount;
+	VkDeviceAddress m_baseAddress;
+	DeviceMemoryPool* m_memoryPool;
+	std::optional<MemoryAllocation> m_allocation;
+};
+#endif
@@ -0,0 +1,183 @@
+#include <DeviceMemoryPool.hpp>
+#include <algorithm>
+#include <bit>
+
+DeviceMemoryPool::DeviceMemoryPool(VkDevice device, const Args& arguments) noexcept
+	: m_deviceRef{ device }, m_physicalDevice{ arguments.physicalDevice },
+	m_propertyFlags{ arguments.propertyFlags }, m_blockSize{ arguments.blockSize },
+	m_strategy{ arguments.strategy }, m_deviceAddress{ arguments.deviceAddress },
+	m_paddingSize{ 0u } {}
+
+DeviceMemoryPool::~DeviceMemoryPool() noexcept {
+	for (MemoryBlock& block : m_blocks)
+		vkFreeMemory(m_deviceRef, block.memory, nullptr);
+}
+
+std::optional<MemoryAllocation> DeviceMemoryPool::Allocate(
+	VkDevice device, const VkMemoryRequirements& requirements
+) noexcept {
+	// The memory type is picked with the first request, every resource placed in a pool must
+	// accept it.
+	if (!m_memoryTypeIndex)
+		m_memoryTypeIndex = FindMemoryTypeIndex(
+			m_physicalDevice, requirements.memoryTypeBits, m_propertyFlags
+		);
+
+	if (!m_memoryTypeIndex || !(requirements.memoryTypeBits & (1u << *m_memoryTypeIndex)))
+		return {};
+
+	auto allocateFromBlock = [&requirements, this](size_t blockIndex)
+		-> std::optional<MemoryAllocation> {
+		MemoryBlock& block = m_blocks[blockIndex];
+
+		const VkDeviceSize usedSize = block.allocator->GetUsedSize();
+
+		std::optional<VkDeviceSize> offset = block.allocator->Allocate(
+			requirements.size, requirements.alignment
+		);
+
+		if (!offset)
+			return {};
+
+		const VkDeviceSize paddingSize =
+			block.allocator->GetUsedSize() - usedSize - requirements.size;
+
+		m_paddingSize += paddingSize;
+
+		return MemoryAllocation{
+			.memory = block.memory,
+			.offset = *offset,
+			.size = requirements.size,
+			.paddingSize = paddingSize,
+			.blockIndex = blockIndex,
+			.cpuAddress = block.cpuAddress ?
+				static_cast<std::uint8_t*>(block.cpuAddress) + *offset : nullptr
+		};
+	};
+
+	for (size_t index = 0u; index < std::size(m_blocks); ++index)
+		if (auto allocation = allocateFromBlock(index))
+			return allocation;
+
+	// The buddy allocator only uses power of two sizes, so the block is rounded up.
+	VkDeviceSize newBlockSize = std::max(m_blockSize, requirements.size);
+	if (m_strategy == AllocatorStrategy::Buddy)
+		newBlockSize = std::bit_ceil(newBlockSize);
+
+	if (!AddBlock(device, newBlockSize))
+		return {};
+
+	return allocateFromBlock(std::size(m_blocks) - 1u);
+}
+
+void DeviceMemoryPool::Free(const MemoryAllocation& allocation) noexcept {
+	if (allocation.blockIndex < std::size(m_blocks)) {
+		m_blocks[allocation.blockIndex].allocator->Free(allocation.offset);
+		m_paddingSize -= allocation.paddingSize;
+	}
+}
+
+void DeviceMemoryPool::Free(std::span<const MemoryAllocation> allocations) noexcept {
+	std::vector<std::vector<VkDeviceSize>> blockOffsets(std::size(m_blocks));
+
+	for (const MemoryAllocation& allocation : allocations)
+		if (allocation.blockIndex < std::size(m_blocks)) {
+			blockOffsets[allocation.blockIndex].emplace_back(allocation.offset);
+			m_paddingSize -= allocation.paddingSize;
+		}
+
+	for (size_t index = 0u; index < std::size(m_blocks); ++index)
+		if (!std::empty(blockOffsets[index]))
+			m_blocks[index].allocator->Free(blockOffsets[index]);
+}
+
+void DeviceMemoryPool::Reset() noexcept {
+	for (MemoryBlock& block : m_blocks)
+		block.allocator->Reset();
+
+	m_paddingSize = 0u;
+}
+
+size_t DeviceMemoryPool::GetBlockCount() const noexcept {
+	return std::size(m_blocks);
+}
+
+VkDeviceSize DeviceMemoryPool::GetUsedSize() const noexcept {
+	VkDeviceSize usedSize = 0u;
+	for (const MemoryBlock& block : m_blocks)
+		usedSize += block.allocator->GetUsedSize();
+
+	return usedSize;
+}
+
+VkDeviceSize DeviceMemoryPool::GetReservedSize() const noexcept {
+	VkDeviceSize reservedSize = 0u;
+	for (const MemoryBlock& block : m_blocks)
+		reservedSize += block.allocator->GetSize();
+
+	return reservedSize;
+}
+
+VkDeviceSize DeviceMemoryPool::GetLargestFreeBlock() const noexcept {
+	VkDeviceSize largestFreeBlock = 0u;
+	for (const MemoryBlock& block : m_blocks)
+		largestFreeBlock = std::max(largestFreeBlock, block.allocator->GetLargestFreeBlock());
+
+	return largestFreeBlock;
+}
+
+HeapStats DeviceMemoryPool::GetStats(std::string name) const {
+	return HeapStats{
+		.name = std::move(name),
+		.reservedSize = GetReservedSize(),
+		.boundSize = GetUsedSize(),
+		.paddingSize = m_paddingSize,
+		.largestFreeBlock = GetLargestFreeBlock()
+	};
+}
+
+std::optional<std::uint32_t> DeviceMemoryPool::FindMemoryTypeIndex(
+	VkPhysicalDevice physicalDevice, std::uint32_t memoryTypeBits,
+	VkMemoryPropertyFlags propertyFlags
+) noexcept {
+	VkPhysicalDeviceMemoryProperties memoryProperties{};
+	vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+	for (std::uint32_t index = 0u; index < memoryProperties.memoryTypeCount; ++index)
+		if ((memoryTypeBits & (1u << index))
+			&& (memoryProperties.memoryTypes[index].propertyFlags & propertyFlags)
+			== propertyFlags)
+			return index;
+
+	return {};
+}
+
+bool DeviceMemoryPool::AddBlock(VkDevice device, VkDeviceSize blockSize) noexcept {
+	VkMemoryAllocateFlagsInfo allocFlagsInfo{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO,
+		.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT
+	};
+
+	VkMemoryAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.pNext = m_deviceAddress ? &allocFlagsInfo : nullptr,
+		.allocationSize = blockSize,
+		.memoryTypeIndex = *m_memoryTypeIndex
+	};
+
+	VkDeviceMemory memory = VK_NULL_HANDLE;
+	if (vkAllocateMemory(device, &allocInfo, nullptr, &memory) != VK_SUCCESS)
+		return false;
+
+	void* cpuAddress = nullptr;
+	if (m_propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+		vkMapMemory(device, memory, 0u, VK_WHOLE_SIZE, 0u, &cpuAddress);
+
+	m_blocks.emplace_back(MemoryBlock{
+		.memory = memory,
+		.allocator = CreateSubAllocator(m_strategy, blockSize),
+		.cpuAddress = cpuAddress
+	});
+
+	return true;
+}
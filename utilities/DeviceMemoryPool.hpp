@@ -0,0 +1,96 @@
+#ifndef DEVICE_MEMORY_POOL_HPP_
+#define DEVICE_MEMORY_POOL_HPP_
+#include <vulkan/vulkan.hpp>
+#include <SubAllocator.hpp>
+#include <MemoryStats.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+struct MemoryAllocation {
+	VkDeviceMemory memory;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+	// What the alignment and the strategy's rounding added in front of or after the allocation.
+	VkDeviceSize paddingSize;
+	size_t blockIndex;
+	// Only set when the memory is host visible.
+	void* cpuAddress;
+};
+
+// A heap of one memory type, made of VkDeviceMemory blocks which are each placed into by a
+// SubAllocator of the chosen strategy. A new block is allocated when none of the existing ones
+// has space, and allocations larger than the block size get a block of their own.
+class DeviceMemoryPool {
+public:
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		VkMemoryPropertyFlags propertyFlags;
+		VkDeviceSize blockSize;
+		AllocatorStrategy strategy;
+		// Allocates the blocks with the device address flag, for buffers created with
+		// SHADER_DEVICE_ADDRESS usage.
+		bool deviceAddress = false;
+	};
+
+public:
+	DeviceMemoryPool(VkDevice device, const Args& arguments) noexcept;
+	~DeviceMemoryPool() noexcept;
+
+	DeviceMemoryPool(const DeviceMemoryPool&) = delete;
+	DeviceMemoryPool& operator=(const DeviceMemoryPool&) = delete;
+
+	[[nodiscard]]
+	std::optional<MemoryAllocation> Allocate(
+		VkDevice device, const VkMemoryRequirements& requirements
+	) noexcept;
+	void Free(const MemoryAllocation& allocation) noexcept;
+	// Frees the allocations of each block with a single call to its allocator.
+	void Free(std::span<const MemoryAllocation> allocations) noexcept;
+	// Releases every allocation but keeps the blocks, for the per frame linear pools.
+	void Reset() noexcept;
+
+	[[nodiscard]]
+	size_t GetBlockCount() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetUsedSize() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetReservedSize() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetLargestFreeBlock() const noexcept;
+	// The padding is what the alignment and the strategy's rounding add to the live allocations.
+	// Freed Linear allocations still count as bound until Reset, but not as padding.
+	[[nodiscard]]
+	HeapStats GetStats(std::string name) const;
+
+	[[nodiscard]]
+	static std::optional<std::uint32_t> FindMemoryTypeIndex(
+		VkPhysicalDevice physicalDevice, std::uint32_t memoryTypeBits,
+		VkMemoryPropertyFlags propertyFlags
+	) noexcept;
+
+private:
+	struct MemoryBlock {
+		VkDeviceMemory memory;
+		std::unique_ptr<SubAllocator> allocator;
+		void* cpuAddress;
+	};
+
+private:
+	[[nodiscard]]
+	bool AddBlock(VkDevice device, VkDeviceSize blockSize) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkPhysicalDevice m_physicalDevice;
+	VkMemoryPropertyFlags m_propertyFlags;
+	VkDeviceSize m_blockSize;
+	AllocatorStrategy m_strategy;
+	bool m_deviceAddress;
+	std::optional<std::uint32_t> m_memoryTypeIndex;
+	VkDeviceSize m_paddingSize;
+	std::vector<MemoryBlock> m_blocks;
+};
+#endif
@@ -0,0 +1,84 @@
+#include <FrameDescriptorAllocator.hpp>
+#include <utility>
+
+FrameDescriptorAllocator::FrameDescriptorAllocator(VkDevice device, Args arguments)
+	: m_deviceRef{ device }, m_setsPerPool{ arguments.setsPerPool },
+	m_poolSizes{ std::move(arguments.poolSizes) }, m_frames(arguments.frameCount),
+	m_currentFrame{ 0u } {
+	for (FramePools& frame : m_frames)
+		frame.currentPool = 0u;
+}
+
+FrameDescriptorAllocator::~FrameDescriptorAllocator() noexcept {
+	for (FramePools& frame : m_frames)
+		for (VkDescriptorPool pool : frame.pools)
+			vkDestroyDescriptorPool(m_deviceRef, pool, nullptr);
+}
+
+void FrameDescriptorAllocator::BeginFrame(VkDevice device, size_t frameIndex) noexcept {
+	m_currentFrame = frameIndex;
+	FramePools& frame = m_frames[frameIndex];
+
+	// Only the pools which were used since the last reset have sets in them.
+	for (size_t index = 0u; index < std::size(frame.pools) && index <= frame.currentPool; ++index)
+		vkResetDescriptorPool(device, frame.pools[index], 0u);
+
+	frame.currentPool = 0u;
+}
+
+VkDescriptorSet FrameDescriptorAllocator::Allocate(
+	VkDevice device, VkDescriptorSetLayout layout
+) {
+	FramePools& frame = m_frames[m_currentFrame];
+
+	while (true) {
+		const bool newPool = frame.currentPool == std::size(frame.pools);
+
+		if (newPool) {
+			VkDescriptorPool pool = CreatePool(device);
+
+			if (pool == VK_NULL_HANDLE)
+				return VK_NULL_HANDLE;
+
+			frame.pools.emplace_back(pool);
+		}
+
+		VkDescriptorSetAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+			.descriptorPool = frame.pools[frame.currentPool],
+			.descriptorSetCount = 1u,
+			.pSetLayouts = &layout
+		};
+
+		VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+		const VkResult result = vkAllocateDescriptorSets(device, &allocInfo, &descriptorSet);
+
+		if (result == VK_SUCCESS)
+			return descriptorSet;
+
+		// An empty pool which can't fit the set never will, so don't keep creating them.
+		if (newPool
+			|| (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL))
+			return VK_NULL_HANDLE;
+
+		++frame.currentPool;
+	}
+}
+
+size_t FrameDescriptorAllocator::GetPoolCount(size_t frameIndex) const noexcept {
+	return std::size(m_frames[frameIndex].pools);
+}
+
+VkDescriptorPool FrameDescriptorAllocator::CreatePool(VkDevice device) const noexcept {
+	VkDescriptorPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.maxSets = m_setsPerPool,
+		.poolSizeCount = static_cast<std::uint32_t>(std::size(m_poolSizes)),
+		.pPoolSizes = std::data(m_poolSizes)
+	};
+
+	VkDescriptorPool pool = VK_NULL_HANDLE;
+	vkCreateDescriptorPool(device, &poolInfo, nullptr, &pool);
+
+	return pool;
+}
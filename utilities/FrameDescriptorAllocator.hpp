@@ -0,0 +1,53 @@
+#ifndef FRAME_DESCRIPTOR_ALLOCATOR_HPP_
+#define FRAME_DESCRIPTOR_ALLOCATOR_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <vector>
+
+// Transient descriptor sets which only live for a frame. Every frame in flight has its own
+// pools, and when a frame comes around again its pools are reset in bulk instead of freeing
+// the sets one by one. A frame gets another pool whenever its current one runs out, and keeps
+// it for the following frames.
+class FrameDescriptorAllocator {
+public:
+	struct Args {
+		std::uint32_t frameCount;
+		std::uint32_t setsPerPool;
+		std::vector<VkDescriptorPoolSize> poolSizes;
+	};
+
+public:
+	FrameDescriptorAllocator(VkDevice device, Args arguments);
+	~FrameDescriptorAllocator() noexcept;
+
+	FrameDescriptorAllocator(const FrameDescriptorAllocator&) = delete;
+	FrameDescriptorAllocator& operator=(const FrameDescriptorAllocator&) = delete;
+
+	// Only call once the GPU has finished the last use of frameIndex, after waiting on its fence.
+	void BeginFrame(VkDevice device, size_t frameIndex) noexcept;
+
+	// Returns VK_NULL_HANDLE if a new pool couldn't be created.
+	[[nodiscard]]
+	VkDescriptorSet Allocate(VkDevice device, VkDescriptorSetLayout layout);
+
+	[[nodiscard]]
+	size_t GetPoolCount(size_t frameIndex) const noexcept;
+
+private:
+	struct FramePools {
+		std::vector<VkDescriptorPool> pools;
+		size_t currentPool;
+	};
+
+private:
+	[[nodiscard]]
+	VkDescriptorPool CreatePool(VkDevice device) const noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	std::uint32_t m_setsPerPool;
+	std::vector<VkDescriptorPoolSize> m_poolSizes;
+	std::vector<FramePools> m_frames;
+	size_t m_currentFrame;
+};
+#endif
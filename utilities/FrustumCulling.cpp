@@ -0,0 +1,67 @@
+#include <FrustumCulling.hpp>
+#include <cmath>
+
+FrustumPlanes ExtractFrustumPlanes(const std::array<float, 16u>& viewProjection) noexcept {
+	auto row = [&viewProjection](size_t rowIndex) noexcept -> FrustumPlane {
+		return {
+			viewProjection[rowIndex], viewProjection[4u + rowIndex],
+			viewProjection[8u + rowIndex], viewProjection[12u + rowIndex]
+		};
+	};
+
+	auto combine = [](const FrustumPlane& lhs, const FrustumPlane& rhs, float sign) noexcept
+		-> FrustumPlane {
+		return {
+			lhs[0] + sign * rhs[0], lhs[1] + sign * rhs[1], lhs[2] + sign * rhs[2],
+			lhs[3] + sign * rhs[3]
+		};
+	};
+
+	const FrustumPlane row0 = row(0u);
+	const FrustumPlane row1 = row(1u);
+	const FrustumPlane row2 = row(2u);
+	const FrustumPlane row3 = row(3u);
+
+	// The near plane is z >= 0 instead of z >= -w.
+	FrustumPlanes planes{
+		combine(row3, row0, 1.f), combine(row3, row0, -1.f),
+		combine(row3, row1, 1.f), combine(row3, row1, -1.f),
+		row2, combine(row3, row2, -1.f)
+	};
+
+	for (FrustumPlane& plane : planes) {
+		const float length = std::sqrt(
+			plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]
+		);
+
+		if (length > 0.f)
+			for (float& component : plane)
+				component /= length;
+	}
+
+	return planes;
+}
+
+bool IsSphereVisible(const FrustumPlanes& planes, const std::array<float, 4u>& sphere) noexcept {
+	for (const FrustumPlane& plane : planes) {
+		const float distance = plane[0] * sphere[0] + plane[1] * sphere[1]
+			+ plane[2] * sphere[2] + plane[3];
+
+		if (distance < -sphere[3])
+			return false;
+	}
+
+	return true;
+}
+
+std::vector<std::uint32_t> CullObjects(
+	const FrustumPlanes& planes, std::span<const CullObject> objects
+) {
+	std::vector<std::uint32_t> visibleObjects;
+
+	for (size_t index = 0u; index < std::size(objects); ++index)
+		if (IsSphereVisible(planes, objects[index].sphere))
+			visibleObjects.emplace_back(static_cast<std::uint32_t>(index));
+
+	return visibleObjects;
+}
@@ -0,0 +1,50 @@
+#ifndef FRUSTUM_CULLING_HPP_
+#define FRUSTUM_CULLING_HPP_
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// A plane as (normal, distance), a point p is in front of it if dot(normal, p) + distance >= 0.
+using FrustumPlane = std::array<float, 4u>;
+// Left, right, bottom, top, near and far, all facing inwards.
+using FrustumPlanes = std::array<FrustumPlane, 6u>;
+
+// Laid out like the std430 struct of the culling shader.
+struct CullObject {
+	// Bounding sphere as center and radius.
+	std::array<float, 4u> sphere;
+	std::uint32_t indexCount;
+	std::uint32_t firstIndex;
+	std::int32_t vertexOffset;
+	// The task workgroups of the mesh shader path, usually the meshlet count divided by the
+	// task workgroup size.
+	std::uint32_t taskGroupCount;
+};
+static_assert(sizeof(CullObject) == 32u);
+
+// Push constants of the culling shader.
+struct CullConstants {
+	FrustumPlanes planes;
+	std::uint32_t objectCount;
+};
+static_assert(sizeof(CullConstants) <= 128u, "Doesn't fit in the guaranteed push constant size.");
+
+// Gribb and Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection
+// Matrix". The matrix is column major and the clip space depth goes from 0 to 1, like Vulkan.
+// The planes are normalised, so the signed distance to a sphere center can be compared with its
+// radius.
+[[nodiscard]]
+FrustumPlanes ExtractFrustumPlanes(const std::array<float, 16u>& viewProjection) noexcept;
+
+// Conservative, a sphere near a corner of the frustum can pass without intersecting it.
+[[nodiscard]]
+bool IsSphereVisible(const FrustumPlanes& planes, const std::array<float, 4u>& sphere) noexcept;
+
+// The CPU version of the culling shader. Returns the indices of the visible objects in order,
+// the shader writes the same set in any order.
+[[nodiscard]]
+std::vector<std::uint32_t> CullObjects(
+	const FrustumPlanes& planes, std::span<const CullObject> objects
+);
+#endif
@@ -0,0 +1,176 @@
+#include <GpuCullingPass.hpp>
+
+GpuCullingPass::GpuCullingPass(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device }, m_pipelineLayout{ VK_NULL_HANDLE }, m_pipeline{ VK_NULL_HANDLE },
+	m_output{ arguments.output }, m_drawFeaturesEnabled{ arguments.drawFeaturesEnabled },
+	m_drawMeshTasksIndirectCount{ nullptr } {
+	VkPushConstantRange pushConstantRange{
+		.stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+		.offset = 0u,
+		.size = static_cast<std::uint32_t>(sizeof(CullConstants))
+	};
+
+	VkPipelineLayoutCreateInfo layoutInfo{
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.setLayoutCount = 1u,
+		.pSetLayouts = &arguments.setLayout,
+		.pushConstantRangeCount = 1u,
+		.pPushConstantRanges = &pushConstantRange
+	};
+
+	vkCreatePipelineLayout(device, &layoutInfo, nullptr, &m_pipelineLayout);
+
+	// VkPipelineObject doesn't take specialisation constants, so the pipeline is created here.
+	const VkBool32 taskCommands = m_output == Output::TaskDispatches ? VK_TRUE : VK_FALSE;
+
+	VkSpecializationMapEntry mapEntry{
+		.constantID = 0u,
+		.offset = 0u,
+		.size = sizeof(VkBool32)
+	};
+
+	VkSpecializationInfo specialisationInfo{
+		.mapEntryCount = 1u,
+		.pMapEntries = &mapEntry,
+		.dataSize = sizeof(VkBool32),
+		.pData = &taskCommands
+	};
+
+	VkComputePipelineCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		.stage = VkPipelineShaderStageCreateInfo{
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+			.module = arguments.cullShader,
+			.pName = "main",
+			.pSpecializationInfo = &specialisationInfo
+		},
+		.layout = m_pipelineLayout
+	};
+
+	vkCreateComputePipelines(device, VK_NULL_HANDLE, 1u, &createInfo, nullptr, &m_pipeline);
+
+	if (m_output == Output::TaskDispatches)
+		m_drawMeshTasksIndirectCount = reinterpret_cast<PFN_vkCmdDrawMeshTasksIndirectCountEXT>(
+			vkGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectCountEXT")
+		);
+}
+
+GpuCullingPass::~GpuCullingPass() noexcept {
+	vkDestroyPipeline(m_deviceRef, m_pipeline, nullptr);
+	vkDestroyPipelineLayout(m_deviceRef, m_pipelineLayout, nullptr);
+}
+
+void GpuCullingPass::RecordCull(
+	VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, const FrustumPlanes& planes,
+	std::uint32_t objectCount, VkBuffer countBuffer, VkDeviceSize countOffset
+) const noexcept {
+	VkMemoryBarrier countBarrier{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+		.srcAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+		.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT
+	};
+
+	// The previous frame's draws might still read the count.
+	vkCmdPipelineBarrier(
+		commandBuffer, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0u,
+		1u, &countBarrier, 0u, nullptr, 0u, nullptr
+	);
+
+	vkCmdFillBuffer(commandBuffer, countBuffer, countOffset, sizeof(std::uint32_t), 0u);
+
+	VkMemoryBarrier clearBarrier{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+		.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT
+	};
+
+	// The previous frame's draws might still read the commands.
+	vkCmdPipelineBarrier(
+		commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+		VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0u, 1u, &clearBarrier, 0u, nullptr, 0u, nullptr
+	);
+
+	const CullConstants constants{ .planes = planes, .objectCount = objectCount };
+
+	vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipeline);
+	vkCmdBindDescriptorSets(
+		commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_pipelineLayout, 0u, 1u, &descriptorSet,
+		0u, nullptr
+	);
+	vkCmdPushConstants(
+		commandBuffer, m_pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0u,
+		static_cast<std::uint32_t>(sizeof(CullConstants)), &constants
+	);
+	vkCmdDispatch(commandBuffer, (objectCount + threadBlockSize - 1u) / threadBlockSize, 1u, 1u);
+
+	VkMemoryBarrier commandBarrier{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+		.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT
+	};
+
+	vkCmdPipelineBarrier(
+		commandBuffer, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT,
+		0u, 1u, &commandBarrier, 0u, nullptr, 0u, nullptr
+	);
+}
+
+bool GpuCullingPass::RecordDraws(
+	VkCommandBuffer commandBuffer, VkBuffer commandsBuffer, VkBuffer countBuffer,
+	std::uint32_t maxDrawCount, VkDeviceSize countOffset
+) const noexcept {
+	if (!CanRecordDraws())
+		return false;
+
+	const std::uint32_t stride = GetCommandStride(m_output);
+
+	if (m_output == Output::IndexedDraws)
+		vkCmdDrawIndexedIndirectCount(
+			commandBuffer, commandsBuffer, 0u, countBuffer, countOffset, maxDrawCount, stride
+		);
+	else
+		m_drawMeshTasksIndirectCount(
+			commandBuffer, commandsBuffer, 0u, countBuffer, countOffset, maxDrawCount, stride
+		);
+
+	return true;
+}
+
+bool GpuCullingPass::CanRecordDraws() const noexcept {
+	return m_drawFeaturesEnabled
+		&& (m_output == Output::IndexedDraws || m_drawMeshTasksIndirectCount != nullptr);
+}
+
+VkPipeline GpuCullingPass::GetPipeline() const noexcept {
+	return m_pipeline;
+}
+
+VkPipelineLayout GpuCullingPass::GetPipelineLayout() const noexcept {
+	return m_pipelineLayout;
+}
+
+GpuCullingPass::Output GpuCullingPass::GetOutput() const noexcept {
+	return m_output;
+}
+
+std::uint32_t GpuCullingPass::GetCommandStride(Output output) noexcept {
+	return output == Output::IndexedDraws ?
+		static_cast<std::uint32_t>(sizeof(VkDrawIndexedIndirectCommand))
+		: static_cast<std::uint32_t>(sizeof(VkDrawMeshTasksIndirectCommandEXT));
+}
+
+bool GpuCullingPass::IsDrawSupported(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceVulkan12Features vulkan12Features{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES
+	};
+
+	VkPhysicalDeviceFeatures2 features{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext = &vulkan12Features
+	};
+
+	vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+	return vulkan12Features.drawIndirectCount && features.features.drawIndirectFirstInstance;
+}
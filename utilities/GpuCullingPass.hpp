@@ -0,0 +1,80 @@
+#ifndef GPU_CULLING_PASS_HPP_
+#define GPU_CULLING_PASS_HPP_
+#include <vulkan/vulkan.hpp>
+#include <FrustumCulling.hpp>
+#include <cstdint>
+
+// Culls objects against the frustum on the GPU and writes the indirect commands of the visible
+// ones, compacted, with their count. The descriptor set has the CullObjects at binding 0, the
+// commands at binding 1 and the count at binding 2, all storage buffers. The commands and the
+// count buffer also need the indirect usage. Drawing the commands needs the drawIndirectCount
+// feature enabled on the device, and the indexed draws also drawIndirectFirstInstance, as they
+// keep the object index in firstInstance.
+class GpuCullingPass {
+public:
+	enum class Output {
+		// VkDrawIndexedIndirectCommand for vkCmdDrawIndexedIndirectCount.
+		IndexedDraws,
+		// VkDrawMeshTasksIndirectCommandEXT for vkCmdDrawMeshTasksIndirectCountEXT.
+		TaskDispatches
+	};
+
+	struct Args {
+		VkDescriptorSetLayout setLayout;
+		VkShaderModule cullShader;
+		Output output;
+		// Vulkan can't be asked which features a device was created with, so the caller says
+		// whether the ones RecordDraws needs are enabled. IsDrawSupported checks the GPU.
+		bool drawFeaturesEnabled = false;
+	};
+
+	static constexpr std::uint32_t threadBlockSize = 64u;
+
+public:
+	GpuCullingPass(VkDevice device, const Args& arguments);
+	~GpuCullingPass() noexcept;
+
+	GpuCullingPass(const GpuCullingPass&) = delete;
+	GpuCullingPass& operator=(const GpuCullingPass&) = delete;
+
+	// Clears the count, culls and makes the commands visible to the indirect draw stage.
+	void RecordCull(
+		VkCommandBuffer commandBuffer, VkDescriptorSet descriptorSet, const FrustumPlanes& planes,
+		std::uint32_t objectCount, VkBuffer countBuffer, VkDeviceSize countOffset = 0u
+	) const noexcept;
+	// Has to be recorded inside a render pass, with a pipeline of the matching kind bound.
+	// Returns false and records nothing if CanRecordDraws is false.
+	[[nodiscard]]
+	bool RecordDraws(
+		VkCommandBuffer commandBuffer, VkBuffer commandsBuffer, VkBuffer countBuffer,
+		std::uint32_t maxDrawCount, VkDeviceSize countOffset = 0u
+	) const noexcept;
+
+	// False without the draw features. The task dispatches also need
+	// vkCmdDrawMeshTasksIndirectCountEXT, which only exists if the device was created with
+	// VK_EXT_mesh_shader. The culling itself works either way.
+	[[nodiscard]]
+	bool CanRecordDraws() const noexcept;
+
+	[[nodiscard]]
+	VkPipeline GetPipeline() const noexcept;
+	[[nodiscard]]
+	VkPipelineLayout GetPipelineLayout() const noexcept;
+	[[nodiscard]]
+	Output GetOutput() const noexcept;
+
+	[[nodiscard]]
+	static std::uint32_t GetCommandStride(Output output) noexcept;
+	// The physical device has drawIndirectCount and drawIndirectFirstInstance.
+	[[nodiscard]]
+	static bool IsDrawSupported(VkPhysicalDevice physicalDevice) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkPipelineLayout m_pipelineLayout;
+	VkPipeline m_pipeline;
+	Output m_output;
+	bool m_drawFeaturesEnabled;
+	PFN_vkCmdDrawMeshTasksIndirectCountEXT m_drawMeshTasksIndirectCount;
+};
+#endif
@@ -0,0 +1,269 @@
+#include <GpuProfiler.hpp>
+#include <bit>
+
+std::uint64_t GetTimestampDelta(
+	std::uint64_t begin, std::uint64_t end, std::uint32_t validBits
+) noexcept {
+	const std::uint64_t mask = validBits >= 64u ?
+		std::numeric_limits<std::uint64_t>::max() : (std::uint64_t{ 1u } << validBits) - 1u;
+
+	return (end - begin) & mask;
+}
+
+double TicksToMicroseconds(std::uint64_t ticks, float timestampPeriod) noexcept {
+	// The period is in nanoseconds per tick.
+	return static_cast<double>(ticks) * static_cast<double>(timestampPeriod) / 1'000.0;
+}
+
+[[nodiscard]]
+static std::uint32_t GetTimestampValidBits(
+	VkPhysicalDevice physicalDevice, std::uint32_t queueFamilyIndex
+) {
+	std::uint32_t familyCount = 0u;
+	vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, &familyCount, nullptr);
+
+	std::vector<VkQueueFamilyProperties> familyProperties(familyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(
+		physicalDevice, &familyCount, std::data(familyProperties)
+	);
+
+	return queueFamilyIndex < familyCount ?
+		familyProperties[queueFamilyIndex].timestampValidBits : 0u;
+}
+
+GpuProfiler::GpuProfiler(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device }, m_timestampPool{ VK_NULL_HANDLE },
+	m_statisticsPool{ VK_NULL_HANDLE }, m_maxScopesPerFrame{ arguments.maxScopesPerFrame },
+	m_statisticCount{
+		IsStatisticsSupported(arguments.physicalDevice) ?
+			static_cast<std::uint32_t>(std::popcount(arguments.statisticFlags)) : 0u
+	},
+	m_timestampValidBits{
+		GetTimestampValidBits(arguments.physicalDevice, arguments.queueFamilyIndex)
+	},
+	m_timestampPeriod{ 1.f }, m_queueFamilyIndex{ arguments.queueFamilyIndex },
+	m_queueName{ arguments.queueName }, m_currentFrame{ 0u },
+	m_frames(arguments.frameCount) {
+	VkPhysicalDeviceProperties deviceProperties{};
+	vkGetPhysicalDeviceProperties(arguments.physicalDevice, &deviceProperties);
+	m_timestampPeriod = deviceProperties.limits.timestampPeriod;
+
+	VkQueryPoolCreateInfo timestampPoolInfo{
+		.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+		.queryType = VK_QUERY_TYPE_TIMESTAMP,
+		.queryCount = arguments.frameCount * m_maxScopesPerFrame * 2u
+	};
+
+	vkCreateQueryPool(device, &timestampPoolInfo, nullptr, &m_timestampPool);
+
+	if (m_statisticCount) {
+		VkQueryPoolCreateInfo statisticsPoolInfo{
+			.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+			.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS,
+			.queryCount = arguments.frameCount * m_maxScopesPerFrame,
+			.pipelineStatistics = arguments.statisticFlags
+		};
+
+		vkCreateQueryPool(device, &statisticsPoolInfo, nullptr, &m_statisticsPool);
+	}
+}
+
+GpuProfiler::~GpuProfiler() noexcept {
+	vkDestroyQueryPool(m_deviceRef, m_timestampPool, nullptr);
+	vkDestroyQueryPool(m_deviceRef, m_statisticsPool, nullptr);
+}
+
+std::uint32_t GpuProfiler::GetFirstTimestampQuery(std::uint32_t frameIndex) const noexcept {
+	return frameIndex * m_maxScopesPerFrame * 2u;
+}
+
+void GpuProfiler::BeginFrame(VkCommandBuffer commandBuffer, std::uint32_t frameIndex) {
+	m_currentFrame = frameIndex;
+
+	FrameQueries& frame = m_frames[frameIndex];
+	frame.scopes.clear();
+	frame.currentDepth = 0u;
+
+	vkCmdResetQueryPool(
+		commandBuffer, m_timestampPool, GetFirstTimestampQuery(frameIndex),
+		m_maxScopesPerFrame * 2u
+	);
+
+	if (m_statisticsPool != VK_NULL_HANDLE)
+		vkCmdResetQueryPool(
+			commandBuffer, m_statisticsPool, frameIndex * m_maxScopesPerFrame,
+			m_maxScopesPerFrame
+		);
+}
+
+std::uint32_t GpuProfiler::BeginScope(VkCommandBuffer commandBuffer, std::string name) {
+	FrameQueries& frame = m_frames[m_currentFrame];
+
+	if (std::size(frame.scopes) >= m_maxScopesPerFrame)
+		return invalidScope;
+
+	const auto scopeIndex = static_cast<std::uint32_t>(std::size(frame.scopes));
+	const bool hasStatistics = m_statisticsPool != VK_NULL_HANDLE && frame.currentDepth == 0u;
+
+	frame.scopes.emplace_back(ScopeRecord{
+		.name = std::move(name), .depth = frame.currentDepth, .hasStatistics = hasStatistics,
+		.isOpen = true
+	});
+	++frame.currentDepth;
+
+	vkCmdWriteTimestamp(
+		commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestampPool,
+		GetFirstTimestampQuery(m_currentFrame) + scopeIndex * 2u
+	);
+
+	if (hasStatistics)
+		vkCmdBeginQuery(
+			commandBuffer, m_statisticsPool, m_currentFrame * m_maxScopesPerFrame + scopeIndex,
+			0u
+		);
+
+	return scopeIndex;
+}
+
+void GpuProfiler::EndScope(VkCommandBuffer commandBuffer, std::uint32_t scopeIndex) {
+	FrameQueries& frame = m_frames[m_currentFrame];
+
+	if (scopeIndex >= std::size(frame.scopes) || !frame.scopes[scopeIndex].isOpen)
+		return;
+
+	frame.scopes[scopeIndex].isOpen = false;
+	--frame.currentDepth;
+
+	if (frame.scopes[scopeIndex].hasStatistics)
+		vkCmdEndQuery(
+			commandBuffer, m_statisticsPool, m_currentFrame * m_maxScopesPerFrame + scopeIndex
+		);
+
+	vkCmdWriteTimestamp(
+		commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestampPool,
+		GetFirstTimestampQuery(m_currentFrame) + scopeIndex * 2u + 1u
+	);
+}
+
+void GpuProfiler::EndFrame(VkCommandBuffer commandBuffer) {
+	const FrameQueries& frame = m_frames[m_currentFrame];
+	const auto scopeCount = static_cast<std::uint32_t>(std::size(frame.scopes));
+
+	// Scopes nest, so the open ones which began last are the innermost.
+	for (std::uint32_t scopeIndex = scopeCount; scopeIndex > 0u; --scopeIndex)
+		EndScope(commandBuffer, scopeIndex - 1u);
+}
+
+void GpuProfiler::SetSubmitTime(ChromeTrace::Clock::time_point submitTime) noexcept {
+	m_frames[m_currentFrame].submitTime = submitTime;
+}
+
+bool GpuProfiler::CollectFrame(VkDevice device, std::uint32_t frameIndex) {
+	FrameQueries& frame = m_frames[frameIndex];
+	const auto scopeCount = static_cast<std::uint32_t>(std::size(frame.scopes));
+
+	frame.results.clear();
+
+	if (scopeCount == 0u)
+		return true;
+
+	std::vector<std::uint64_t> timestamps(scopeCount * 2u);
+
+	// Without the wait bit, VK_NOT_READY comes back instead of blocking.
+	const VkResult timestampResult = vkGetQueryPoolResults(
+		device, m_timestampPool, GetFirstTimestampQuery(frameIndex), scopeCount * 2u,
+		sizeof(std::uint64_t) * std::size(timestamps), std::data(timestamps),
+		sizeof(std::uint64_t), VK_QUERY_RESULT_64_BIT
+	);
+
+	if (timestampResult != VK_SUCCESS)
+		return false;
+
+	std::vector<std::uint64_t> statistics;
+
+	if (m_statisticsPool != VK_NULL_HANDLE) {
+		statistics.resize(static_cast<size_t>(scopeCount) * m_statisticCount);
+
+		// Nested scopes have no statistics query, so they are read one at a time.
+		for (std::uint32_t scopeIndex = 0u; scopeIndex < scopeCount; ++scopeIndex) {
+			if (!frame.scopes[scopeIndex].hasStatistics)
+				continue;
+
+			const VkResult statisticsResult = vkGetQueryPoolResults(
+				device, m_statisticsPool, frameIndex * m_maxScopesPerFrame + scopeIndex, 1u,
+				sizeof(std::uint64_t) * m_statisticCount,
+				std::data(statistics) + static_cast<size_t>(scopeIndex) * m_statisticCount,
+				sizeof(std::uint64_t) * m_statisticCount, VK_QUERY_RESULT_64_BIT
+			);
+
+			if (statisticsResult != VK_SUCCESS)
+				return false;
+		}
+	}
+
+	const std::uint64_t frameStart = timestamps[0];
+
+	for (std::uint32_t scopeIndex = 0u; scopeIndex < scopeCount; ++scopeIndex) {
+		const ScopeRecord& scope = frame.scopes[scopeIndex];
+		const std::uint64_t begin = timestamps[scopeIndex * 2u];
+		const std::uint64_t end = timestamps[scopeIndex * 2u + 1u];
+
+		GpuScopeResult& result = frame.results.emplace_back(GpuScopeResult{
+			.name = scope.name,
+			.startUs = TicksToMicroseconds(
+				GetTimestampDelta(frameStart, begin, m_timestampValidBits), m_timestampPeriod
+			),
+			.durationUs = TicksToMicroseconds(
+				GetTimestampDelta(begin, end, m_timestampValidBits), m_timestampPeriod
+			),
+			.depth = scope.depth
+		});
+
+		if (scope.hasStatistics) {
+			auto scopeStatistics = std::begin(statistics)
+				+ static_cast<std::ptrdiff_t>(scopeIndex * m_statisticCount);
+
+			result.statistics.assign(scopeStatistics, scopeStatistics + m_statisticCount);
+		}
+	}
+
+	return true;
+}
+
+const std::vector<GpuScopeResult>& GpuProfiler::GetResults(
+	std::uint32_t frameIndex
+) const noexcept {
+	return m_frames[frameIndex].results;
+}
+
+std::uint32_t GpuProfiler::GetStatisticCount() const noexcept {
+	return m_statisticCount;
+}
+
+void GpuProfiler::ExportToTrace(ChromeTrace& trace, std::uint32_t frameIndex) const {
+	const FrameQueries& frame = m_frames[frameIndex];
+	const double frameStart = trace.ToTraceTime(frame.submitTime);
+
+	trace.SetThreadName(ChromeTrace::gpuProcessId, m_queueFamilyIndex, m_queueName);
+
+	for (const GpuScopeResult& result : frame.results)
+		trace.AddEvent(TraceEvent{
+			.name = result.name,
+			.category = "gpu",
+			.processId = ChromeTrace::gpuProcessId,
+			.threadId = m_queueFamilyIndex,
+			.startUs = frameStart + result.startUs,
+			.durationUs = result.durationUs
+		});
+}
+
+bool GpuProfiler::IsSupported(VkPhysicalDevice physicalDevice, std::uint32_t queueFamilyIndex) {
+	return GetTimestampValidBits(physicalDevice, queueFamilyIndex) != 0u;
+}
+
+bool GpuProfiler::IsStatisticsSupported(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceFeatures features{};
+	vkGetPhysicalDeviceFeatures(physicalDevice, &features);
+
+	return features.pipelineStatisticsQuery;
+}
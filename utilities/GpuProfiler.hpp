@@ -0,0 +1,121 @@
+#ifndef GPU_PROFILER_HPP_
+#define GPU_PROFILER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <ChromeTrace.hpp>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+struct GpuScopeResult {
+	std::string name;
+	// From the start of the first scope of the frame.
+	double startUs;
+	double durationUs;
+	std::uint32_t depth;
+	// In the order of the bits of the statistic flags, empty for nested scopes.
+	std::vector<std::uint64_t> statistics;
+};
+
+// The ticks between two timestamps, with only validBits of them written by the queue. Masking
+// the difference keeps it right when the counter wrapped around in between.
+[[nodiscard]]
+std::uint64_t GetTimestampDelta(
+	std::uint64_t begin, std::uint64_t end, std::uint32_t validBits
+) noexcept;
+[[nodiscard]]
+double TicksToMicroseconds(std::uint64_t ticks, float timestampPeriod) noexcept;
+
+// Timestamps and pipeline statistics for the command buffers of one queue, with a range of
+// queries per frame in flight. Scopes are recorded with BeginScope and EndScope and can nest.
+// Once the fence of a frame has signalled, CollectFrame reads its results without blocking,
+// before BeginFrame resets its queries for reuse. Only one pipeline statistics query can be
+// active at a time, so only the outermost scopes get statistics. They need the
+// pipelineStatisticsQuery feature enabled on the device, and the statistic flags are ignored
+// if the physical device doesn't have it. The transfer queue doesn't support them, its profiler
+// should be created without statistic flags.
+class GpuProfiler {
+public:
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		std::uint32_t queueFamilyIndex;
+		std::uint32_t frameCount;
+		std::uint32_t maxScopesPerFrame;
+		VkQueryPipelineStatisticFlags statisticFlags;
+		std::string queueName;
+	};
+
+	static constexpr std::uint32_t invalidScope = std::numeric_limits<std::uint32_t>::max();
+
+public:
+	GpuProfiler(VkDevice device, const Args& arguments);
+	~GpuProfiler() noexcept;
+
+	GpuProfiler(const GpuProfiler&) = delete;
+	GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+	// Records the reset of the frame's queries, so it has to come before any scope and outside
+	// of a render pass. The results of the last use of the frame are dropped if they weren't
+	// collected.
+	void BeginFrame(VkCommandBuffer commandBuffer, std::uint32_t frameIndex);
+	// Returns invalidScope once the frame is out of queries, EndScope ignores it.
+	[[nodiscard]]
+	std::uint32_t BeginScope(VkCommandBuffer commandBuffer, std::string name);
+	void EndScope(VkCommandBuffer commandBuffer, std::uint32_t scopeIndex);
+	// Ends the scopes which are still open, innermost first, as their queries would never
+	// become available otherwise. Has to be recorded before the command buffer ends.
+	void EndFrame(VkCommandBuffer commandBuffer);
+	// When the frame was submitted, which places its GPU scopes on the CPU timeline.
+	void SetSubmitTime(ChromeTrace::Clock::time_point submitTime) noexcept;
+
+	// Doesn't block. Returns false if the queries of the frame aren't all available yet.
+	[[nodiscard]]
+	bool CollectFrame(VkDevice device, std::uint32_t frameIndex);
+
+	[[nodiscard]]
+	const std::vector<GpuScopeResult>& GetResults(std::uint32_t frameIndex) const noexcept;
+	[[nodiscard]]
+	std::uint32_t GetStatisticCount() const noexcept;
+	// The GPU can't start before the submission, so the frame is placed at its submit time.
+	// That is an upper bound on the actual start.
+	void ExportToTrace(ChromeTrace& trace, std::uint32_t frameIndex) const;
+
+	// The queue family has to write timestamps.
+	[[nodiscard]]
+	static bool IsSupported(VkPhysicalDevice physicalDevice, std::uint32_t queueFamilyIndex);
+	[[nodiscard]]
+	static bool IsStatisticsSupported(VkPhysicalDevice physicalDevice) noexcept;
+
+private:
+	struct ScopeRecord {
+		std::string name;
+		std::uint32_t depth;
+		bool hasStatistics;
+		bool isOpen;
+	};
+
+	struct FrameQueries {
+		std::vector<ScopeRecord> scopes;
+		std::vector<GpuScopeResult> results;
+		std::uint32_t currentDepth;
+		ChromeTrace::Clock::time_point submitTime;
+	};
+
+private:
+	[[nodiscard]]
+	std::uint32_t GetFirstTimestampQuery(std::uint32_t frameIndex) const noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkQueryPool m_timestampPool;
+	VkQueryPool m_statisticsPool;
+	std::uint32_t m_maxScopesPerFrame;
+	std::uint32_t m_statisticCount;
+	std::uint32_t m_timestampValidBits;
+	float m_timestampPeriod;
+	std::uint32_t m_queueFamilyIndex;
+	std::string m_queueName;
+	std::uint32_t m_currentFrame;
+	std::vector<FrameQueries> m_frames;
+};
+#endif
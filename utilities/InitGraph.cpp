@@ -0,0 +1,250 @@
+#include <InitGraph.hpp>
+#include <algorithm>
+
+InitGraph::NodeId InitGraph::AddNode(
+	std::string name, NodeFunction init, NodeFunction teardown
+) {
+	m_nodes.emplace_back(Node{
+		.name = std::move(name),
+		.init = std::move(init),
+		.teardown = std::move(teardown),
+		.remainingDependencies = 0u,
+		.state = NodeState::Waiting
+	});
+
+	return std::size(m_nodes) - 1u;
+}
+
+void InitGraph::AddDependency(NodeId node, NodeId dependency) {
+	m_nodes[node].dependencies.emplace_back(dependency);
+	m_nodes[dependency].dependents.emplace_back(node);
+}
+
+bool InitGraph::Run(ThreadPool& threadPool) {
+	if (!GetTopologicalOrder())
+		return false;
+
+	std::vector<NodeId> readyNodes;
+
+	{
+		std::lock_guard lock{ m_runMutex };
+
+		m_completionOrder.clear();
+		m_settledCount = 0u;
+		m_firstException = nullptr;
+
+		for (NodeId nodeId = 0u; nodeId < std::size(m_nodes); ++nodeId) {
+			Node& node = m_nodes[nodeId];
+
+			node.remainingDependencies = std::size(node.dependencies);
+			node.state = NodeState::Waiting;
+			node.startTime = {};
+			node.endTime = {};
+
+			if (node.remainingDependencies == 0u)
+				readyNodes.emplace_back(nodeId);
+		}
+
+		m_runStart = Clock::now();
+	}
+
+	for (NodeId nodeId : readyNodes)
+		static_cast<void>(threadPool.Submit([this, &threadPool, nodeId] {
+			RunNode(threadPool, nodeId);
+		}));
+
+	std::unique_lock lock{ m_runMutex };
+	m_runFinished.wait(lock, [this] { return m_settledCount == std::size(m_nodes); });
+
+	m_runEnd = Clock::now();
+
+	if (m_firstException)
+		std::rethrow_exception(m_firstException);
+
+	return true;
+}
+
+void InitGraph::RunNode(ThreadPool& threadPool, NodeId nodeId) noexcept {
+	Node& node = m_nodes[nodeId];
+
+	bool failed = false;
+	std::exception_ptr exception;
+
+	node.startTime = Clock::now();
+
+	try {
+		if (node.init)
+			node.init();
+	}
+	catch (...) {
+		failed = true;
+		exception = std::current_exception();
+	}
+
+	node.endTime = Clock::now();
+
+	std::lock_guard lock{ m_runMutex };
+
+	if (exception && !m_firstException)
+		m_firstException = exception;
+
+	FinishNode(threadPool, nodeId, failed);
+
+	// Notified with the lock held, Run could otherwise return and the graph be destroyed
+	// before this thread is done with it.
+	m_runFinished.notify_one();
+}
+
+void InitGraph::FinishNode(ThreadPool& threadPool, NodeId nodeId, bool failed) {
+	// Skipped dependents settle right away, and their dependents with them.
+	std::vector<std::pair<NodeId, bool>> settledNodes{ { nodeId, failed } };
+
+	while (!std::empty(settledNodes)) {
+		const auto [settledId, settledFailed] = settledNodes.back();
+		settledNodes.pop_back();
+
+		Node& settledNode = m_nodes[settledId];
+		++m_settledCount;
+
+		if (settledFailed)
+			settledNode.state = NodeState::Failed;
+		else {
+			settledNode.state = NodeState::Finished;
+			m_completionOrder.emplace_back(settledId);
+		}
+
+		for (NodeId dependentId : settledNode.dependents) {
+			Node& dependent = m_nodes[dependentId];
+
+			if (--dependent.remainingDependencies != 0u)
+				continue;
+
+			const bool blocked = std::ranges::any_of(
+				dependent.dependencies,
+				[this](NodeId dependencyId) {
+					return m_nodes[dependencyId].state == NodeState::Failed;
+				}
+			);
+
+			if (blocked)
+				settledNodes.emplace_back(dependentId, true);
+			else
+				static_cast<void>(threadPool.Submit([this, &threadPool, dependentId] {
+					RunNode(threadPool, dependentId);
+				}));
+		}
+	}
+}
+
+void InitGraph::Teardown() {
+	for (auto nodeId = std::rbegin(m_completionOrder); nodeId != std::rend(m_completionOrder);
+		++nodeId) {
+		Node& node = m_nodes[*nodeId];
+
+		if (node.teardown)
+			node.teardown();
+	}
+
+	m_completionOrder.clear();
+}
+
+std::optional<std::vector<InitGraph::NodeId>> InitGraph::GetTopologicalOrder() const {
+	std::vector<size_t> remainingDependencies;
+	std::vector<NodeId> order;
+
+	for (NodeId nodeId = 0u; nodeId < std::size(m_nodes); ++nodeId) {
+		remainingDependencies.emplace_back(std::size(m_nodes[nodeId].dependencies));
+
+		if (remainingDependencies.back() == 0u)
+			order.emplace_back(nodeId);
+	}
+
+	// The order doubles as the queue of Kahn's algorithm.
+	for (size_t index = 0u; index < std::size(order); ++index)
+		for (NodeId dependentId : m_nodes[order[index]].dependents)
+			if (--remainingDependencies[dependentId] == 0u)
+				order.emplace_back(dependentId);
+
+	if (std::size(order) != std::size(m_nodes))
+		return {};
+
+	return order;
+}
+
+std::vector<InitGraph::NodeTiming> InitGraph::GetTimings() const {
+	std::vector<NodeTiming> timings;
+
+	for (const Node& node : m_nodes) {
+		const bool ran = node.startTime != Clock::time_point{};
+
+		timings.emplace_back(NodeTiming{
+			.name = node.name,
+			.start = ran ?
+				std::chrono::duration_cast<std::chrono::microseconds>(
+					node.startTime - m_runStart
+				) : std::chrono::microseconds{ 0 },
+			.duration = ran ?
+				std::chrono::duration_cast<std::chrono::microseconds>(
+					node.endTime - node.startTime
+				) : std::chrono::microseconds{ 0 },
+			.ran = ran
+		});
+	}
+
+	return timings;
+}
+
+std::vector<InitGraph::NodeId> InitGraph::GetCriticalPath() const {
+	const std::optional<std::vector<NodeId>> order = GetTopologicalOrder();
+
+	if (!order || std::empty(*order))
+		return {};
+
+	const std::vector<NodeTiming> timings = GetTimings();
+
+	// The longest finishing time of any chain ending at a node and where that chain came from.
+	std::vector<std::chrono::microseconds> pathDurations(std::size(m_nodes));
+	std::vector<std::optional<NodeId>> predecessors(std::size(m_nodes));
+
+	for (NodeId nodeId : *order) {
+		std::chrono::microseconds longestDependency{ 0 };
+
+		for (NodeId dependencyId : m_nodes[nodeId].dependencies)
+			if (!predecessors[nodeId] || pathDurations[dependencyId] > longestDependency) {
+				longestDependency = pathDurations[dependencyId];
+				predecessors[nodeId] = dependencyId;
+			}
+
+		pathDurations[nodeId] = longestDependency + timings[nodeId].duration;
+	}
+
+	NodeId lastNode = static_cast<NodeId>(
+		std::distance(std::begin(pathDurations), std::ranges::max_element(pathDurations))
+	);
+
+	std::vector<NodeId> criticalPath{ lastNode };
+	while (predecessors[criticalPath.back()])
+		criticalPath.emplace_back(*predecessors[criticalPath.back()]);
+
+	std::ranges::reverse(criticalPath);
+
+	return criticalPath;
+}
+
+std::chrono::microseconds InitGraph::GetCriticalPathDuration() const {
+	const std::vector<NodeTiming> timings = GetTimings();
+
+	std::chrono::microseconds duration{ 0 };
+	for (NodeId nodeId : GetCriticalPath())
+		duration += timings[nodeId].duration;
+
+	return duration;
+}
+
+std::chrono::microseconds InitGraph::GetTotalDuration() const noexcept {
+	return std::chrono::duration_cast<std::chrono::microseconds>(m_runEnd - m_runStart);
+}
+
+size_t InitGraph::GetNodeCount() const noexcept {
+	return std::size(m_nodes);
+}
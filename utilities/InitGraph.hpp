@@ -0,0 +1,102 @@
+#ifndef INIT_GRAPH_HPP_
+#define INIT_GRAPH_HPP_
+#include <ThreadPool.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Start up work as a graph with explicit dependencies instead of a fixed sequence. Run starts
+// every node on the thread pool as soon as the nodes it depends on have finished, so the ones
+// which only need the device can overlap. Teardown goes in the reverse of the order the nodes
+// finished in, which is what the priorities of ObjectManager approximate.
+class InitGraph {
+public:
+	using NodeId = size_t;
+	using NodeFunction = std::function<void()>;
+
+	struct NodeTiming {
+		std::string name;
+		// From the start of Run.
+		std::chrono::microseconds start;
+		std::chrono::microseconds duration;
+		bool ran;
+	};
+
+public:
+	InitGraph() = default;
+
+	InitGraph(const InitGraph&) = delete;
+	InitGraph& operator=(const InitGraph&) = delete;
+
+	NodeId AddNode(std::string name, NodeFunction init, NodeFunction teardown = {});
+	// The node won't start before dependency has finished.
+	void AddDependency(NodeId node, NodeId dependency);
+
+	// Returns false without running anything if the dependencies have a cycle. If a node
+	// throws, the nodes which depend on it are skipped and the first exception is rethrown once
+	// the nodes already running have finished. Must not be called from a worker of threadPool.
+	[[nodiscard]]
+	bool Run(ThreadPool& threadPool);
+	// Calls the teardown functions of the nodes which ran, on the calling thread.
+	void Teardown();
+
+	// Dependencies before the nodes which depend on them, empty if there is a cycle.
+	[[nodiscard]]
+	std::optional<std::vector<NodeId>> GetTopologicalOrder() const;
+	[[nodiscard]]
+	std::vector<NodeTiming> GetTimings() const;
+	// The chain of dependencies with the longest total duration of the last Run. It bounds how
+	// fast start up can get with any number of threads.
+	[[nodiscard]]
+	std::vector<NodeId> GetCriticalPath() const;
+	[[nodiscard]]
+	std::chrono::microseconds GetCriticalPathDuration() const;
+	[[nodiscard]]
+	std::chrono::microseconds GetTotalDuration() const noexcept;
+	[[nodiscard]]
+	size_t GetNodeCount() const noexcept;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	enum class NodeState {
+		Waiting,
+		Finished,
+		// It or one of its dependencies threw.
+		Failed
+	};
+
+	struct Node {
+		std::string name;
+		NodeFunction init;
+		NodeFunction teardown;
+		std::vector<NodeId> dependencies;
+		std::vector<NodeId> dependents;
+		size_t remainingDependencies;
+		NodeState state;
+		Clock::time_point startTime;
+		Clock::time_point endTime;
+	};
+
+private:
+	void RunNode(ThreadPool& threadPool, NodeId nodeId) noexcept;
+	// Has to be called with m_runMutex locked.
+	void FinishNode(ThreadPool& threadPool, NodeId nodeId, bool failed);
+
+private:
+	std::vector<Node> m_nodes;
+	std::vector<NodeId> m_completionOrder;
+	Clock::time_point m_runStart;
+	Clock::time_point m_runEnd;
+	std::mutex m_runMutex;
+	std::condition_variable m_runFinished;
+	size_t m_settledCount = 0u;
+	std::exception_ptr m_firstException;
+};
+#endif
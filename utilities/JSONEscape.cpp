@@ -0,0 +1,27 @@
+#include <JSONEscape.hpp>
+
+std::string EscapeJSON(std::string_view text) {
+	constexpr char hexDigits[] = "0123456789abcdef";
+
+	std::string escapedText;
+	escapedText.reserve(std::size(text));
+
+	for (char character : text) {
+		const auto code = static_cast<unsigned char>(character);
+
+		if (code < 0x20u) {
+			escapedText += "\\u00";
+			escapedText += hexDigits[code >> 4u];
+			escapedText += hexDigits[code & 0xFu];
+
+			continue;
+		}
+
+		if (character == '"' || character == '\\')
+			escapedText += '\\';
+
+		escapedText += character;
+	}
+
+	return escapedText;
+}
@@ -0,0 +1,10 @@
+#ifndef JSON_ESCAPE_HPP_
+#define JSON_ESCAPE_HPP_
+#include <string>
+#include <string_view>
+
+// Makes the text safe inside a JSON string. Quotes and backslashes get a backslash and the
+// control characters, which JSON doesn't allow unescaped, are written as \u00XX.
+[[nodiscard]]
+std::string EscapeJSON(std::string_view text);
+#endif
@@ -0,0 +1,119 @@
+#include <JobSystem.hpp>
+#include <algorithm>
+#include <latch>
+
+JobSystem::JobSystem(size_t threadCount)
+	: m_queuedJobs{ 0u }, m_stealCount{ 0u }, m_workers{ m_jobAvailable } {
+	threadCount = WorkerThreads::ResolveCount(threadCount);
+
+	for (size_t index = 0u; index < threadCount; ++index)
+		m_queues.emplace_back(std::make_unique<WorkerQueue>());
+
+	m_workers.Start(threadCount, [this](std::stop_token stopToken, size_t workerIndex) {
+		RunWorker(stopToken, workerIndex);
+	});
+}
+
+void JobSystem::ParallelFor(size_t itemCount, size_t chunkSize, const ChunkFunction& function) {
+	chunkSize = std::max<size_t>(chunkSize, 1u);
+	const size_t chunkCount = (itemCount + chunkSize - 1u) / chunkSize;
+
+	if (chunkCount == 0u)
+		return;
+
+	std::latch chunksDone{ static_cast<std::ptrdiff_t>(chunkCount) };
+	const size_t workerCount = std::size(m_queues);
+
+	for (size_t chunkIndex = 0u; chunkIndex < chunkCount; ++chunkIndex) {
+		const size_t begin = chunkIndex * chunkSize;
+		const size_t end = std::min(begin + chunkSize, itemCount);
+
+		// Waiting on the latch keeps the function and the latch alive for the jobs.
+		Push(
+			chunkIndex * workerCount / chunkCount,
+			[&function, &chunksDone, chunkIndex, begin, end](size_t workerIndex) {
+				function(chunkIndex, begin, end, workerIndex);
+				chunksDone.count_down();
+			}
+		);
+	}
+
+	chunksDone.wait();
+}
+
+size_t JobSystem::GetWorkerCount() const noexcept {
+	return m_workers.GetCount();
+}
+
+size_t JobSystem::GetStealCount() const noexcept {
+	return m_stealCount.load();
+}
+
+void JobSystem::Push(size_t workerIndex, Job job) {
+	{
+		// Counted before it's queued, so the count never goes below zero.
+		std::lock_guard wakeLock{ m_wakeMutex };
+		++m_queuedJobs;
+	}
+
+	{
+		WorkerQueue& queue = *m_queues[workerIndex];
+		std::lock_guard lock{ queue.mutex };
+		queue.jobs.emplace_back(std::move(job));
+	}
+
+	m_jobAvailable.notify_all();
+}
+
+bool JobSystem::TryPop(size_t workerIndex, Job& job) noexcept {
+	WorkerQueue& queue = *m_queues[workerIndex];
+	std::lock_guard lock{ queue.mutex };
+
+	if (std::empty(queue.jobs))
+		return false;
+
+	job = std::move(queue.jobs.back());
+	queue.jobs.pop_back();
+	--m_queuedJobs;
+
+	return true;
+}
+
+bool JobSystem::TrySteal(size_t workerIndex, Job& job) noexcept {
+	const size_t workerCount = std::size(m_queues);
+
+	for (size_t offset = 1u; offset < workerCount; ++offset) {
+		WorkerQueue& queue = *m_queues[(workerIndex + offset) % workerCount];
+		std::lock_guard lock{ queue.mutex };
+
+		if (std::empty(queue.jobs))
+			continue;
+
+		job = std::move(queue.jobs.front());
+		queue.jobs.pop_front();
+		--m_queuedJobs;
+		++m_stealCount;
+
+		return true;
+	}
+
+	return false;
+}
+
+void JobSystem::RunWorker(std::stop_token stopToken, size_t workerIndex) noexcept {
+	while (true) {
+		Job job;
+
+		if (TryPop(workerIndex, job) || TrySteal(workerIndex, job)) {
+			job(workerIndex);
+
+			continue;
+		}
+
+		std::unique_lock lock{ m_wakeMutex };
+
+		// Gives up once a stop was requested and no job is left in any queue.
+		if (!m_jobAvailable.wait(lock, stopToken, [this] { return m_queuedJobs.load() != 0u; }))
+			return;
+	}
+}
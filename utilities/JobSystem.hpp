@@ -0,0 +1,63 @@
+#ifndef JOB_SYSTEM_HPP_
+#define JOB_SYSTEM_HPP_
+#include <WorkerThreads.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Workers with a job queue each. A worker takes the newest job of its own queue and, once that
+// is empty, steals the oldest job of another one, so uneven chunks are balanced out. Every job
+// is told which worker runs it, so per thread resources like command pools can be indexed
+// without locking.
+class JobSystem {
+public:
+	// chunkIndex, begin, end, workerIndex.
+	using ChunkFunction = std::function<void(size_t, size_t, size_t, size_t)>;
+
+public:
+	// A threadCount of 0 uses one worker per hardware thread.
+	JobSystem(size_t threadCount = 0u);
+
+	JobSystem(const JobSystem&) = delete;
+	JobSystem& operator=(const JobSystem&) = delete;
+
+	// Splits [0, itemCount) into chunks of chunkSize items and blocks until all of them have
+	// run. Consecutive chunks start on the same worker.
+	void ParallelFor(size_t itemCount, size_t chunkSize, const ChunkFunction& function);
+
+	[[nodiscard]]
+	size_t GetWorkerCount() const noexcept;
+	[[nodiscard]]
+	size_t GetStealCount() const noexcept;
+
+private:
+	using Job = std::function<void(size_t)>;
+
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+private:
+	void Push(size_t workerIndex, Job job);
+	[[nodiscard]]
+	bool TryPop(size_t workerIndex, Job& job) noexcept;
+	[[nodiscard]]
+	bool TrySteal(size_t workerIndex, Job& job) noexcept;
+
+	void RunWorker(std::stop_token stopToken, size_t workerIndex) noexcept;
+
+private:
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+	std::mutex m_wakeMutex;
+	std::condition_variable_any m_jobAvailable;
+	std::atomic<size_t> m_queuedJobs;
+	std::atomic<size_t> m_stealCount;
+	// Declared last, so the workers are joined before the queues are destroyed.
+	WorkerThreads m_workers;
+};
+#endif
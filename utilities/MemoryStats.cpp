@@ -0,0 +1,123 @@
+#include <MemoryStats.hpp>
+#include <JSONEscape.hpp>
+#include <algorithm>
+#include <sstream>
+
+void HeapStats::AddAllocation(AllocationRecord record) {
+	boundSize += record.size;
+	paddingSize += record.paddingSize;
+
+	allocations.emplace_back(std::move(record));
+}
+
+void MemoryStats::AddHeap(HeapStats heap) {
+	m_heaps.emplace_back(std::move(heap));
+}
+
+bool MemoryStats::QueryBudget(VkPhysicalDevice physicalDevice) {
+	std::uint32_t extensionCount = 0u;
+	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
+
+	std::vector<VkExtensionProperties> extensions(extensionCount);
+	vkEnumerateDeviceExtensionProperties(
+		physicalDevice, nullptr, &extensionCount, std::data(extensions)
+	);
+
+	m_hasBudget = std::ranges::any_of(extensions, [](const VkExtensionProperties& extension) {
+		return std::string_view{ extension.extensionName } == VK_EXT_MEMORY_BUDGET_EXTENSION_NAME;
+	});
+
+	VkPhysicalDeviceMemoryBudgetPropertiesEXT budgetProperties{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT
+	};
+
+	VkPhysicalDeviceMemoryProperties2 memoryProperties{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2,
+		.pNext = m_hasBudget ? &budgetProperties : nullptr
+	};
+
+	vkGetPhysicalDeviceMemoryProperties2(physicalDevice, &memoryProperties);
+
+	const VkPhysicalDeviceMemoryProperties& properties = memoryProperties.memoryProperties;
+
+	m_budgets.clear();
+	for (std::uint32_t index = 0u; index < properties.memoryHeapCount; ++index) {
+		const VkMemoryHeap& heap = properties.memoryHeaps[index];
+
+		m_budgets.emplace_back(HeapBudget{
+			.heapSize = heap.size,
+			.budget = m_hasBudget ? budgetProperties.heapBudget[index] : heap.size,
+			.usage = m_hasBudget ? budgetProperties.heapUsage[index] : 0u,
+			.deviceLocal = (heap.flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0u
+		});
+	}
+
+	return m_hasBudget;
+}
+
+const std::vector<HeapStats>& MemoryStats::GetHeaps() const noexcept {
+	return m_heaps;
+}
+
+const std::vector<HeapBudget>& MemoryStats::GetBudgets() const noexcept {
+	return m_budgets;
+}
+
+bool MemoryStats::HasBudget() const noexcept {
+	return m_hasBudget;
+}
+
+std::string MemoryStats::ToJSON() const {
+	std::ostringstream json{};
+
+	json << "{\"heaps\":[";
+	for (size_t heapIndex = 0u; heapIndex < std::size(m_heaps); ++heapIndex) {
+		const HeapStats& heap = m_heaps[heapIndex];
+
+		json << (heapIndex ? "," : "")
+			<< "{\"name\":\"" << EscapeJSON(heap.name) << '"'
+			<< ",\"reservedSize\":" << heap.reservedSize
+			<< ",\"boundSize\":" << heap.boundSize
+			<< ",\"paddingSize\":" << heap.paddingSize
+			<< ",\"largestFreeBlock\":" << heap.largestFreeBlock
+			<< ",\"allocations\":[";
+
+		for (size_t index = 0u; index < std::size(heap.allocations); ++index) {
+			const AllocationRecord& allocation = heap.allocations[index];
+
+			json << (index ? "," : "")
+				<< "{\"name\":\"" << EscapeJSON(allocation.name) << '"'
+				<< ",\"size\":" << allocation.size
+				<< ",\"paddingSize\":" << allocation.paddingSize << '}';
+		}
+
+		json << "]}";
+	}
+
+	json << "],\"hasBudget\":" << (m_hasBudget ? "true" : "false") << ",\"budgets\":[";
+	for (size_t index = 0u; index < std::size(m_budgets); ++index) {
+		const HeapBudget& budget = m_budgets[index];
+
+		json << (index ? "," : "")
+			<< "{\"heapSize\":" << budget.heapSize
+			<< ",\"budget\":" << budget.budget
+			<< ",\"usage\":" << budget.usage
+			<< ",\"deviceLocal\":" << (budget.deviceLocal ? "true" : "false") << '}';
+	}
+	json << "]}";
+
+	return json.str();
+}
+
+AllocationRecord GetSplitBufferRecord(
+	std::string name, VkDeviceSize subBufferSize, VkDeviceSize subAllocationStride,
+	std::uint32_t bufferCount
+) {
+	const auto paddedCount = static_cast<VkDeviceSize>(std::max(bufferCount, 1u) - 1u);
+
+	return AllocationRecord{
+		.name = std::move(name),
+		.size = subAllocationStride * paddedCount + subBufferSize,
+		.paddingSize = (subAllocationStride - subBufferSize) * paddedCount
+	};
+}
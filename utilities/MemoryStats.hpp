@@ -0,0 +1,65 @@
+#ifndef MEMORY_STATS_HPP_
+#define MEMORY_STATS_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct AllocationRecord {
+	std::string name;
+	// Everything the allocation occupies in its heap, including the padding.
+	VkDeviceSize size;
+	VkDeviceSize paddingSize;
+};
+
+struct HeapStats {
+	std::string name;
+	VkDeviceSize reservedSize = 0u;
+	VkDeviceSize boundSize = 0u;
+	VkDeviceSize paddingSize = 0u;
+	VkDeviceSize largestFreeBlock = 0u;
+	std::vector<AllocationRecord> allocations;
+
+	void AddAllocation(AllocationRecord record);
+};
+
+// The numbers reported by VK_EXT_memory_budget for one VkMemoryHeap. Without the extension only
+// the heap size is known.
+struct HeapBudget {
+	VkDeviceSize heapSize;
+	VkDeviceSize budget;
+	VkDeviceSize usage;
+	bool deviceLocal;
+};
+
+class MemoryStats {
+public:
+	// The heap is copied in, so it has to be filled before it is added.
+	void AddHeap(HeapStats heap);
+	// Returns false if the device doesn't support VK_EXT_memory_budget.
+	bool QueryBudget(VkPhysicalDevice physicalDevice);
+
+	[[nodiscard]]
+	const std::vector<HeapStats>& GetHeaps() const noexcept;
+	[[nodiscard]]
+	const std::vector<HeapBudget>& GetBudgets() const noexcept;
+	[[nodiscard]]
+	bool HasBudget() const noexcept;
+
+	[[nodiscard]]
+	std::string ToJSON() const;
+
+private:
+	std::vector<HeapStats> m_heaps;
+	std::vector<HeapBudget> m_budgets;
+	bool m_hasBudget = false;
+};
+
+// A buffer split into bufferCount sub-buffers, like the VkResourceView ones. Every sub-buffer but
+// the last is followed by the padding which aligns the next one to subAllocationStride.
+[[nodiscard]]
+AllocationRecord GetSplitBufferRecord(
+	std::string name, VkDeviceSize subBufferSize, VkDeviceSize subAllocationStride,
+	std::uint32_t bufferCount
+);
+#endif
@@ -0,0 +1,316 @@
+#include <MeshletBuilder.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
+namespace {
+	[[nodiscard]]
+	MeshletFloat3 Subtract(const MeshletFloat3& lhs, const MeshletFloat3& rhs) noexcept {
+		return { lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2] };
+	}
+
+	[[nodiscard]]
+	float Dot(const MeshletFloat3& lhs, const MeshletFloat3& rhs) noexcept {
+		return lhs[0] * rhs[0] + lhs[1] * rhs[1] + lhs[2] * rhs[2];
+	}
+
+	[[nodiscard]]
+	MeshletFloat3 Cross(const MeshletFloat3& lhs, const MeshletFloat3& rhs) noexcept {
+		return {
+			lhs[1] * rhs[2] - lhs[2] * rhs[1],
+			lhs[2] * rhs[0] - lhs[0] * rhs[2],
+			lhs[0] * rhs[1] - lhs[1] * rhs[0]
+		};
+	}
+
+	[[nodiscard]]
+	MeshletFloat3 Normalise(const MeshletFloat3& vector) noexcept {
+		const float length = std::sqrt(Dot(vector, vector));
+
+		if (length == 0.f)
+			return { 0.f, 0.f, 0.f };
+
+		return { vector[0] / length, vector[1] / length, vector[2] / length };
+	}
+
+	class MeshletBuilder {
+	public:
+		MeshletBuilder(
+			std::span<const std::uint32_t> indices, std::span<const MeshletFloat3> positions,
+			const MeshletLimits& limits
+		) : m_indices{ indices }, m_positions{ positions }, m_limits{ limits },
+			m_triangleCount{ std::size(indices) / 3u }, m_emitted(m_triangleCount, false),
+			m_vertexTriangles(std::size(positions)) {
+			for (size_t triangle = 0u; triangle < m_triangleCount; ++triangle)
+				for (size_t corner = 0u; corner < 3u; ++corner)
+					m_vertexTriangles[indices[triangle * 3u + corner]].emplace_back(
+						static_cast<std::uint32_t>(triangle)
+					);
+		}
+
+		[[nodiscard]]
+		MeshletData Build() {
+			size_t nextSeed = 0u;
+			std::vector<std::uint32_t> previousVertices;
+
+			while (true) {
+				std::optional<std::uint32_t> seed = FindAdjacentTriangle(previousVertices);
+
+				if (!seed) {
+					while (nextSeed < m_triangleCount && m_emitted[nextSeed])
+						++nextSeed;
+
+					if (nextSeed == m_triangleCount)
+						break;
+
+					seed = static_cast<std::uint32_t>(nextSeed);
+				}
+
+				previousVertices = BuildMeshlet(*seed);
+			}
+
+			return std::move(m_data);
+		}
+
+	private:
+		[[nodiscard]]
+		std::optional<std::uint32_t> FindAdjacentTriangle(
+			const std::vector<std::uint32_t>& vertices
+		) const noexcept {
+			for (std::uint32_t vertex : vertices)
+				for (std::uint32_t triangle : m_vertexTriangles[vertex])
+					if (!m_emitted[triangle])
+						return triangle;
+
+			return {};
+		}
+
+		[[nodiscard]]
+		std::vector<std::uint32_t> BuildMeshlet(std::uint32_t seed) {
+			// Global vertex index to meshlet local index.
+			std::unordered_map<std::uint32_t, std::uint32_t> localVertices;
+			std::vector<std::uint32_t> meshletVertices;
+			std::vector<std::uint32_t> candidates{ seed };
+			MeshletFloat3 positionSum{ 0.f, 0.f, 0.f };
+
+			Meshlet meshlet{
+				.vertexOffset = static_cast<std::uint32_t>(std::size(m_data.vertexIndices)),
+				.vertexCount = 0u,
+				.primitiveOffset = static_cast<std::uint32_t>(std::size(m_data.primitiveIndices)),
+				.primitiveCount = 0u
+			};
+
+			while (meshlet.primitiveCount < m_limits.maxPrimitives) {
+				const MeshletFloat3 centroid = GetCentroid(positionSum, std::size(meshletVertices));
+
+				std::optional<std::uint32_t> bestTriangle;
+				std::uint32_t bestNewVertices = std::numeric_limits<std::uint32_t>::max();
+				float bestDistance = std::numeric_limits<float>::max();
+
+				for (std::uint32_t triangle : candidates) {
+					if (m_emitted[triangle])
+						continue;
+
+					const std::uint32_t newVertices = CountNewVertices(triangle, localVertices);
+
+					if (meshlet.vertexCount + newVertices > m_limits.maxVertices)
+						continue;
+
+					const MeshletFloat3 offset = Subtract(GetTriangleCentre(triangle), centroid);
+					const float distance = Dot(offset, offset);
+
+					if (newVertices < bestNewVertices
+						|| (newVertices == bestNewVertices && distance < bestDistance)) {
+						bestTriangle = triangle;
+						bestNewVertices = newVertices;
+						bestDistance = distance;
+					}
+				}
+
+				if (!bestTriangle)
+					break;
+
+				std::array<std::uint32_t, 3u> localIndices{};
+
+				for (size_t corner = 0u; corner < 3u; ++corner) {
+					const std::uint32_t vertex = m_indices[*bestTriangle * 3u + corner];
+					auto [localVertex, inserted] = localVertices.try_emplace(
+						vertex, meshlet.vertexCount
+					);
+
+					if (inserted) {
+						++meshlet.vertexCount;
+						meshletVertices.emplace_back(vertex);
+						m_data.vertexIndices.emplace_back(vertex);
+
+						for (size_t axis = 0u; axis < 3u; ++axis)
+							positionSum[axis] += m_positions[vertex][axis];
+
+						for (std::uint32_t triangle : m_vertexTriangles[vertex])
+							if (!m_emitted[triangle])
+								candidates.emplace_back(triangle);
+					}
+
+					localIndices[corner] = localVertex->second;
+				}
+
+				m_emitted[*bestTriangle] = true;
+				m_data.primitiveIndices.emplace_back(
+					PackPrimitive(localIndices[0], localIndices[1], localIndices[2])
+				);
+				++meshlet.primitiveCount;
+
+				std::erase_if(candidates, [this](std::uint32_t triangle) {
+					return m_emitted[triangle];
+				});
+			}
+
+			m_data.meshlets.emplace_back(meshlet);
+			m_data.bounds.emplace_back(ComputeBounds(meshlet, meshletVertices));
+
+			return meshletVertices;
+		}
+
+		[[nodiscard]]
+		std::uint32_t CountNewVertices(
+			std::uint32_t triangle,
+			const std::unordered_map<std::uint32_t, std::uint32_t>& localVertices
+		) const noexcept {
+			std::uint32_t newVertices = 0u;
+
+			for (size_t corner = 0u; corner < 3u; ++corner) {
+				const std::uint32_t vertex = m_indices[triangle * 3u + corner];
+
+				// A degenerate triangle can use the same new vertex twice.
+				bool repeated = false;
+				for (size_t previous = 0u; previous < corner; ++previous)
+					repeated |= m_indices[triangle * 3u + previous] == vertex;
+
+				if (!repeated && !localVertices.contains(vertex))
+					++newVertices;
+			}
+
+			return newVertices;
+		}
+
+		[[nodiscard]]
+		MeshletFloat3 GetTriangleCentre(std::uint32_t triangle) const noexcept {
+			MeshletFloat3 centre{ 0.f, 0.f, 0.f };
+
+			for (size_t corner = 0u; corner < 3u; ++corner)
+				for (size_t axis = 0u; axis < 3u; ++axis)
+					centre[axis] += m_positions[m_indices[triangle * 3u + corner]][axis] / 3.f;
+
+			return centre;
+		}
+
+		[[nodiscard]]
+		static MeshletFloat3 GetCentroid(
+			const MeshletFloat3& positionSum, size_t vertexCount
+		) noexcept {
+			if (vertexCount == 0u)
+				return positionSum;
+
+			const auto count = static_cast<float>(vertexCount);
+
+			return { positionSum[0] / count, positionSum[1] / count, positionSum[2] / count };
+		}
+
+		[[nodiscard]]
+		MeshletBounds ComputeBounds(
+			const Meshlet& meshlet, const std::vector<std::uint32_t>& meshletVertices
+		) const noexcept {
+			MeshletFloat3 minimum{
+				std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+				std::numeric_limits<float>::max()
+			};
+			MeshletFloat3 maximum{
+				std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+				std::numeric_limits<float>::lowest()
+			};
+
+			for (std::uint32_t vertex : meshletVertices)
+				for (size_t axis = 0u; axis < 3u; ++axis) {
+					minimum[axis] = std::min(minimum[axis], m_positions[vertex][axis]);
+					maximum[axis] = std::max(maximum[axis], m_positions[vertex][axis]);
+				}
+
+			MeshletBounds bounds{
+				.center = {
+					(minimum[0] + maximum[0]) * 0.5f, (minimum[1] + maximum[1]) * 0.5f,
+					(minimum[2] + maximum[2]) * 0.5f
+				},
+				.radius = 0.f,
+				.coneAxis = { 0.f, 0.f, 0.f },
+				.coneCutoff = 1.f
+			};
+
+			for (std::uint32_t vertex : meshletVertices) {
+				const MeshletFloat3 offset = Subtract(m_positions[vertex], bounds.center);
+				bounds.radius = std::max(bounds.radius, std::sqrt(Dot(offset, offset)));
+			}
+
+			std::vector<MeshletFloat3> normals;
+			MeshletFloat3 normalSum{ 0.f, 0.f, 0.f };
+
+			for (std::uint32_t primitive = 0u; primitive < meshlet.primitiveCount; ++primitive) {
+				const auto local = UnpackPrimitive(
+					m_data.primitiveIndices[meshlet.primitiveOffset + primitive]
+				);
+
+				const MeshletFloat3& position0 = m_positions[meshletVertices[local[0]]];
+				const MeshletFloat3 normal = Normalise(Cross(
+					Subtract(m_positions[meshletVertices[local[1]]], position0),
+					Subtract(m_positions[meshletVertices[local[2]]], position0)
+				));
+
+				// Degenerate triangles don't face anywhere.
+				if (Dot(normal, normal) == 0.f)
+					continue;
+
+				normals.emplace_back(normal);
+				for (size_t axis = 0u; axis < 3u; ++axis)
+					normalSum[axis] += normal[axis];
+			}
+
+			const MeshletFloat3 axis = Normalise(normalSum);
+
+			if (std::empty(normals) || Dot(axis, axis) == 0.f)
+				return bounds;
+
+			float minimumDot = 1.f;
+			for (const MeshletFloat3& normal : normals)
+				minimumDot = std::min(minimumDot, Dot(axis, normal));
+
+			bounds.coneAxis = axis;
+			// Wider than a hemisphere can always be seen from somewhere.
+			bounds.coneCutoff = minimumDot <= 0.f ?
+				1.f : std::sqrt(1.f - minimumDot * minimumDot);
+
+			return bounds;
+		}
+
+	private:
+		std::span<const std::uint32_t> m_indices;
+		std::span<const MeshletFloat3> m_positions;
+		MeshletLimits m_limits;
+		size_t m_triangleCount;
+		std::vector<bool> m_emitted;
+		std::vector<std::vector<std::uint32_t>> m_vertexTriangles;
+		MeshletData m_data;
+	};
+}
+
+MeshletData BuildMeshlets(
+	std::span<const std::uint32_t> indices, std::span<const MeshletFloat3> positions,
+	const MeshletLimits& limits
+) {
+	MeshletLimits clampedLimits{
+		.maxVertices = std::clamp(limits.maxVertices, 3u, 1'024u),
+		.maxPrimitives = std::max(limits.maxPrimitives, 1u)
+	};
+
+	return MeshletBuilder{ indices, positions, clampedLimits }.Build();
+}
@@ -0,0 +1,63 @@
+#ifndef MESHLET_BUILDER_HPP_
+#define MESHLET_BUILDER_HPP_
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using MeshletFloat3 = std::array<float, 3u>;
+
+// The defaults match the max_vertices and max_primitives of MeshShaderTest.mesh.
+struct MeshletLimits {
+	std::uint32_t maxVertices = 64u;
+	std::uint32_t maxPrimitives = 126u;
+};
+
+struct Meshlet {
+	std::uint32_t vertexOffset;
+	std::uint32_t vertexCount;
+	std::uint32_t primitiveOffset;
+	std::uint32_t primitiveCount;
+};
+
+// The meshlet is entirely backfacing, so it can be culled, when
+// dot(center - cameraPosition, coneAxis) >= coneCutoff * length(center - cameraPosition) + radius.
+// A coneCutoff of 1 means the cone is too wide to ever cull.
+struct MeshletBounds {
+	MeshletFloat3 center;
+	float radius;
+	MeshletFloat3 coneAxis;
+	float coneCutoff;
+};
+
+struct MeshletData {
+	std::vector<Meshlet> meshlets;
+	// The vertices of every meshlet, as indices into the vertex buffer.
+	std::vector<std::uint32_t> vertexIndices;
+	// One word per triangle, with the three meshlet local vertex indices in 10 bits each.
+	std::vector<std::uint32_t> primitiveIndices;
+	std::vector<MeshletBounds> bounds;
+};
+
+[[nodiscard]]
+constexpr std::uint32_t PackPrimitive(
+	std::uint32_t index0, std::uint32_t index1, std::uint32_t index2
+) noexcept {
+	return index0 | (index1 << 10u) | (index2 << 20u);
+}
+
+[[nodiscard]]
+constexpr std::array<std::uint32_t, 3u> UnpackPrimitive(std::uint32_t primitive) noexcept {
+	return { primitive & 0x3FFu, (primitive >> 10u) & 0x3FFu, (primitive >> 20u) & 0x3FFu };
+}
+
+// Splits a triangle list into meshlets. Each meshlet greedily takes the neighbouring triangle
+// which adds the fewest new vertices, with the distance to the meshlet's centre as the tie
+// breaker, and a new meshlet starts next to the previous one when possible. maxVertices can't
+// be larger than 1024, because of the 10 bit packing.
+[[nodiscard]]
+MeshletData BuildMeshlets(
+	std::span<const std::uint32_t> indices, std::span<const MeshletFloat3> positions,
+	const MeshletLimits& limits = {}
+);
+#endif
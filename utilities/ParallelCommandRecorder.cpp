@@ -0,0 +1,140 @@
+#include <ParallelCommandRecorder.hpp>
+#include <algorithm>
+
+ParallelCommandRecorder::ParallelCommandRecorder(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device }, m_frames(arguments.frameCount), m_currentFrame{ 0u } {
+	for (FrameCommands& frame : m_frames) {
+		frame.primaryPool = CreatePool(device, arguments.queueFamilyIndex);
+		frame.primary = VK_NULL_HANDLE;
+
+		VkCommandBufferAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+			.commandPool = frame.primaryPool,
+			.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			.commandBufferCount = 1u
+		};
+		vkAllocateCommandBuffers(device, &allocInfo, &frame.primary);
+
+		for (size_t index = 0u; index < arguments.threadCount; ++index)
+			frame.threadCommands.emplace_back(ThreadCommands{
+				.pool = CreatePool(device, arguments.queueFamilyIndex),
+				.secondaries = {},
+				.usedCount = 0u
+			});
+	}
+}
+
+ParallelCommandRecorder::~ParallelCommandRecorder() noexcept {
+	// Destroying a pool frees its command buffers.
+	for (FrameCommands& frame : m_frames) {
+		vkDestroyCommandPool(m_deviceRef, frame.primaryPool, nullptr);
+
+		for (ThreadCommands& threadCommands : frame.threadCommands)
+			vkDestroyCommandPool(m_deviceRef, threadCommands.pool, nullptr);
+	}
+}
+
+void ParallelCommandRecorder::BeginFrame(VkDevice device, size_t frameIndex) noexcept {
+	m_currentFrame = frameIndex;
+	FrameCommands& frame = m_frames[frameIndex];
+
+	vkResetCommandPool(device, frame.primaryPool, 0u);
+
+	for (ThreadCommands& threadCommands : frame.threadCommands) {
+		vkResetCommandPool(device, threadCommands.pool, 0u);
+		threadCommands.usedCount = 0u;
+	}
+}
+
+VkCommandBuffer ParallelCommandRecorder::GetPrimaryCommandBuffer() const noexcept {
+	return m_frames[m_currentFrame].primary;
+}
+
+std::vector<VkCommandBuffer> ParallelCommandRecorder::RecordSecondaries(
+	VkDevice device, JobSystem& jobSystem, size_t itemCount, size_t chunkSize,
+	const VkCommandBufferInheritanceInfo& inheritanceInfo, const RecordFunction& recordFunction
+) {
+	FrameCommands& frame = m_frames[m_currentFrame];
+
+	// The workers index the pools, one without a pool would write past them.
+	if (jobSystem.GetWorkerCount() > std::size(frame.threadCommands))
+		return {};
+
+	chunkSize = std::max<size_t>(chunkSize, 1u);
+	std::vector<VkCommandBuffer> secondaries(
+		(itemCount + chunkSize - 1u) / chunkSize, VK_NULL_HANDLE
+	);
+
+	VkCommandBufferUsageFlags usageFlags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+	if (inheritanceInfo.renderPass != VK_NULL_HANDLE)
+		usageFlags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+	// Each chunk only writes its own element and the commands of the worker running it.
+	jobSystem.ParallelFor(
+		itemCount, chunkSize,
+		[&](size_t chunkIndex, size_t begin, size_t end, size_t workerIndex) {
+			VkCommandBuffer secondary = AcquireSecondary(
+				device, frame.threadCommands[workerIndex]
+			);
+
+			VkCommandBufferBeginInfo beginInfo{
+				.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+				.flags = usageFlags,
+				.pInheritanceInfo = &inheritanceInfo
+			};
+
+			vkBeginCommandBuffer(secondary, &beginInfo);
+			recordFunction(secondary, begin, end);
+			vkEndCommandBuffer(secondary);
+
+			secondaries[chunkIndex] = secondary;
+		}
+	);
+
+	return secondaries;
+}
+
+size_t ParallelCommandRecorder::GetSecondaryCount() const noexcept {
+	size_t secondaryCount = 0u;
+
+	for (const FrameCommands& frame : m_frames)
+		for (const ThreadCommands& threadCommands : frame.threadCommands)
+			secondaryCount += std::size(threadCommands.secondaries);
+
+	return secondaryCount;
+}
+
+VkCommandPool ParallelCommandRecorder::CreatePool(
+	VkDevice device, std::uint32_t queueFamilyIndex
+) noexcept {
+	VkCommandPoolCreateInfo poolInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+		.queueFamilyIndex = queueFamilyIndex
+	};
+
+	VkCommandPool pool = VK_NULL_HANDLE;
+	vkCreateCommandPool(device, &poolInfo, nullptr, &pool);
+
+	return pool;
+}
+
+VkCommandBuffer ParallelCommandRecorder::AcquireSecondary(
+	VkDevice device, ThreadCommands& threadCommands
+) noexcept {
+	if (threadCommands.usedCount == std::size(threadCommands.secondaries)) {
+		VkCommandBufferAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+			.commandPool = threadCommands.pool,
+			.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY,
+			.commandBufferCount = 1u
+		};
+
+		VkCommandBuffer secondary = VK_NULL_HANDLE;
+		vkAllocateCommandBuffers(device, &allocInfo, &secondary);
+
+		threadCommands.secondaries.emplace_back(secondary);
+	}
+
+	return threadCommands.secondaries[threadCommands.usedCount++];
+}
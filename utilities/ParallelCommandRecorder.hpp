@@ -0,0 +1,79 @@
+#ifndef PARALLEL_COMMAND_RECORDER_HPP_
+#define PARALLEL_COMMAND_RECORDER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <JobSystem.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Records secondary command buffers on the workers of a JobSystem. Every frame in flight has a
+// command pool per worker, so no pool is ever used by two threads, and a pool for the primary
+// command buffer. The pools of a frame are reset as a whole when the frame begins instead of
+// resetting each command buffer, and the secondary command buffers are kept for reuse.
+class ParallelCommandRecorder {
+public:
+	struct Args {
+		std::uint32_t queueFamilyIndex;
+		size_t frameCount;
+		// Has to be at least the worker count of the JobSystem which records.
+		size_t threadCount;
+	};
+
+	// commandBuffer, begin, end.
+	using RecordFunction = std::function<void(VkCommandBuffer, size_t, size_t)>;
+
+public:
+	ParallelCommandRecorder(VkDevice device, const Args& arguments);
+	~ParallelCommandRecorder() noexcept;
+
+	ParallelCommandRecorder(const ParallelCommandRecorder&) = delete;
+	ParallelCommandRecorder& operator=(const ParallelCommandRecorder&) = delete;
+
+	// Only call once the GPU has finished the last submission of frameIndex.
+	void BeginFrame(VkDevice device, size_t frameIndex) noexcept;
+
+	// Isn't begun, the caller records the render pass and executes the secondaries in it.
+	[[nodiscard]]
+	VkCommandBuffer GetPrimaryCommandBuffer() const noexcept;
+
+	// Splits [0, itemCount) into chunks, records each into its own secondary command buffer and
+	// returns them in chunk order, so the draw order is kept. The secondaries continue the
+	// render pass of inheritanceInfo, if it has one. Records nothing and returns an empty
+	// vector if the JobSystem has more workers than Args::threadCount.
+	[[nodiscard]]
+	std::vector<VkCommandBuffer> RecordSecondaries(
+		VkDevice device, JobSystem& jobSystem, size_t itemCount, size_t chunkSize,
+		const VkCommandBufferInheritanceInfo& inheritanceInfo, const RecordFunction& recordFunction
+	);
+
+	// Every secondary command buffer which was allocated over all the frames.
+	[[nodiscard]]
+	size_t GetSecondaryCount() const noexcept;
+
+private:
+	struct ThreadCommands {
+		VkCommandPool pool;
+		std::vector<VkCommandBuffer> secondaries;
+		size_t usedCount;
+	};
+
+	struct FrameCommands {
+		VkCommandPool primaryPool;
+		VkCommandBuffer primary;
+		std::vector<ThreadCommands> threadCommands;
+	};
+
+private:
+	[[nodiscard]]
+	static VkCommandPool CreatePool(VkDevice device, std::uint32_t queueFamilyIndex) noexcept;
+	[[nodiscard]]
+	static VkCommandBuffer AcquireSecondary(
+		VkDevice device, ThreadCommands& threadCommands
+	) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	std::vector<FrameCommands> m_frames;
+	size_t m_currentFrame;
+};
+#endif
@@ -0,0 +1,84 @@
+#include <PipelineBatch.hpp>
+#include <atomic>
+#include <type_traits>
+
+std::unique_ptr<VkPipelineObject> CreatePipeline(VkDevice device, const PipelineDesc& desc) {
+	auto pipeline = std::make_unique<VkPipelineObject>(device);
+
+	std::visit([&pipeline, device](const auto& pipelineDesc) {
+		using Desc = std::decay_t<decltype(pipelineDesc)>;
+
+		if constexpr (std::is_same_v<Desc, ComputePipelineDesc>)
+			pipeline->CreateComputePipeline(
+				device, pipelineDesc.layout, pipelineDesc.computeShader
+			);
+		else if constexpr (std::is_same_v<Desc, GraphicsPipelineVSDesc>)
+			pipeline->CreateGraphicsPipelineVS(
+				device, pipelineDesc.layout, pipelineDesc.renderPass, pipelineDesc.vertexLayout,
+				pipelineDesc.vertexShader, pipelineDesc.fragmentShader
+			);
+		else
+			pipeline->CreateGraphicsPipelineMS(
+				device, pipelineDesc.layout, pipelineDesc.renderPass,
+				pipelineDesc.meshShader, pipelineDesc.fragmentShader
+			);
+	}, desc);
+
+	return pipeline;
+}
+
+std::vector<std::future<std::unique_ptr<VkPipelineObject>>> CreatePipelinesAsync(
+	ThreadPool& threadPool, VkDevice device, std::vector<PipelineDesc> pipelineDescs
+) {
+	std::vector<std::future<std::unique_ptr<VkPipelineObject>>> pipelines;
+	pipelines.reserve(std::size(pipelineDescs));
+
+	for (PipelineDesc& pipelineDesc : pipelineDescs)
+		pipelines.emplace_back(threadPool.Submit(
+			[device, desc = std::move(pipelineDesc)] { return CreatePipeline(device, desc); }
+		));
+
+	return pipelines;
+}
+
+void CreatePipelinesAsync(
+	ThreadPool& threadPool, VkDevice device, std::vector<PipelineDesc> pipelineDescs,
+	PipelineBatchCallback onComplete
+) {
+	struct BatchState {
+		std::vector<std::unique_ptr<VkPipelineObject>> pipelines;
+		std::atomic<size_t> remaining;
+		PipelineBatchCallback onComplete;
+	};
+
+	const size_t pipelineCount = std::size(pipelineDescs);
+
+	if (pipelineCount == 0u) {
+		onComplete({});
+
+		return;
+	}
+
+	auto batchState = std::make_shared<BatchState>();
+	batchState->pipelines.resize(pipelineCount);
+	batchState->remaining = pipelineCount;
+	batchState->onComplete = std::move(onComplete);
+
+	for (size_t index = 0u; index < pipelineCount; ++index) {
+		// Each task writes to its own slot, and the atomic decrement orders the writes before
+		// the callback reads them. A pipeline which fails to compile is left null, so the
+		// callback is still called.
+		auto task = [device, index, batchState, desc = std::move(pipelineDescs[index])] {
+			try {
+				batchState->pipelines[index] = CreatePipeline(device, desc);
+			}
+			catch (...) {}
+
+			if (batchState->remaining.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+				batchState->onComplete(std::move(batchState->pipelines));
+		};
+
+		// The future is dropped, completion is reported through the callback.
+		static_cast<void>(threadPool.Submit(std::move(task)));
+	}
+}
@@ -0,0 +1,58 @@
+#ifndef PIPELINE_BATCH_HPP_
+#define PIPELINE_BATCH_HPP_
+#include <vulkan/vulkan.hpp>
+#include <VKPipelineObject.hpp>
+#include <ThreadPool.hpp>
+#include <functional>
+#include <future>
+#include <memory>
+#include <variant>
+#include <vector>
+
+struct ComputePipelineDesc {
+	VkPipelineLayout layout;
+	VkShaderModule computeShader;
+};
+
+struct GraphicsPipelineVSDesc {
+	VkPipelineLayout layout;
+	VkRenderPass renderPass;
+	VertexLayout vertexLayout;
+	VkShaderModule vertexShader;
+	VkShaderModule fragmentShader;
+};
+
+struct GraphicsPipelineMSDesc {
+	VkPipelineLayout layout;
+	VkRenderPass renderPass;
+	VkShaderModule meshShader;
+	VkShaderModule fragmentShader;
+};
+
+using PipelineDesc = std::variant<
+	ComputePipelineDesc, GraphicsPipelineVSDesc, GraphicsPipelineMSDesc
+>;
+
+// Compiles each description on the calling thread.
+[[nodiscard]]
+std::unique_ptr<VkPipelineObject> CreatePipeline(VkDevice device, const PipelineDesc& desc);
+
+// Pipeline creation is thread safe as long as the cache isn't externally synchronised, so the
+// descriptions are compiled concurrently on the pool. The layouts, render passes and shader
+// modules must stay alive until every pipeline has been created.
+[[nodiscard]]
+std::vector<std::future<std::unique_ptr<VkPipelineObject>>> CreatePipelinesAsync(
+	ThreadPool& threadPool, VkDevice device, std::vector<PipelineDesc> pipelineDescs
+);
+
+using PipelineBatchCallback = std::function<
+	void(std::vector<std::unique_ptr<VkPipelineObject>> pipelines)
+>;
+
+// The callback is called on the worker thread which finishes the last pipeline, with the
+// pipelines in the same order as the descriptions. Any pipeline which failed is null.
+void CreatePipelinesAsync(
+	ThreadPool& threadPool, VkDevice device, std::vector<PipelineDesc> pipelineDescs,
+	PipelineBatchCallback onComplete
+);
+#endif
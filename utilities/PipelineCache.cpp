@@ -0,0 +1,148 @@
+#include <PipelineCache.hpp>
+#include <fstream>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+PipelineCache::PipelineCache(VkDevice device) noexcept
+	: m_deviceRef{ device }, m_pipelineCache{ VK_NULL_HANDLE }, m_warm{ false } {}
+
+PipelineCache::~PipelineCache() noexcept {
+	vkDestroyPipelineCache(m_deviceRef, m_pipelineCache, nullptr);
+}
+
+void PipelineCache::CreateCache(
+	VkDevice device, VkPhysicalDevice physicalDevice,
+	const std::filesystem::path& cacheDirectory
+) {
+	VkPhysicalDeviceProperties properties{};
+	vkGetPhysicalDeviceProperties(physicalDevice, &properties);
+
+	m_filePath = cacheDirectory / GetCacheFileName(properties);
+
+	std::vector<char> cacheData = ReadCacheFile(m_filePath);
+
+	if (!IsCompatible(cacheData, properties))
+		cacheData.clear();
+
+	VkPipelineCacheCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+		.initialDataSize = std::size(cacheData),
+		.pInitialData = std::data(cacheData)
+	};
+
+	if (vkCreatePipelineCache(device, &createInfo, nullptr, &m_pipelineCache) != VK_SUCCESS) {
+		m_pipelineCache = VK_NULL_HANDLE;
+
+		return;
+	}
+
+	m_warm = !std::empty(cacheData);
+}
+
+bool PipelineCache::SaveCache(VkDevice device) const {
+	if (m_pipelineCache == VK_NULL_HANDLE)
+		return false;
+
+	size_t dataSize = 0u;
+	if (vkGetPipelineCacheData(device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS)
+		return false;
+
+	std::vector<char> cacheData(dataSize);
+	if (vkGetPipelineCacheData(device, m_pipelineCache, &dataSize, std::data(cacheData))
+		!= VK_SUCCESS)
+		return false;
+
+	std::error_code errorCode{};
+	std::filesystem::create_directories(m_filePath.parent_path(), errorCode);
+
+	// Written to a temporary file first, so another process never reads a partial cache.
+	std::filesystem::path tempPath = m_filePath;
+	tempPath += ".tmp";
+
+	{
+		std::ofstream cacheFile{ tempPath, std::ios::binary | std::ios::trunc };
+		cacheFile.write(std::data(cacheData), static_cast<std::streamsize>(dataSize));
+
+		if (!cacheFile)
+			return false;
+	}
+
+	std::filesystem::rename(tempPath, m_filePath, errorCode);
+
+	return !errorCode;
+}
+
+VkPipelineCache PipelineCache::GetCache() const noexcept {
+	return m_pipelineCache;
+}
+
+bool PipelineCache::IsWarm() const noexcept {
+	return m_warm;
+}
+
+const std::filesystem::path& PipelineCache::GetFilePath() const noexcept {
+	return m_filePath;
+}
+
+size_t PipelineCache::GetDataSize(VkDevice device) const noexcept {
+	if (m_pipelineCache == VK_NULL_HANDLE)
+		return 0u;
+
+	size_t dataSize = 0u;
+	if (vkGetPipelineCacheData(device, m_pipelineCache, &dataSize, nullptr) != VK_SUCCESS)
+		return 0u;
+
+	return dataSize;
+}
+
+std::string PipelineCache::GetCacheFileName(
+	const VkPhysicalDeviceProperties& properties
+) {
+	std::ostringstream fileName{};
+	fileName << "PipelineCache_" << std::hex << std::setfill('0');
+
+	for (std::uint8_t byte : properties.pipelineCacheUUID)
+		fileName << std::setw(2) << static_cast<std::uint32_t>(byte);
+
+	fileName << '_' << std::setw(8) << properties.driverVersion << ".bin";
+
+	return fileName.str();
+}
+
+bool PipelineCache::IsCompatible(
+	const std::vector<char>& cacheData, const VkPhysicalDeviceProperties& properties
+) noexcept {
+	VkPipelineCacheHeaderVersionOne header{};
+
+	if (std::size(cacheData) < sizeof(header))
+		return false;
+
+	std::memcpy(&header, std::data(cacheData), sizeof(header));
+
+	return header.headerSize >= sizeof(header)
+		&& header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+		&& header.vendorID == properties.vendorID
+		&& header.deviceID == properties.deviceID
+		&& std::memcmp(
+			header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE
+		) == 0;
+}
+
+std::vector<char> PipelineCache::ReadCacheFile(const std::filesystem::path& filePath) {
+	std::ifstream cacheFile{ filePath, std::ios::binary | std::ios::ate };
+
+	if (!cacheFile)
+		return {};
+
+	const auto fileSize = static_cast<size_t>(cacheFile.tellg());
+	std::vector<char> cacheData(fileSize);
+
+	cacheFile.seekg(0);
+	cacheFile.read(std::data(cacheData), static_cast<std::streamsize>(fileSize));
+
+	if (!cacheFile)
+		return {};
+
+	return cacheData;
+}
@@ -0,0 +1,52 @@
+#ifndef PIPELINE_CACHE_HPP_
+#define PIPELINE_CACHE_HPP_
+#include <vulkan/vulkan.hpp>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// A VkPipelineCache which can be shared between pipelines and persisted between runs. The file
+// name is keyed on the device UUID and the driver version, and the header of the loaded data is
+// checked again before use, so a driver update starts with a cold cache instead of a rejected one.
+class PipelineCache {
+public:
+	PipelineCache(VkDevice device) noexcept;
+	~PipelineCache() noexcept;
+
+	PipelineCache(const PipelineCache&) = delete;
+	PipelineCache& operator=(const PipelineCache&) = delete;
+
+	void CreateCache(
+		VkDevice device, VkPhysicalDevice physicalDevice,
+		const std::filesystem::path& cacheDirectory
+	);
+	bool SaveCache(VkDevice device) const;
+
+	[[nodiscard]]
+	VkPipelineCache GetCache() const noexcept;
+	[[nodiscard]]
+	bool IsWarm() const noexcept;
+	[[nodiscard]]
+	const std::filesystem::path& GetFilePath() const noexcept;
+	// The size of what SaveCache would write, 0 without a cache.
+	[[nodiscard]]
+	size_t GetDataSize(VkDevice device) const noexcept;
+
+	[[nodiscard]]
+	static std::string GetCacheFileName(const VkPhysicalDeviceProperties& properties);
+
+private:
+	[[nodiscard]]
+	static bool IsCompatible(
+		const std::vector<char>& cacheData, const VkPhysicalDeviceProperties& properties
+	) noexcept;
+	[[nodiscard]]
+	static std::vector<char> ReadCacheFile(const std::filesystem::path& filePath);
+
+private:
+	VkDevice m_deviceRef;
+	VkPipelineCache m_pipelineCache;
+	std::filesystem::path m_filePath;
+	bool m_warm;
+};
+#endif
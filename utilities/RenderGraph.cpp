@@ -0,0 +1,458 @@
+#include <RenderGraph.hpp>
+#include <algorithm>
+#include <numeric>
+
+RenderGraphResourceId RenderGraph::AddResource(
+	std::string name, const RenderGraphResourceDesc& desc
+) {
+	m_resources.emplace_back(Resource{ .name = std::move(name), .desc = desc, .output = false });
+
+	return static_cast<RenderGraphResourceId>(std::size(m_resources) - 1u);
+}
+
+RenderGraphPassId RenderGraph::AddPass(
+	std::string name, std::uint32_t queueFamily, bool sideEffects
+) {
+	m_passes.emplace_back(Pass{
+		.name = std::move(name), .queueFamily = queueFamily, .sideEffects = sideEffects
+	});
+
+	return static_cast<RenderGraphPassId>(std::size(m_passes) - 1u);
+}
+
+void RenderGraph::Read(
+	RenderGraphPassId pass, RenderGraphResourceId resource, VkPipelineStageFlags stages,
+	VkAccessFlags access, VkImageLayout layout
+) {
+	AddAccess(pass, ResourceAccess{
+		.resource = resource, .stages = stages, .access = access, .layout = layout,
+		.read = true, .write = false
+	});
+}
+
+void RenderGraph::Write(
+	RenderGraphPassId pass, RenderGraphResourceId resource, VkPipelineStageFlags stages,
+	VkAccessFlags access, VkImageLayout layout
+) {
+	AddAccess(pass, ResourceAccess{
+		.resource = resource, .stages = stages, .access = access, .layout = layout,
+		.read = false, .write = true
+	});
+}
+
+void RenderGraph::AddAccess(RenderGraphPassId pass, const ResourceAccess& access) {
+	std::vector<ResourceAccess>& accesses = m_passes[pass].accesses;
+
+	auto existingAccess = std::ranges::find(accesses, access.resource, &ResourceAccess::resource);
+
+	if (existingAccess == std::end(accesses)) {
+		accesses.emplace_back(access);
+
+		return;
+	}
+
+	existingAccess->stages |= access.stages;
+	existingAccess->access |= access.access;
+	existingAccess->read = existingAccess->read || access.read;
+	existingAccess->write = existingAccess->write || access.write;
+}
+
+void RenderGraph::MarkOutput(RenderGraphResourceId resource) {
+	m_resources[resource].output = true;
+}
+
+const std::string& RenderGraph::GetResourceName(RenderGraphResourceId resource) const noexcept {
+	return m_resources[resource].name;
+}
+
+size_t RenderGraph::GetPassCount() const noexcept {
+	return std::size(m_passes);
+}
+
+std::vector<bool> RenderGraph::FindLivePasses() const {
+	std::vector<bool> neededResources;
+	for (const Resource& resource : m_resources)
+		neededResources.emplace_back(resource.output);
+
+	std::vector<bool> livePasses(std::size(m_passes), false);
+
+	// Backwards, a pass is needed if a later needed pass or the outside reads what it writes.
+	// A resource which is overwritten completely still keeps its earlier writers, which is
+	// conservative.
+	for (size_t index = std::size(m_passes); index-- > 0u;) {
+		const Pass& pass = m_passes[index];
+
+		const bool live = pass.sideEffects || std::ranges::any_of(
+			pass.accesses,
+			[&neededResources](const ResourceAccess& access) {
+				return access.write && neededResources[access.resource];
+			}
+		);
+
+		if (!live)
+			continue;
+
+		livePasses[index] = true;
+
+		// A pass which reads and writes a resource still needs its earlier writers.
+		for (const ResourceAccess& access : pass.accesses)
+			if (access.read)
+				neededResources[access.resource] = true;
+	}
+
+	return livePasses;
+}
+
+RenderGraphCompileResult RenderGraph::Compile() const {
+	RenderGraphCompileResult result{};
+
+	const std::vector<bool> livePasses = FindLivePasses();
+
+	for (RenderGraphPassId passId = 0u; passId < std::size(m_passes); ++passId) {
+		if (!livePasses[passId]) {
+			result.culledPasses.emplace_back(passId);
+
+			continue;
+		}
+
+		result.passes.emplace_back(RenderGraphCompiledPass{
+			.pass = passId,
+			.name = m_passes[passId].name,
+			.queueFamily = m_passes[passId].queueFamily
+		});
+	}
+
+	constexpr size_t unused = std::numeric_limits<size_t>::max();
+
+	// The lifetimes of the transient resources, in positions of the compiled passes.
+	std::vector<TransientLifetime> lifetimes;
+	std::vector<size_t> lifetimeIndices(std::size(m_resources), unused);
+
+	for (size_t position = 0u; position < std::size(result.passes); ++position)
+		for (const ResourceAccess& access : m_passes[result.passes[position].pass].accesses) {
+			const RenderGraphResourceDesc& desc = m_resources[access.resource].desc;
+
+			if (!desc.transient)
+				continue;
+
+			size_t& lifetimeIndex = lifetimeIndices[access.resource];
+
+			if (lifetimeIndex == unused) {
+				lifetimeIndex = std::size(lifetimes);
+				lifetimes.emplace_back(TransientLifetime{
+					.resource = access.resource,
+					.firstUse = position,
+					.lastUse = position,
+					.size = desc.size,
+					.alignment = desc.alignment
+				});
+			}
+
+			lifetimes[lifetimeIndex].lastUse = position;
+		}
+
+	result.placements = PlaceTransientResources(lifetimes, result.transientMemorySize);
+
+	for (const TransientLifetime& lifetime : lifetimes)
+		result.unaliasedMemorySize += lifetime.size;
+
+	// The resources which were in the same memory before a transient resource's first use.
+	std::vector<std::vector<RenderGraphResourceId>> aliasedPredecessors(std::size(m_resources));
+
+	for (size_t index = 0u; index < std::size(lifetimes); ++index)
+		for (size_t otherIndex = 0u; otherIndex < std::size(lifetimes); ++otherIndex) {
+			const RenderGraphPlacement& placement = result.placements[index];
+			const RenderGraphPlacement& otherPlacement = result.placements[otherIndex];
+
+			const bool memoryOverlaps = placement.offset < otherPlacement.offset + otherPlacement.size
+				&& otherPlacement.offset < placement.offset + placement.size;
+
+			if (memoryOverlaps && lifetimes[otherIndex].lastUse < lifetimes[index].firstUse)
+				aliasedPredecessors[lifetimes[index].resource].emplace_back(
+					lifetimes[otherIndex].resource
+				);
+		}
+
+	struct ResourceState {
+		VkImageLayout layout;
+		std::uint32_t owner;
+		// The last write, or layout transition, and the reads it has been made visible to
+		// since.
+		VkPipelineStageFlags writeStages;
+		VkAccessFlags writeAccess;
+		VkPipelineStageFlags readStages;
+		VkAccessFlags readAccess;
+		size_t lastUser;
+		VkPipelineStageFlags lastUseStages;
+	};
+
+	std::vector<ResourceState> states;
+	for (const Resource& resource : m_resources)
+		states.emplace_back(ResourceState{
+			.layout = resource.desc.transient ?
+				VK_IMAGE_LAYOUT_UNDEFINED : resource.desc.initialLayout,
+			.owner = resource.desc.transient ?
+				VK_QUEUE_FAMILY_IGNORED : resource.desc.initialQueueFamily,
+			.writeStages = 0u,
+			.writeAccess = 0u,
+			.readStages = 0u,
+			.readAccess = 0u,
+			.lastUser = unused,
+			.lastUseStages = 0u
+		});
+
+	for (size_t position = 0u; position < std::size(result.passes); ++position) {
+		RenderGraphCompiledPass& compiledPass = result.passes[position];
+		RenderGraphBarrierBatch& batch = compiledPass.acquireBarriers;
+		const std::uint32_t queueFamily = compiledPass.queueFamily;
+
+		for (const ResourceAccess& access : m_passes[compiledPass.pass].accesses) {
+			ResourceState& state = states[access.resource];
+			const bool isImage = m_resources[access.resource].desc.type
+				== RenderGraphResourceType::Image;
+
+			const VkImageLayout newLayout = isImage ? access.layout : VK_IMAGE_LAYOUT_UNDEFINED;
+			const bool layoutChange = isImage && newLayout != state.layout;
+			const bool queueChange = state.owner != VK_QUEUE_FAMILY_IGNORED
+				&& state.owner != queueFamily;
+
+			RenderGraphBarrier barrier{
+				.resource = access.resource,
+				.srcAccess = 0u,
+				.dstAccess = access.access,
+				.oldLayout = state.layout,
+				.newLayout = newLayout,
+				.srcQueueFamily = VK_QUEUE_FAMILY_IGNORED,
+				.dstQueueFamily = VK_QUEUE_FAMILY_IGNORED
+			};
+
+			VkPipelineStageFlags srcStages = 0u;
+			bool needed = false;
+
+			if (queueChange) {
+				barrier.srcQueueFamily = state.owner;
+				barrier.dstQueueFamily = queueFamily;
+
+				// The release half goes after the last use on the other queue. A resource
+				// imported from another queue was released before the graph.
+				if (state.lastUser != unused) {
+					RenderGraphCompiledPass& lastUser = result.passes[state.lastUser];
+
+					lastUser.releaseBarriers.srcStages |= state.lastUseStages;
+					lastUser.releaseBarriers.dstStages |= VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+					lastUser.releaseBarriers.barriers.emplace_back(RenderGraphBarrier{
+						.resource = access.resource,
+						.srcAccess = state.writeAccess,
+						.dstAccess = 0u,
+						.oldLayout = state.layout,
+						.newLayout = newLayout,
+						.srcQueueFamily = state.owner,
+						.dstQueueFamily = queueFamily
+					});
+
+					if (std::ranges::find(compiledPass.queueWaits, lastUser.pass)
+						== std::end(compiledPass.queueWaits))
+						compiledPass.queueWaits.emplace_back(lastUser.pass);
+				}
+
+				// The semaphore wait orders the acquire after the release.
+				needed = true;
+			}
+			else if (access.write || layoutChange) {
+				srcStages = state.writeStages | state.readStages;
+				barrier.srcAccess = state.writeAccess;
+
+				// Whatever was in the memory before has to be done with it. A predecessor on
+				// another queue can still be running, so the pass waits for its last user's
+				// submission instead.
+				for (RenderGraphResourceId predecessor : aliasedPredecessors[access.resource]) {
+					if (state.lastUser != unused)
+						break;
+
+					const ResourceState& predecessorState = states[predecessor];
+					const RenderGraphCompiledPass& predecessorUser
+						= result.passes[predecessorState.lastUser];
+
+					if (predecessorUser.queueFamily != queueFamily) {
+						if (std::ranges::find(compiledPass.queueWaits, predecessorUser.pass)
+							== std::end(compiledPass.queueWaits))
+							compiledPass.queueWaits.emplace_back(predecessorUser.pass);
+
+						continue;
+					}
+
+					srcStages |= predecessorState.lastUseStages;
+					barrier.srcAccess |= predecessorState.writeAccess;
+				}
+
+				needed = srcStages != 0u || layoutChange;
+			}
+			else {
+				// Reads which the last write was already made visible to need nothing.
+				const bool notVisible = (access.stages & ~state.readStages)
+					|| (access.access & ~state.readAccess);
+
+				srcStages = state.writeStages;
+				barrier.srcAccess = state.writeAccess;
+				needed = state.writeStages != 0u && notVisible;
+			}
+
+			if (needed) {
+				batch.srcStages |= srcStages;
+				batch.dstStages |= access.stages;
+				batch.barriers.emplace_back(barrier);
+			}
+
+			if (access.write) {
+				state.writeStages = access.stages;
+				state.writeAccess = access.access;
+				state.readStages = 0u;
+				state.readAccess = 0u;
+			}
+			else if (layoutChange || queueChange) {
+				// The transition is a write which only the stages of this pass wait for.
+				state.writeStages = access.stages;
+				state.writeAccess = 0u;
+				state.readStages = access.stages;
+				state.readAccess = access.access;
+			}
+			else {
+				state.readStages |= access.stages;
+				state.readAccess |= access.access;
+			}
+
+			if (state.lastUser != position)
+				state.lastUseStages = 0u;
+
+			state.lastUseStages |= access.stages;
+			state.lastUser = position;
+			state.layout = newLayout;
+			state.owner = queueFamily;
+		}
+
+		if (!batch.IsEmpty() && batch.srcStages == 0u)
+			batch.srcStages = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+	}
+
+	for (const RenderGraphCompiledPass& compiledPass : result.passes)
+		for (const RenderGraphBarrierBatch* batch :
+			{ &compiledPass.acquireBarriers, &compiledPass.releaseBarriers })
+			if (!batch->IsEmpty()) {
+				++result.batchCount;
+				result.barrierCount += std::size(batch->barriers);
+			}
+
+	return result;
+}
+
+std::vector<RenderGraphPlacement> PlaceTransientResources(
+	std::span<const TransientLifetime> lifetimes, VkDeviceSize& totalSize
+) {
+	std::vector<RenderGraphPlacement> placements(std::size(lifetimes));
+	std::vector<bool> placed(std::size(lifetimes), false);
+
+	std::vector<size_t> order(std::size(lifetimes));
+	std::iota(std::begin(order), std::end(order), size_t{ 0u });
+	std::ranges::stable_sort(order, std::ranges::greater{}, [lifetimes](size_t index) {
+		return lifetimes[index].size;
+	});
+
+	totalSize = 0u;
+
+	auto alignUp = [](VkDeviceSize offset, VkDeviceSize alignment) noexcept {
+		return alignment > 1u ? (offset + alignment - 1u) / alignment * alignment : offset;
+	};
+
+	for (size_t index : order) {
+		const TransientLifetime& lifetime = lifetimes[index];
+
+		// The placed resources which are alive at the same time.
+		std::vector<size_t> conflicts;
+		for (size_t otherIndex = 0u; otherIndex < std::size(lifetimes); ++otherIndex)
+			if (placed[otherIndex] && lifetimes[otherIndex].firstUse <= lifetime.lastUse
+				&& lifetime.firstUse <= lifetimes[otherIndex].lastUse)
+				conflicts.emplace_back(otherIndex);
+
+		std::vector<VkDeviceSize> candidates{ 0u };
+		for (size_t conflict : conflicts)
+			candidates.emplace_back(
+				alignUp(placements[conflict].offset + placements[conflict].size, lifetime.alignment)
+			);
+
+		std::ranges::sort(candidates);
+
+		VkDeviceSize offset = candidates.back();
+		for (VkDeviceSize candidate : candidates) {
+			const bool fits = std::ranges::none_of(conflicts, [&](size_t conflict) {
+				return candidate < placements[conflict].offset + placements[conflict].size
+					&& placements[conflict].offset < candidate + lifetime.size;
+			});
+
+			if (fits) {
+				offset = candidate;
+
+				break;
+			}
+		}
+
+		placements[index] = RenderGraphPlacement{
+			.resource = lifetime.resource, .offset = offset, .size = lifetime.size
+		};
+		placed[index] = true;
+
+		totalSize = std::max(totalSize, offset + lifetime.size);
+	}
+
+	return placements;
+}
+
+void RecordBarriers(
+	VkCommandBuffer commandBuffer, const RenderGraphBarrierBatch& batch,
+	std::span<const RenderGraphResourceHandle> resources
+) {
+	if (batch.IsEmpty())
+		return;
+
+	std::vector<VkBufferMemoryBarrier> bufferBarriers;
+	std::vector<VkImageMemoryBarrier> imageBarriers;
+
+	for (const RenderGraphBarrier& barrier : batch.barriers) {
+		const RenderGraphResourceHandle& handle = resources[barrier.resource];
+
+		if (handle.image != VK_NULL_HANDLE)
+			imageBarriers.emplace_back(VkImageMemoryBarrier{
+				.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+				.srcAccessMask = barrier.srcAccess,
+				.dstAccessMask = barrier.dstAccess,
+				.oldLayout = barrier.oldLayout,
+				.newLayout = barrier.newLayout,
+				.srcQueueFamilyIndex = barrier.srcQueueFamily,
+				.dstQueueFamilyIndex = barrier.dstQueueFamily,
+				.image = handle.image,
+				.subresourceRange = VkImageSubresourceRange{
+					.aspectMask = handle.aspect,
+					.baseMipLevel = 0u,
+					.levelCount = VK_REMAINING_MIP_LEVELS,
+					.baseArrayLayer = 0u,
+					.layerCount = VK_REMAINING_ARRAY_LAYERS
+				}
+			});
+		else
+			bufferBarriers.emplace_back(VkBufferMemoryBarrier{
+				.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+				.srcAccessMask = barrier.srcAccess,
+				.dstAccessMask = barrier.dstAccess,
+				.srcQueueFamilyIndex = barrier.srcQueueFamily,
+				.dstQueueFamilyIndex = barrier.dstQueueFamily,
+				.buffer = handle.buffer,
+				.offset = 0u,
+				.size = VK_WHOLE_SIZE
+			});
+	}
+
+	vkCmdPipelineBarrier(
+		commandBuffer, batch.srcStages, batch.dstStages, 0u, 0u, nullptr,
+		static_cast<std::uint32_t>(std::size(bufferBarriers)), std::data(bufferBarriers),
+		static_cast<std::uint32_t>(std::size(imageBarriers)), std::data(imageBarriers)
+	);
+}
@@ -0,0 +1,181 @@
+#ifndef RENDER_GRAPH_HPP_
+#define RENDER_GRAPH_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+using RenderGraphResourceId = std::uint32_t;
+using RenderGraphPassId = std::uint32_t;
+
+enum class RenderGraphResourceType {
+	Buffer,
+	Image
+};
+
+struct RenderGraphResourceDesc {
+	RenderGraphResourceType type;
+	// Transient resources only live inside the graph and share memory with the ones whose
+	// lifetimes don't overlap. The others are imported, like the swapchain images.
+	bool transient;
+	// The memory requirements of a transient resource.
+	VkDeviceSize size;
+	VkDeviceSize alignment;
+	// The state of an imported resource when the graph starts.
+	VkImageLayout initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	std::uint32_t initialQueueFamily = VK_QUEUE_FAMILY_IGNORED;
+};
+
+struct RenderGraphBarrier {
+	RenderGraphResourceId resource;
+	VkAccessFlags srcAccess;
+	VkAccessFlags dstAccess;
+	// Always undefined for buffers.
+	VkImageLayout oldLayout;
+	VkImageLayout newLayout;
+	// Ignored unless the resource changes queue family.
+	std::uint32_t srcQueueFamily;
+	std::uint32_t dstQueueFamily;
+};
+
+// Everything one vkCmdPipelineBarrier call does.
+struct RenderGraphBarrierBatch {
+	VkPipelineStageFlags srcStages = 0u;
+	VkPipelineStageFlags dstStages = 0u;
+	std::vector<RenderGraphBarrier> barriers;
+
+	[[nodiscard]]
+	bool IsEmpty() const noexcept { return std::empty(barriers); }
+};
+
+struct RenderGraphCompiledPass {
+	RenderGraphPassId pass;
+	std::string name;
+	std::uint32_t queueFamily;
+	// Recorded before the pass.
+	RenderGraphBarrierBatch acquireBarriers;
+	// Recorded after the pass, the halves of the ownership transfers to other queues.
+	RenderGraphBarrierBatch releaseBarriers;
+	// Passes on other queues whose submission this one has to wait on with a semaphore, for
+	// an ownership transfer or because a transient resource reuses their resource's memory.
+	std::vector<RenderGraphPassId> queueWaits;
+};
+
+struct RenderGraphPlacement {
+	RenderGraphResourceId resource;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+};
+
+struct RenderGraphCompileResult {
+	// In declaration order, without the culled passes.
+	std::vector<RenderGraphCompiledPass> passes;
+	std::vector<RenderGraphPassId> culledPasses;
+	// Where each transient resource goes in a single allocation of transientMemorySize.
+	std::vector<RenderGraphPlacement> placements;
+	VkDeviceSize transientMemorySize = 0u;
+	// What the transient resources would take with memory of their own.
+	VkDeviceSize unaliasedMemorySize = 0u;
+	size_t barrierCount = 0u;
+	size_t batchCount = 0u;
+};
+
+// Passes declare which resources they read and write, in submission order. Compile removes the
+// passes nothing observable depends on, works out the barriers every pass needs and merges
+// them into one batch per pass, adds the queue family ownership transfers and places the
+// transient resources in one memory range. It doesn't touch the device, so the whole compile is
+// testable without one; RecordBarriers turns the batches into commands.
+class RenderGraph {
+public:
+	static constexpr std::uint32_t invalidId = std::numeric_limits<std::uint32_t>::max();
+
+public:
+	RenderGraphResourceId AddResource(std::string name, const RenderGraphResourceDesc& desc);
+	// Passes with side effects, presenting or writing to the host, are never culled.
+	RenderGraphPassId AddPass(std::string name, std::uint32_t queueFamily, bool sideEffects = false);
+
+	// The layout is ignored for buffers. A pass which uses a resource twice gets the union of
+	// the uses, images need the same layout for both.
+	void Read(
+		RenderGraphPassId pass, RenderGraphResourceId resource, VkPipelineStageFlags stages,
+		VkAccessFlags access, VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED
+	);
+	void Write(
+		RenderGraphPassId pass, RenderGraphResourceId resource, VkPipelineStageFlags stages,
+		VkAccessFlags access, VkImageLayout layout = VK_IMAGE_LAYOUT_UNDEFINED
+	);
+	// The contents are used after the graph, so the passes writing it are kept.
+	void MarkOutput(RenderGraphResourceId resource);
+
+	[[nodiscard]]
+	RenderGraphCompileResult Compile() const;
+
+	[[nodiscard]]
+	const std::string& GetResourceName(RenderGraphResourceId resource) const noexcept;
+	[[nodiscard]]
+	size_t GetPassCount() const noexcept;
+
+private:
+	struct ResourceAccess {
+		RenderGraphResourceId resource;
+		VkPipelineStageFlags stages;
+		VkAccessFlags access;
+		VkImageLayout layout;
+		// Both are set when a pass reads and writes the resource.
+		bool read;
+		bool write;
+	};
+
+	struct Resource {
+		std::string name;
+		RenderGraphResourceDesc desc;
+		bool output;
+	};
+
+	struct Pass {
+		std::string name;
+		std::uint32_t queueFamily;
+		bool sideEffects;
+		std::vector<ResourceAccess> accesses;
+	};
+
+private:
+	void AddAccess(RenderGraphPassId pass, const ResourceAccess& access);
+
+	[[nodiscard]]
+	std::vector<bool> FindLivePasses() const;
+
+private:
+	std::vector<Resource> m_resources;
+	std::vector<Pass> m_passes;
+};
+
+// First fit of the transient lifetimes, the largest first. The lifetimes are in compiled pass
+// positions and inclusive; resources whose lifetimes overlap never share memory.
+struct TransientLifetime {
+	RenderGraphResourceId resource;
+	size_t firstUse;
+	size_t lastUse;
+	VkDeviceSize size;
+	VkDeviceSize alignment;
+};
+
+[[nodiscard]]
+std::vector<RenderGraphPlacement> PlaceTransientResources(
+	std::span<const TransientLifetime> lifetimes, VkDeviceSize& totalSize
+);
+
+struct RenderGraphResourceHandle {
+	VkBuffer buffer = VK_NULL_HANDLE;
+	VkImage image = VK_NULL_HANDLE;
+	VkImageAspectFlags aspect = 0u;
+};
+
+// The handles are indexed by resource id.
+void RecordBarriers(
+	VkCommandBuffer commandBuffer, const RenderGraphBarrierBatch& batch,
+	std::span<const RenderGraphResourceHandle> resources
+);
+#endif
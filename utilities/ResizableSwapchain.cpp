@@ -0,0 +1,368 @@
+#include <ResizableSwapchain.hpp>
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+VkPresentModeKHR ChoosePresentMode(
+	std::span<const VkPresentModeKHR> supportedModes,
+	std::span<const VkPresentModeKHR> preferredModes
+) noexcept {
+	for (VkPresentModeKHR preferredMode : preferredModes)
+		if (std::ranges::find(supportedModes, preferredMode) != std::end(supportedModes))
+			return preferredMode;
+
+	return VK_PRESENT_MODE_FIFO_KHR;
+}
+
+std::uint32_t ChooseImageCount(
+	const VkSurfaceCapabilitiesKHR& capabilities, std::uint32_t requestedCount
+) noexcept {
+	std::uint32_t imageCount = std::max(requestedCount, capabilities.minImageCount);
+
+	if (capabilities.maxImageCount)
+		imageCount = std::min(imageCount, capabilities.maxImageCount);
+
+	return imageCount;
+}
+
+VkExtent2D ChooseExtent(
+	const VkSurfaceCapabilitiesKHR& capabilities, std::uint32_t width, std::uint32_t height
+) noexcept {
+	if (capabilities.currentExtent.width != std::numeric_limits<std::uint32_t>::max())
+		return capabilities.currentExtent;
+
+	return VkExtent2D{
+		.width = std::clamp(
+			width, capabilities.minImageExtent.width, capabilities.maxImageExtent.width
+		),
+		.height = std::clamp(
+			height, capabilities.minImageExtent.height, capabilities.maxImageExtent.height
+		)
+	};
+}
+
+VkImageUsageFlags ChooseImageUsage(
+	const VkSurfaceCapabilitiesKHR& capabilities, VkImageUsageFlags requestedUsage
+) noexcept {
+	return requestedUsage & capabilities.supportedUsageFlags;
+}
+
+VkCompositeAlphaFlagBitsKHR ChooseCompositeAlpha(
+	const VkSurfaceCapabilitiesKHR& capabilities
+) noexcept {
+	static constexpr std::array compositeAlphas{
+		VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR, VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR,
+		VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR, VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR
+	};
+
+	for (VkCompositeAlphaFlagBitsKHR compositeAlpha : compositeAlphas)
+		if (capabilities.supportedCompositeAlpha & compositeAlpha)
+			return compositeAlpha;
+
+	return VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+}
+
+FramePacingStats::FramePacingStats(size_t windowSize)
+	: m_acquireWaits{ .samples = std::vector<double>(windowSize), .nextIndex = 0u, .count = 0u },
+	m_presentIntervals{
+		.samples = std::vector<double>(windowSize), .nextIndex = 0u, .count = 0u
+	},
+	m_lastPresent{}, m_presentCount{ 0u } {}
+
+void FramePacingStats::SampleWindow::Add(double sample) noexcept {
+	if (std::empty(samples))
+		return;
+
+	samples[nextIndex] = sample;
+	nextIndex = (nextIndex + 1u) % std::size(samples);
+	count = std::min(count + 1u, std::size(samples));
+}
+
+FramePacingSeries FramePacingStats::SampleWindow::Summarise() const {
+	if (!count)
+		return FramePacingSeries{ .averageUs = 0.0, .maxUs = 0.0, .percentile95Us = 0.0 };
+
+	// Until the window is full the samples are at its front.
+	std::vector<double> sortedSamples{ std::begin(samples), std::begin(samples) + count };
+	std::ranges::sort(sortedSamples);
+
+	const size_t percentileIndex = (count * 95u + 99u) / 100u - 1u;
+
+	return FramePacingSeries{
+		.averageUs = std::accumulate(std::begin(sortedSamples), std::end(sortedSamples), 0.0)
+			/ static_cast<double>(count),
+		.maxUs = sortedSamples.back(),
+		.percentile95Us = sortedSamples[percentileIndex],
+		.sampleCount = count
+	};
+}
+
+void FramePacingStats::AddAcquireWait(std::chrono::nanoseconds waitTime) noexcept {
+	m_acquireWaits.Add(std::chrono::duration<double, std::micro>{ waitTime }.count());
+}
+
+void FramePacingStats::AddPresent(Clock::time_point presentTime) noexcept {
+	if (m_presentCount)
+		m_presentIntervals.Add(
+			std::chrono::duration<double, std::micro>{ presentTime - m_lastPresent }.count()
+		);
+
+	m_lastPresent = presentTime;
+	++m_presentCount;
+}
+
+void FramePacingStats::Reset() noexcept {
+	for (SampleWindow* window : { &m_acquireWaits, &m_presentIntervals }) {
+		window->nextIndex = 0u;
+		window->count = 0u;
+	}
+
+	m_presentCount = 0u;
+}
+
+FramePacingSummary FramePacingStats::GetSummary() const {
+	return FramePacingSummary{
+		.acquireWait = m_acquireWaits.Summarise(),
+		.presentInterval = m_presentIntervals.Summarise(),
+		.presentCount = m_presentCount
+	};
+}
+
+ResizableSwapchain::ResizableSwapchain(VkDevice device, const Args& arguments)
+	: m_deviceRef{ device }, m_presentQueue{ arguments.presentQueue },
+	m_swapchain{ VK_NULL_HANDLE }, m_extent{}, m_format{ arguments.surfaceFormat.format },
+	m_presentMode{ VK_PRESENT_MODE_FIFO_KHR }, m_imageUsage{ 0u }, m_recreationNeeded{ false },
+	m_swapchainRetired{ false }, m_pacingStats{ arguments.pacingWindowSize } {
+	// Without an area there is nothing to create yet, the first Recreate will.
+	m_recreationNeeded = !CreateSwapchain(device, arguments);
+}
+
+ResizableSwapchain::~ResizableSwapchain() noexcept {
+	for (VkImageView imageView : m_imageViews)
+		vkDestroyImageView(m_deviceRef, imageView, nullptr);
+
+	vkDestroySwapchainKHR(m_deviceRef, m_swapchain, nullptr);
+}
+
+std::vector<VkPresentModeKHR> ResizableSwapchain::QueryPresentModes(
+	VkPhysicalDevice physicalDevice, VkSurfaceKHR surface
+) {
+	std::uint32_t modeCount = 0u;
+	vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &modeCount, nullptr);
+
+	std::vector<VkPresentModeKHR> presentModes(modeCount);
+	vkGetPhysicalDeviceSurfacePresentModesKHR(
+		physicalDevice, surface, &modeCount, std::data(presentModes)
+	);
+
+	return presentModes;
+}
+
+bool ResizableSwapchain::CreateSwapchain(VkDevice device, const Args& arguments) {
+	VkSurfaceCapabilitiesKHR capabilities{};
+	vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		arguments.physicalDevice, arguments.surface, &capabilities
+	);
+
+	const VkExtent2D extent = ChooseExtent(capabilities, arguments.width, arguments.height);
+
+	if (!extent.width || !extent.height)
+		return false;
+
+	const VkPresentModeKHR presentMode = ChoosePresentMode(
+		QueryPresentModes(arguments.physicalDevice, arguments.surface), arguments.presentModes
+	);
+
+	const VkImageUsageFlags imageUsage = ChooseImageUsage(capabilities, arguments.imageUsage);
+
+	VkSwapchainCreateInfoKHR createInfo{
+		.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+		.surface = arguments.surface,
+		.minImageCount = ChooseImageCount(capabilities, arguments.imageCount),
+		.imageFormat = arguments.surfaceFormat.format,
+		.imageColorSpace = arguments.surfaceFormat.colorSpace,
+		.imageExtent = extent,
+		.imageArrayLayers = 1u,
+		.imageUsage = imageUsage,
+		.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.preTransform = capabilities.currentTransform,
+		.compositeAlpha = ChooseCompositeAlpha(capabilities),
+		.presentMode = presentMode,
+		.clipped = VK_TRUE,
+		// A retired swapchain can't be the old one of another.
+		.oldSwapchain = m_swapchainRetired ? VK_NULL_HANDLE : m_swapchain
+	};
+
+	VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+	if (vkCreateSwapchainKHR(device, &createInfo, nullptr, &swapchain) != VK_SUCCESS) {
+		// The old swapchain is retired even when the new one couldn't be created.
+		if (m_swapchain != VK_NULL_HANDLE)
+			m_swapchainRetired = true;
+
+		return false;
+	}
+
+	m_swapchain = swapchain;
+	m_swapchainRetired = false;
+	m_extent = extent;
+	m_format = arguments.surfaceFormat.format;
+	m_presentMode = presentMode;
+	m_imageUsage = imageUsage;
+	m_presentQueue = arguments.presentQueue;
+
+	std::uint32_t imageCount = 0u;
+	vkGetSwapchainImagesKHR(device, m_swapchain, &imageCount, nullptr);
+
+	m_images.resize(imageCount);
+	vkGetSwapchainImagesKHR(device, m_swapchain, &imageCount, std::data(m_images));
+
+	CreateImageViews(device);
+
+	return true;
+}
+
+void ResizableSwapchain::CreateImageViews(VkDevice device) {
+	m_imageViews.clear();
+
+	for (VkImage image : m_images) {
+		VkImageViewCreateInfo viewInfo{
+			.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+			.image = image,
+			.viewType = VK_IMAGE_VIEW_TYPE_2D,
+			.format = m_format,
+			.subresourceRange = VkImageSubresourceRange{
+				.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+				.baseMipLevel = 0u,
+				.levelCount = 1u,
+				.baseArrayLayer = 0u,
+				.layerCount = 1u
+			}
+		};
+
+		VkImageView imageView = VK_NULL_HANDLE;
+		vkCreateImageView(device, &viewInfo, nullptr, &imageView);
+
+		m_imageViews.emplace_back(imageView);
+	}
+}
+
+bool ResizableSwapchain::Recreate(
+	VkDevice device, const Args& arguments, DeferredDestructionQueue& destructionQueue,
+	std::uint64_t lastUseValue
+) {
+	VkSwapchainKHR oldSwapchain = m_swapchain;
+	std::vector<VkImageView> oldImageViews = std::move(m_imageViews);
+	m_imageViews.clear();
+
+	if (!CreateSwapchain(device, arguments)) {
+		m_imageViews = std::move(oldImageViews);
+		m_recreationNeeded = true;
+
+		return false;
+	}
+
+	// The old swapchain is retired now, but images acquired from it can still be presented.
+	// Presents don't signal fences, so the frame which presented an image is taken as the last
+	// use of it.
+	for (VkImageView imageView : oldImageViews)
+		destructionQueue.EnqueueImageView(lastUseValue, imageView);
+
+	if (oldSwapchain != VK_NULL_HANDLE)
+		destructionQueue.Enqueue(lastUseValue, [oldSwapchain](VkDevice logicalDevice) {
+			vkDestroySwapchainKHR(logicalDevice, oldSwapchain, nullptr);
+		});
+
+	m_recreationNeeded = false;
+
+	return true;
+}
+
+VkResult ResizableSwapchain::AcquireNextImage(
+	VkDevice device, VkSemaphore signalSemaphore, std::uint32_t& imageIndex,
+	std::uint64_t timeout
+) {
+	// Nothing can be acquired from a retired swapchain.
+	if (m_swapchainRetired) {
+		m_recreationNeeded = true;
+
+		return VK_ERROR_OUT_OF_DATE_KHR;
+	}
+
+	const FramePacingStats::Clock::time_point waitStart = FramePacingStats::Clock::now();
+
+	const VkResult result = vkAcquireNextImageKHR(
+		device, m_swapchain, timeout, signalSemaphore, VK_NULL_HANDLE, &imageIndex
+	);
+
+	m_pacingStats.AddAcquireWait(FramePacingStats::Clock::now() - waitStart);
+
+	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+		m_recreationNeeded = true;
+
+	return result;
+}
+
+VkResult ResizableSwapchain::Present(VkSemaphore waitSemaphore, std::uint32_t imageIndex) {
+	VkPresentInfoKHR presentInfo{
+		.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+		.waitSemaphoreCount = waitSemaphore != VK_NULL_HANDLE ? 1u : 0u,
+		.pWaitSemaphores = &waitSemaphore,
+		.swapchainCount = 1u,
+		.pSwapchains = &m_swapchain,
+		.pImageIndices = &imageIndex
+	};
+
+	const VkResult result = vkQueuePresentKHR(m_presentQueue, &presentInfo);
+
+	if (result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR)
+		m_pacingStats.AddPresent(FramePacingStats::Clock::now());
+
+	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR)
+		m_recreationNeeded = true;
+
+	return result;
+}
+
+bool ResizableSwapchain::IsRecreationNeeded() const noexcept {
+	return m_recreationNeeded;
+}
+
+VkSwapchainKHR ResizableSwapchain::GetSwapchain() const noexcept {
+	return m_swapchain;
+}
+
+VkImage ResizableSwapchain::GetImage(std::uint32_t imageIndex) const noexcept {
+	return m_images[imageIndex];
+}
+
+VkImageView ResizableSwapchain::GetImageView(std::uint32_t imageIndex) const noexcept {
+	return m_imageViews[imageIndex];
+}
+
+std::uint32_t ResizableSwapchain::GetImageCount() const noexcept {
+	return static_cast<std::uint32_t>(std::size(m_images));
+}
+
+VkExtent2D ResizableSwapchain::GetExtent() const noexcept {
+	return m_extent;
+}
+
+VkFormat ResizableSwapchain::GetFormat() const noexcept {
+	return m_format;
+}
+
+VkPresentModeKHR ResizableSwapchain::GetPresentMode() const noexcept {
+	return m_presentMode;
+}
+
+VkImageUsageFlags ResizableSwapchain::GetImageUsage() const noexcept {
+	return m_imageUsage;
+}
+
+FramePacingSummary ResizableSwapchain::GetPacingSummary() const {
+	return m_pacingStats.GetSummary();
+}
+
+void ResizableSwapchain::ResetPacingStats() noexcept {
+	m_pacingStats.Reset();
+}
@@ -0,0 +1,189 @@
+#ifndef RESIZABLE_SWAPCHAIN_HPP_
+#define RESIZABLE_SWAPCHAIN_HPP_
+#include <vulkan/vulkan.hpp>
+#include <DeferredDestructionQueue.hpp>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// The first of the preferred modes the surface supports, FIFO otherwise as every surface has
+// to support it.
+[[nodiscard]]
+VkPresentModeKHR ChoosePresentMode(
+	std::span<const VkPresentModeKHR> supportedModes,
+	std::span<const VkPresentModeKHR> preferredModes
+) noexcept;
+// Clamped to the surface's limits, a maxImageCount of 0 means there is no upper limit.
+[[nodiscard]]
+std::uint32_t ChooseImageCount(
+	const VkSurfaceCapabilitiesKHR& capabilities, std::uint32_t requestedCount
+) noexcept;
+// The surface decides the extent unless its current extent is the special value, then the
+// requested size is clamped to its limits.
+[[nodiscard]]
+VkExtent2D ChooseExtent(
+	const VkSurfaceCapabilitiesKHR& capabilities, std::uint32_t width, std::uint32_t height
+) noexcept;
+// The requested usage without the flags the surface doesn't support. Every surface supports
+// color attachments.
+[[nodiscard]]
+VkImageUsageFlags ChooseImageUsage(
+	const VkSurfaceCapabilitiesKHR& capabilities, VkImageUsageFlags requestedUsage
+) noexcept;
+// Opaque if the surface supports it, otherwise the first of the modes it does, as every surface
+// supports at least one.
+[[nodiscard]]
+VkCompositeAlphaFlagBitsKHR ChooseCompositeAlpha(
+	const VkSurfaceCapabilitiesKHR& capabilities
+) noexcept;
+
+struct FramePacingSeries {
+	double averageUs;
+	double maxUs;
+	double percentile95Us;
+	size_t sampleCount;
+};
+
+struct FramePacingSummary {
+	// How long the CPU was blocked in vkAcquireNextImageKHR.
+	FramePacingSeries acquireWait;
+	// The CPU time between two successful presents.
+	FramePacingSeries presentInterval;
+	std::uint64_t presentCount;
+};
+
+// The last windowSize samples of the acquire waits and present intervals.
+class FramePacingStats {
+public:
+	using Clock = std::chrono::steady_clock;
+
+public:
+	explicit FramePacingStats(size_t windowSize);
+
+	void AddAcquireWait(std::chrono::nanoseconds waitTime) noexcept;
+	void AddPresent(Clock::time_point presentTime) noexcept;
+	void Reset() noexcept;
+
+	[[nodiscard]]
+	FramePacingSummary GetSummary() const;
+
+private:
+	struct SampleWindow {
+		std::vector<double> samples;
+		size_t nextIndex;
+		size_t count;
+
+		void Add(double sample) noexcept;
+		[[nodiscard]]
+		FramePacingSeries Summarise() const;
+	};
+
+private:
+	SampleWindow m_acquireWaits;
+	SampleWindow m_presentIntervals;
+	Clock::time_point m_lastPresent;
+	std::uint64_t m_presentCount;
+};
+
+// A swapchain which can be recreated in place. The new one is created with the old one as
+// oldSwapchain, so presentation continues while it is replaced, and the old swapchain and its
+// image views are handed to a DeferredDestructionQueue instead of waiting for the device. The
+// caller tags them with the value of the last frame which used the old images and retires its
+// own framebuffers with the same value, the frame fences then release all of them in Collect.
+// Present mode, image count and size can change with every recreation. If creating the new
+// swapchain fails, the old one is retired anyway. Until a recreation succeeds, AcquireNextImage
+// returns out of date then, and only the images acquired before can still be presented.
+class ResizableSwapchain {
+public:
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		VkSurfaceKHR surface;
+		VkQueue presentQueue;
+		VkSurfaceFormatKHR surfaceFormat;
+		std::uint32_t width;
+		std::uint32_t height;
+		std::uint32_t imageCount;
+		// In order of preference, like MAILBOX then IMMEDIATE for the lowest latency, or
+		// FIFO_RELAXED to not stutter when a frame is late.
+		std::vector<VkPresentModeKHR> presentModes;
+		size_t pacingWindowSize = 240u;
+		// The flags the surface doesn't support are left out, GetImageUsage has the ones the
+		// images were created with.
+		VkImageUsageFlags imageUsage =
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+	};
+
+public:
+	ResizableSwapchain(VkDevice device, const Args& arguments);
+	~ResizableSwapchain() noexcept;
+
+	ResizableSwapchain(const ResizableSwapchain&) = delete;
+	ResizableSwapchain& operator=(const ResizableSwapchain&) = delete;
+
+	// Returns false if the surface has no area, as when a window is minimised, or the
+	// swapchain couldn't be created; the old images and views are kept then. The images are in
+	// the undefined layout afterwards.
+	[[nodiscard]]
+	bool Recreate(
+		VkDevice device, const Args& arguments, DeferredDestructionQueue& destructionQueue,
+		std::uint64_t lastUseValue
+	);
+
+	// Both record the CPU time for the pacing stats. Out of date and suboptimal results set
+	// the recreation flag, the image of a suboptimal acquire can still be presented.
+	[[nodiscard]]
+	VkResult AcquireNextImage(
+		VkDevice device, VkSemaphore signalSemaphore, std::uint32_t& imageIndex,
+		std::uint64_t timeout = UINT64_MAX
+	);
+	[[nodiscard]]
+	VkResult Present(VkSemaphore waitSemaphore, std::uint32_t imageIndex);
+
+	[[nodiscard]]
+	bool IsRecreationNeeded() const noexcept;
+	[[nodiscard]]
+	VkSwapchainKHR GetSwapchain() const noexcept;
+	[[nodiscard]]
+	VkImage GetImage(std::uint32_t imageIndex) const noexcept;
+	[[nodiscard]]
+	VkImageView GetImageView(std::uint32_t imageIndex) const noexcept;
+	[[nodiscard]]
+	std::uint32_t GetImageCount() const noexcept;
+	[[nodiscard]]
+	VkExtent2D GetExtent() const noexcept;
+	[[nodiscard]]
+	VkFormat GetFormat() const noexcept;
+	[[nodiscard]]
+	VkPresentModeKHR GetPresentMode() const noexcept;
+	[[nodiscard]]
+	VkImageUsageFlags GetImageUsage() const noexcept;
+	[[nodiscard]]
+	FramePacingSummary GetPacingSummary() const;
+	void ResetPacingStats() noexcept;
+
+	[[nodiscard]]
+	static std::vector<VkPresentModeKHR> QueryPresentModes(
+		VkPhysicalDevice physicalDevice, VkSurfaceKHR surface
+	);
+
+private:
+	[[nodiscard]]
+	bool CreateSwapchain(VkDevice device, const Args& arguments);
+	void CreateImageViews(VkDevice device);
+
+private:
+	VkDevice m_deviceRef;
+	VkQueue m_presentQueue;
+	VkSwapchainKHR m_swapchain;
+	VkExtent2D m_extent;
+	VkFormat m_format;
+	VkPresentModeKHR m_presentMode;
+	VkImageUsageFlags m_imageUsage;
+	std::vector<VkImage> m_images;
+	std::vector<VkImageView> m_imageViews;
+	bool m_recreationNeeded;
+	bool m_swapchainRetired;
+	FramePacingStats m_pacingStats;
+};
+#endif
@@ -0,0 +1,89 @@
+#include <RingAllocator.hpp>
+#include <algorithm>
+
+[[nodiscard]]
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept {
+	return (value + alignment - 1u) & ~(alignment - 1u);
+}
+
+RingAllocator::RingAllocator(VkDeviceSize size) noexcept
+	: m_size{ size }, m_head{ 0u }, m_tail{ 0u }, m_usedSize{ 0u }, m_currentFrameSize{ 0u } {}
+
+std::optional<VkDeviceSize> RingAllocator::Allocate(
+	VkDeviceSize size, VkDeviceSize alignment
+) noexcept {
+	alignment = std::max<VkDeviceSize>(alignment, 1u);
+
+	if (size == 0u || size > m_size)
+		return {};
+
+	// Nothing is alive, so the whole ring can be used from the start again.
+	if (m_usedSize == 0u && std::empty(m_framesInFlight)) {
+		m_head = 0u;
+		m_tail = 0u;
+	}
+
+	VkDeviceSize offset = AlignUp(m_head, alignment);
+	VkDeviceSize skippedSize = offset - m_head;
+
+	// The free space is either the single range between the head and the tail, or the end of
+	// the ring followed by its start.
+	const bool headBehindTail = m_head < m_tail || (m_head == m_tail && m_usedSize != 0u);
+
+	if (headBehindTail) {
+		if (offset > m_tail || size > m_tail - offset)
+			return {};
+	}
+	else if (offset > m_size || size > m_size - offset) {
+		// Doesn't fit at the end, so it starts over from the beginning.
+		if (size > m_tail)
+			return {};
+
+		offset = 0u;
+		skippedSize = m_size - m_head;
+	}
+
+	const VkDeviceSize allocatedSize = skippedSize + size;
+
+	m_head = offset + size;
+	m_usedSize += allocatedSize;
+	m_currentFrameSize += allocatedSize;
+
+	if (m_head == m_size)
+		m_head = 0u;
+
+	return offset;
+}
+
+void RingAllocator::FinishFrame() noexcept {
+	m_framesInFlight.emplace_back(FrameRange{
+		.endOffset = m_head,
+		.usedSize = m_currentFrameSize
+	});
+
+	m_currentFrameSize = 0u;
+}
+
+void RingAllocator::ReclaimFrame() noexcept {
+	if (std::empty(m_framesInFlight))
+		return;
+
+	const FrameRange& frame = m_framesInFlight.front();
+
+	m_tail = frame.endOffset;
+	m_usedSize -= frame.usedSize;
+
+	m_framesInFlight.pop_front();
+}
+
+VkDeviceSize RingAllocator::GetSize() const noexcept {
+	return m_size;
+}
+
+VkDeviceSize RingAllocator::GetUsedSize() const noexcept {
+	return m_usedSize;
+}
+
+size_t RingAllocator::GetFramesInFlight() const noexcept {
+	return std::size(m_framesInFlight);
+}
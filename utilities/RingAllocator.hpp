@@ -0,0 +1,45 @@
+#ifndef RING_ALLOCATOR_HPP_
+#define RING_ALLOCATOR_HPP_
+#include <vulkan/vulkan.hpp>
+#include <deque>
+#include <optional>
+
+// Hands out offsets from a ring, for data which is written once per frame. The allocations of a
+// frame are only reclaimed as a whole, once the GPU has finished that frame, and frames have to
+// be reclaimed in the order they were finished in. Only deals with offsets, so it can be tested
+// on the CPU.
+class RingAllocator {
+public:
+	RingAllocator(VkDeviceSize size) noexcept;
+
+	// Allocations never wrap around the end, the leftover space at the end is skipped instead.
+	[[nodiscard]]
+	std::optional<VkDeviceSize> Allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept;
+	// Closes the current frame, everything allocated since the last call belongs to it.
+	void FinishFrame() noexcept;
+	// Frees the oldest finished frame.
+	void ReclaimFrame() noexcept;
+
+	[[nodiscard]]
+	VkDeviceSize GetSize() const noexcept;
+	// Includes the alignment padding and the space skipped at the end of the ring.
+	[[nodiscard]]
+	VkDeviceSize GetUsedSize() const noexcept;
+	[[nodiscard]]
+	size_t GetFramesInFlight() const noexcept;
+
+private:
+	struct FrameRange {
+		VkDeviceSize endOffset;
+		VkDeviceSize usedSize;
+	};
+
+private:
+	VkDeviceSize m_size;
+	VkDeviceSize m_head;
+	VkDeviceSize m_tail;
+	VkDeviceSize m_usedSize;
+	VkDeviceSize m_currentFrameSize;
+	std::deque<FrameRange> m_framesInFlight;
+};
+#endif
@@ -0,0 +1,130 @@
+#include <ShaderLibrary.hpp>
+#include <algorithm>
+#include <mutex>
+
+ShaderLibrary::ShaderLibrary() noexcept : m_hitCount{ 0u }, m_missCount{ 0u } {}
+
+ShaderLibrary::SharedShader ShaderLibrary::GetShader(
+	VkDevice device, std::span<const std::uint32_t> spirv
+) {
+	const std::uint64_t hash = HashSpirv(spirv);
+
+	{
+		std::shared_lock lock{ m_libraryMutex };
+
+		if (SharedShader shader = FindShader(hash, spirv)) {
+			++m_hitCount;
+
+			return shader;
+		}
+	}
+
+	// The module is created outside of the lock, so other lookups aren't blocked by it.
+	auto newShader = std::make_shared<SpirvShader>(device);
+	newShader->CreateShader(device, spirv);
+
+	if (newShader->GetShaderModule() == VK_NULL_HANDLE)
+		return nullptr;
+
+	std::unique_lock lock{ m_libraryMutex };
+
+	// Another thread could have added the same SPIR-V in the meantime.
+	if (SharedShader shader = FindShader(hash, spirv)) {
+		++m_hitCount;
+
+		return shader;
+	}
+
+	++m_missCount;
+
+	std::vector<ShaderEntry>& entries = m_shaders[hash];
+	std::erase_if(entries, [](const ShaderEntry& entry) { return entry.shader.expired(); });
+
+	entries.emplace_back(ShaderEntry{
+		.spirv = std::vector<std::uint32_t>(std::begin(spirv), std::end(spirv)),
+		.shader = newShader
+	});
+
+	return newShader;
+}
+
+ShaderLibrary::SharedShader ShaderLibrary::GetShader(
+	VkDevice device, const std::filesystem::path& fileName
+) {
+	const PathKey pathKey = fileName.lexically_normal().native();
+
+	{
+		std::shared_lock lock{ m_libraryMutex };
+
+		if (auto file = m_shaderFiles.find(pathKey); file != std::end(m_shaderFiles))
+			if (SharedShader shader = file->second.lock()) {
+				++m_hitCount;
+
+				return shader;
+			}
+	}
+
+	const std::vector<std::uint32_t> spirv = LoadSpirv(fileName);
+
+	// Nothing is cached for a missing file, so it is looked for again if it shows up later.
+	if (std::empty(spirv))
+		return nullptr;
+
+	SharedShader shader = GetShader(device, spirv);
+
+	if (!shader)
+		return nullptr;
+
+	std::unique_lock lock{ m_libraryMutex };
+	m_shaderFiles[pathKey] = shader;
+
+	return shader;
+}
+
+size_t ShaderLibrary::GetHitCount() const noexcept {
+	return m_hitCount.load();
+}
+
+size_t ShaderLibrary::GetMissCount() const noexcept {
+	return m_missCount.load();
+}
+
+size_t ShaderLibrary::GetShaderCount() const noexcept {
+	std::shared_lock lock{ m_libraryMutex };
+
+	size_t shaderCount = 0u;
+	for (const auto& [hash, entries] : m_shaders)
+		shaderCount += static_cast<size_t>(std::ranges::count_if(
+			entries, [](const ShaderEntry& entry) { return !entry.shader.expired(); }
+		));
+
+	return shaderCount;
+}
+
+std::uint64_t ShaderLibrary::HashSpirv(std::span<const std::uint32_t> spirv) noexcept {
+	// FNV-1a over the words.
+	std::uint64_t hash = 14695981039346656037ull;
+
+	for (std::uint32_t word : spirv) {
+		hash ^= word;
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+ShaderLibrary::SharedShader ShaderLibrary::FindShader(
+	std::uint64_t hash, std::span<const std::uint32_t> spirv
+) const noexcept {
+	auto entries = m_shaders.find(hash);
+
+	if (entries == std::end(m_shaders))
+		return nullptr;
+
+	for (const ShaderEntry& entry : entries->second)
+		if (std::ranges::equal(entry.spirv, spirv))
+			if (SharedShader shader = entry.shader.lock())
+				return shader;
+
+	return nullptr;
+}
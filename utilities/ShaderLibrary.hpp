@@ -0,0 +1,69 @@
+#ifndef SHADER_LIBRARY_HPP_
+#define SHADER_LIBRARY_HPP_
+#include <vulkan/vulkan.hpp>
+#include <SpirvShader.hpp>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+// Hands out shared shader modules, keyed on a hash of their SPIR-V, so identical bytecode is
+// only turned into a module once. The library only keeps weak references, a module is destroyed
+// when the last pipeline builder holding it lets go. Lookups are safe from any thread.
+class ShaderLibrary {
+public:
+	using SharedShader = std::shared_ptr<const SpirvShader>;
+
+public:
+	ShaderLibrary() noexcept;
+
+	ShaderLibrary(const ShaderLibrary&) = delete;
+	ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+	// Null if the module can't be created. Nothing is cached then, so a later call tries again.
+	[[nodiscard]]
+	SharedShader GetShader(VkDevice device, std::span<const std::uint32_t> spirv);
+	// A file which is already in the library isn't read again. The file is loaded with
+	// LoadSpirv, so embedded shaders are used when EMBED_SHADERS is on. Null if the file can't
+	// be read or its module can't be created.
+	[[nodiscard]]
+	SharedShader GetShader(VkDevice device, const std::filesystem::path& fileName);
+
+	[[nodiscard]]
+	size_t GetHitCount() const noexcept;
+	[[nodiscard]]
+	size_t GetMissCount() const noexcept;
+	// Only counts the modules which are still alive.
+	[[nodiscard]]
+	size_t GetShaderCount() const noexcept;
+
+	[[nodiscard]]
+	static std::uint64_t HashSpirv(std::span<const std::uint32_t> spirv) noexcept;
+
+private:
+	struct ShaderEntry {
+		std::vector<std::uint32_t> spirv;
+		std::weak_ptr<const SpirvShader> shader;
+	};
+
+	using PathKey = std::filesystem::path::string_type;
+
+private:
+	[[nodiscard]]
+	SharedShader FindShader(
+		std::uint64_t hash, std::span<const std::uint32_t> spirv
+	) const noexcept;
+
+private:
+	mutable std::shared_mutex m_libraryMutex;
+	// Multiple entries per hash in case of a collision, the SPIR-V is always compared.
+	std::unordered_map<std::uint64_t, std::vector<ShaderEntry>> m_shaders;
+	std::unordered_map<PathKey, std::weak_ptr<const SpirvShader>> m_shaderFiles;
+	std::atomic<size_t> m_hitCount;
+	std::atomic<size_t> m_missCount;
+};
+#endif
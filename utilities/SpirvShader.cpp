@@ -0,0 +1,60 @@
+#include <SpirvShader.hpp>
+#include <fstream>
+#ifdef TERRA_TEST_EMBEDDED_SHADERS
+#include <EmbeddedShaders.hpp>
+#endif
+
+std::vector<std::uint32_t> LoadSpirv(const std::filesystem::path& filePath) {
+#ifdef TERRA_TEST_EMBEDDED_SHADERS
+	const std::filesystem::path fileName = filePath.filename();
+
+	for (const EmbeddedShaders::Shader& shader : EmbeddedShaders::shaders)
+		if (fileName == std::filesystem::path{ shader.fileName })
+			return std::vector<std::uint32_t>(std::begin(shader.spirv), std::end(shader.spirv));
+#endif
+
+	std::ifstream shaderFile{ filePath, std::ios::binary | std::ios::ate };
+
+	if (!shaderFile)
+		return {};
+
+	const auto fileSize = static_cast<size_t>(shaderFile.tellg());
+	std::vector<std::uint32_t> spirv(fileSize / sizeof(std::uint32_t));
+
+	shaderFile.seekg(0);
+	shaderFile.read(
+		reinterpret_cast<char*>(std::data(spirv)),
+		static_cast<std::streamsize>(std::size(spirv) * sizeof(std::uint32_t))
+	);
+
+	return spirv;
+}
+
+SpirvShader::SpirvShader(VkDevice device) noexcept
+	: m_deviceRef{ device }, m_shaderModule{ VK_NULL_HANDLE } {}
+
+SpirvShader::~SpirvShader() noexcept {
+	vkDestroyShaderModule(m_deviceRef, m_shaderModule, nullptr);
+}
+
+void SpirvShader::CreateShader(VkDevice device, std::span<const std::uint32_t> spirv) noexcept {
+	VkShaderModuleCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		.codeSize = spirv.size_bytes(),
+		.pCode = std::data(spirv)
+	};
+
+	if (vkCreateShaderModule(device, &createInfo, nullptr, &m_shaderModule) != VK_SUCCESS)
+		m_shaderModule = VK_NULL_HANDLE;
+}
+
+void SpirvShader::CreateShader(VkDevice device, const std::filesystem::path& filePath) {
+	const std::vector<std::uint32_t> spirv = LoadSpirv(filePath);
+
+	if (!std::empty(spirv))
+		CreateShader(device, spirv);
+}
+
+VkShaderModule SpirvShader::GetShaderModule() const noexcept {
+	return m_shaderModule;
+}
@@ -0,0 +1,36 @@
+#ifndef SPIRV_SHADER_HPP_
+#define SPIRV_SHADER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+// With EMBED_SHADERS the file name is looked up in the embedded shaders first, so nothing is read
+// from the disk; the file is only read for shaders which aren't embedded. Empty if the shader
+// can't be found.
+[[nodiscard]]
+std::vector<std::uint32_t> LoadSpirv(const std::filesystem::path& filePath);
+
+// Creates the shader module from SPIR-V words which are already in memory, such as the arrays
+// generated with EMBED_SHADERS, or from a shader file through LoadSpirv.
+class SpirvShader {
+public:
+	SpirvShader(VkDevice device) noexcept;
+	~SpirvShader() noexcept;
+
+	SpirvShader(const SpirvShader&) = delete;
+	SpirvShader& operator=(const SpirvShader&) = delete;
+
+	void CreateShader(VkDevice device, std::span<const std::uint32_t> spirv) noexcept;
+	// The module stays null if the shader can't be loaded.
+	void CreateShader(VkDevice device, const std::filesystem::path& filePath);
+
+	[[nodiscard]]
+	VkShaderModule GetShaderModule() const noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkShaderModule m_shaderModule;
+};
+#endif
@@ -0,0 +1,91 @@
+#ifndef STATIC_VERTEX_LAYOUT_HPP_
+#define STATIC_VERTEX_LAYOUT_HPP_
+#include <vulkan/vulkan.hpp>
+#include <VKPipelineObject.hpp>
+#include <VertexQuantization.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+template<VkFormat format_, std::uint32_t size_>
+struct VertexAttribute {
+	static constexpr VkFormat format = format_;
+	static constexpr std::uint32_t size = size_;
+};
+
+using Float2Attribute = VertexAttribute<VK_FORMAT_R32G32_SFLOAT, 8u>;
+using Float3Attribute = VertexAttribute<VK_FORMAT_R32G32B32_SFLOAT, 12u>;
+using Float4Attribute = VertexAttribute<VK_FORMAT_R32G32B32A32_SFLOAT, 16u>;
+// Positions relative to a QuantizationBounds.
+using Snorm16x4Attribute = VertexAttribute<VK_FORMAT_R16G16B16A16_SNORM, 8u>;
+// Octahedral normals.
+using Snorm16x2Attribute = VertexAttribute<VK_FORMAT_R16G16_SNORM, 4u>;
+using Half2Attribute = VertexAttribute<VK_FORMAT_R16G16_SFLOAT, 4u>;
+
+// The offsets and the stride are worked out at compile time, so a vertex struct can be
+// checked against its layout with static_assert and offsetof.
+template<typename... Attributes>
+class StaticVertexLayout {
+public:
+	static constexpr std::uint32_t attributeCount = sizeof...(Attributes);
+	static constexpr std::uint32_t stride = (0u + ... + Attributes::size);
+
+	static constexpr std::array<std::uint32_t, attributeCount> offsets = [] {
+		std::array<std::uint32_t, attributeCount> attributeOffsets{};
+		const std::array<std::uint32_t, attributeCount> sizes{ Attributes::size... };
+
+		for (std::uint32_t index = 1u; index < attributeCount; ++index)
+			attributeOffsets[index] = attributeOffsets[index - 1u] + sizes[index - 1u];
+
+		return attributeOffsets;
+	}();
+
+	[[nodiscard]]
+	static constexpr std::array<VkVertexInputAttributeDescription, attributeCount>
+		GetAttributeDescriptions(std::uint32_t binding = 0u) noexcept {
+		std::array<VkVertexInputAttributeDescription, attributeCount> descriptions{};
+		const std::array<VkFormat, attributeCount> formats{ Attributes::format... };
+
+		for (std::uint32_t index = 0u; index < attributeCount; ++index)
+			descriptions[index] = VkVertexInputAttributeDescription{
+				.location = index,
+				.binding = binding,
+				.format = formats[index],
+				.offset = offsets[index]
+			};
+
+		return descriptions;
+	}
+
+	[[nodiscard]]
+	static constexpr VkVertexInputBindingDescription GetBindingDescription(
+		std::uint32_t binding = 0u
+	) noexcept {
+		return VkVertexInputBindingDescription{
+			.binding = binding,
+			.stride = stride,
+			.inputRate = VK_VERTEX_INPUT_RATE_VERTEX
+		};
+	}
+
+	[[nodiscard]]
+	static VertexLayout ToVertexLayout() {
+		VertexLayout layout{};
+		(layout.AddInput(Attributes::format, Attributes::size), ...);
+		layout.InitLayout();
+
+		return layout;
+	}
+};
+
+using FullVertexLayout = StaticVertexLayout<Float3Attribute, Float3Attribute, Float2Attribute>;
+using QuantizedVertexLayout = StaticVertexLayout<
+	Snorm16x4Attribute, Snorm16x2Attribute, Half2Attribute
+>;
+
+static_assert(sizeof(QuantizedVertex) == QuantizedVertexLayout::stride);
+static_assert(offsetof(QuantizedVertex, position) == QuantizedVertexLayout::offsets[0]);
+static_assert(offsetof(QuantizedVertex, normal) == QuantizedVertexLayout::offsets[1]);
+static_assert(offsetof(QuantizedVertex, uv) == QuantizedVertexLayout::offsets[2]);
+static_assert(QuantizedVertexLayout::stride * 2u == FullVertexLayout::stride);
+#endif
@@ -0,0 +1,193 @@
+#include <SubAllocator.hpp>
+#include <algorithm>
+#include <bit>
+
+[[nodiscard]]
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) noexcept {
+	return (value + alignment - 1u) & ~(alignment - 1u);
+}
+
+// Linear Allocator
+LinearAllocator::LinearAllocator(VkDeviceSize size) noexcept
+	: m_size{ size }, m_currentOffset{ 0u } {}
+
+std::optional<VkDeviceSize> LinearAllocator::Allocate(
+	VkDeviceSize size, VkDeviceSize alignment
+) noexcept {
+	const VkDeviceSize offset = AlignUp(m_currentOffset, std::max<VkDeviceSize>(alignment, 1u));
+
+	if (offset > m_size || size > m_size - offset)
+		return {};
+
+	m_currentOffset = offset + size;
+
+	return offset;
+}
+
+void LinearAllocator::Free([[maybe_unused]] VkDeviceSize offset) noexcept {}
+
+void LinearAllocator::Free([[maybe_unused]] std::span<const VkDeviceSize> offsets) noexcept {}
+
+void LinearAllocator::Reset() noexcept {
+	m_currentOffset = 0u;
+}
+
+VkDeviceSize LinearAllocator::GetSize() const noexcept {
+	return m_size;
+}
+
+VkDeviceSize LinearAllocator::GetUsedSize() const noexcept {
+	return m_currentOffset;
+}
+
+VkDeviceSize LinearAllocator::GetLargestFreeBlock() const noexcept {
+	return m_size - m_currentOffset;
+}
+
+// Buddy Allocator
+BuddyAllocator::BuddyAllocator(VkDeviceSize size, VkDeviceSize minBlockSize)
+	: m_size{ std::bit_floor(size) }, m_levelCount{ 1u }, m_usedSize{ 0u } {
+	minBlockSize = std::bit_ceil(std::max<VkDeviceSize>(minBlockSize, 1u));
+
+	while ((m_size >> m_levelCount) >= minBlockSize)
+		++m_levelCount;
+
+	m_freeBlocks.resize(m_levelCount);
+	Reset();
+}
+
+std::optional<VkDeviceSize> BuddyAllocator::Allocate(
+	VkDeviceSize size, VkDeviceSize alignment
+) noexcept {
+	// Every block is aligned to its own size, so a block at least as large as the alignment is
+	// always aligned.
+	const VkDeviceSize requiredSize = std::bit_ceil(std::max({ size, alignment, VkDeviceSize{ 1u } }));
+
+	if (requiredSize > m_size)
+		return {};
+
+	size_t level = m_levelCount - 1u;
+	while (GetBlockSize(level) < requiredSize)
+		--level;
+
+	size_t freeLevel = level;
+	while (std::empty(m_freeBlocks[freeLevel])) {
+		if (freeLevel == 0u)
+			return {};
+
+		--freeLevel;
+	}
+
+	const VkDeviceSize offset = *std::begin(m_freeBlocks[freeLevel]);
+	m_freeBlocks[freeLevel].erase(std::begin(m_freeBlocks[freeLevel]));
+
+	// Splits the block until it is the required size, the upper halves are freed.
+	for (; freeLevel < level; ++freeLevel)
+		m_freeBlocks[freeLevel + 1u].emplace(offset + GetBlockSize(freeLevel + 1u));
+
+	m_allocatedLevels.emplace(offset, level);
+	m_usedSize += GetBlockSize(level);
+
+	return offset;
+}
+
+void BuddyAllocator::Free(VkDeviceSize offset) noexcept {
+	auto allocation = m_allocatedLevels.find(offset);
+
+	if (allocation == std::end(m_allocatedLevels))
+		return;
+
+	size_t level = allocation->second;
+	m_allocatedLevels.erase(allocation);
+	m_usedSize -= GetBlockSize(level);
+
+	// Merges with the buddy for as long as it is free as well.
+	for (; level > 0u; --level) {
+		const VkDeviceSize buddyOffset = offset ^ GetBlockSize(level);
+		auto buddy = m_freeBlocks[level].find(buddyOffset);
+
+		if (buddy == std::end(m_freeBlocks[level]))
+			break;
+
+		m_freeBlocks[level].erase(buddy);
+		offset = std::min(offset, buddyOffset);
+	}
+
+	m_freeBlocks[level].emplace(offset);
+}
+
+void BuddyAllocator::Free(std::span<const VkDeviceSize> offsets) noexcept {
+	// The blocks freed on each level, and the ones merging creates on the level above.
+	std::vector<std::vector<VkDeviceSize>> freedBlocks(m_levelCount);
+
+	for (VkDeviceSize offset : offsets) {
+		auto allocation = m_allocatedLevels.find(offset);
+
+		if (allocation == std::end(m_allocatedLevels))
+			continue;
+
+		const size_t level = allocation->second;
+		m_allocatedLevels.erase(allocation);
+		m_usedSize -= GetBlockSize(level);
+
+		m_freeBlocks[level].emplace(offset);
+		freedBlocks[level].emplace_back(offset);
+	}
+
+	for (size_t level = m_levelCount - 1u; level > 0u; --level)
+		for (VkDeviceSize offset : freedBlocks[level]) {
+			const VkDeviceSize buddyOffset = offset ^ GetBlockSize(level);
+
+			// If both buddies were freed, the first of them has merged them already.
+			if (!m_freeBlocks[level].contains(offset)
+				|| !m_freeBlocks[level].contains(buddyOffset))
+				continue;
+
+			m_freeBlocks[level].erase(offset);
+			m_freeBlocks[level].erase(buddyOffset);
+
+			const VkDeviceSize mergedOffset = std::min(offset, buddyOffset);
+			m_freeBlocks[level - 1u].emplace(mergedOffset);
+			freedBlocks[level - 1u].emplace_back(mergedOffset);
+		}
+}
+
+void BuddyAllocator::Reset() noexcept {
+	for (auto& freeBlocks : m_freeBlocks)
+		freeBlocks.clear();
+
+	m_allocatedLevels.clear();
+	m_usedSize = 0u;
+
+	if (m_size != 0u)
+		m_freeBlocks[0].emplace(0u);
+}
+
+VkDeviceSize BuddyAllocator::GetSize() const noexcept {
+	return m_size;
+}
+
+VkDeviceSize BuddyAllocator::GetUsedSize() const noexcept {
+	return m_usedSize;
+}
+
+VkDeviceSize BuddyAllocator::GetLargestFreeBlock() const noexcept {
+	for (size_t level = 0u; level < m_levelCount; ++level)
+		if (!std::empty(m_freeBlocks[level]))
+			return GetBlockSize(level);
+
+	return 0u;
+}
+
+VkDeviceSize BuddyAllocator::GetBlockSize(size_t level) const noexcept {
+	return m_size >> level;
+}
+
+std::unique_ptr<SubAllocator> CreateSubAllocator(
+	AllocatorStrategy strategy, VkDeviceSize size
+) {
+	if (strategy == AllocatorStrategy::Linear)
+		return std::make_unique<LinearAllocator>(size);
+
+	return std::make_unique<BuddyAllocator>(size);
+}
@@ -0,0 +1,108 @@
+#ifndef SUB_ALLOCATOR_HPP_
+#define SUB_ALLOCATOR_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <set>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+enum class AllocatorStrategy {
+	// Bump allocation with no individual frees, for data which is thrown away every frame.
+	Linear,
+	// Power of two blocks which merge with their buddy when freed, for long lived resources.
+	Buddy
+};
+
+// Places allocations inside a range of memory. It only deals with offsets, so it doesn't need a
+// device and can be tested on the CPU. Alignments must be powers of two.
+class SubAllocator {
+public:
+	virtual ~SubAllocator() = default;
+
+	[[nodiscard]]
+	virtual std::optional<VkDeviceSize> Allocate(
+		VkDeviceSize size, VkDeviceSize alignment
+	) noexcept = 0;
+	virtual void Free(VkDeviceSize offset) noexcept = 0;
+	// Ends up in the same state as freeing them one by one.
+	virtual void Free(std::span<const VkDeviceSize> offsets) noexcept = 0;
+	virtual void Reset() noexcept = 0;
+
+	[[nodiscard]]
+	virtual VkDeviceSize GetSize() const noexcept = 0;
+	// Includes the padding and the rounding each strategy adds to the allocations.
+	[[nodiscard]]
+	virtual VkDeviceSize GetUsedSize() const noexcept = 0;
+	[[nodiscard]]
+	virtual VkDeviceSize GetLargestFreeBlock() const noexcept = 0;
+};
+
+class LinearAllocator : public SubAllocator {
+public:
+	LinearAllocator(VkDeviceSize size) noexcept;
+
+	[[nodiscard]]
+	std::optional<VkDeviceSize> Allocate(
+		VkDeviceSize size, VkDeviceSize alignment
+	) noexcept override;
+	// Memory is only reclaimed by Reset.
+	void Free(VkDeviceSize offset) noexcept override;
+	void Free(std::span<const VkDeviceSize> offsets) noexcept override;
+	void Reset() noexcept override;
+
+	[[nodiscard]]
+	VkDeviceSize GetSize() const noexcept override;
+	[[nodiscard]]
+	VkDeviceSize GetUsedSize() const noexcept override;
+	[[nodiscard]]
+	VkDeviceSize GetLargestFreeBlock() const noexcept override;
+
+private:
+	VkDeviceSize m_size;
+	VkDeviceSize m_currentOffset;
+};
+
+class BuddyAllocator : public SubAllocator {
+public:
+	// The size is rounded down to a power of two. Every allocation takes at least minBlockSize.
+	BuddyAllocator(VkDeviceSize size, VkDeviceSize minBlockSize = 256u);
+
+	[[nodiscard]]
+	std::optional<VkDeviceSize> Allocate(
+		VkDeviceSize size, VkDeviceSize alignment
+	) noexcept override;
+	void Free(VkDeviceSize offset) noexcept override;
+	// Releases all of them before merging, then merges a level at a time from the smallest
+	// blocks, so a block which several of them make free is merged once.
+	void Free(std::span<const VkDeviceSize> offsets) noexcept override;
+	void Reset() noexcept override;
+
+	[[nodiscard]]
+	VkDeviceSize GetSize() const noexcept override;
+	[[nodiscard]]
+	VkDeviceSize GetUsedSize() const noexcept override;
+	[[nodiscard]]
+	VkDeviceSize GetLargestFreeBlock() const noexcept override;
+
+private:
+	[[nodiscard]]
+	VkDeviceSize GetBlockSize(size_t level) const noexcept;
+
+private:
+	VkDeviceSize m_size;
+	size_t m_levelCount;
+	VkDeviceSize m_usedSize;
+	// Free block offsets per level, level 0 being the whole range. Sets keep the lowest offsets
+	// first, which keeps the allocations packed towards the start.
+	std::vector<std::set<VkDeviceSize>> m_freeBlocks;
+	std::unordered_map<VkDeviceSize, size_t> m_allocatedLevels;
+};
+
+[[nodiscard]]
+std::unique_ptr<SubAllocator> CreateSubAllocator(
+	AllocatorStrategy strategy, VkDeviceSize size
+);
+#endif
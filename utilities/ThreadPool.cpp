@@ -0,0 +1,30 @@
+#include <ThreadPool.hpp>
+
+ThreadPool::ThreadPool(size_t threadCount) : m_workers{ m_taskAvailable } {
+	m_workers.Start(
+		threadCount, [this](std::stop_token stopToken, size_t) { RunWorker(stopToken); }
+	);
+}
+
+size_t ThreadPool::GetThreadCount() const noexcept {
+	return m_workers.GetCount();
+}
+
+void ThreadPool::RunWorker(std::stop_token stopToken) noexcept {
+	while (true) {
+		std::function<void()> task;
+
+		{
+			std::unique_lock lock{ m_queueMutex };
+
+			// Returns false only when a stop was requested and there is nothing left to run.
+			if (!m_taskAvailable.wait(lock, stopToken, [this] { return !std::empty(m_tasks); }))
+				return;
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop();
+		}
+
+		task();
+	}
+}
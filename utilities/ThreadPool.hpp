@@ -0,0 +1,53 @@
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+#include <WorkerThreads.hpp>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <type_traits>
+
+class ThreadPool {
+public:
+	// A threadCount of 0 uses one worker per hardware thread.
+	ThreadPool(size_t threadCount = 0u);
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	template<typename Function>
+	[[nodiscard]]
+	std::future<std::invoke_result_t<Function>> Submit(Function&& function) {
+		using Result = std::invoke_result_t<Function>;
+
+		// std::function needs a copyable target, so the task is shared.
+		auto task = std::make_shared<std::packaged_task<Result()>>(
+			std::forward<Function>(function)
+		);
+		std::future<Result> result = task->get_future();
+
+		{
+			std::lock_guard lock{ m_queueMutex };
+			m_tasks.emplace([task] { (*task)(); });
+		}
+		m_taskAvailable.notify_one();
+
+		return result;
+	}
+
+	[[nodiscard]]
+	size_t GetThreadCount() const noexcept;
+
+private:
+	void RunWorker(std::stop_token stopToken) noexcept;
+
+private:
+	std::mutex m_queueMutex;
+	std::condition_variable_any m_taskAvailable;
+	std::queue<std::function<void()>> m_tasks;
+	// Declared last, so the workers are joined before the queue is destroyed.
+	WorkerThreads m_workers;
+};
+#endif
@@ -0,0 +1,178 @@
+#include <TimelineSemaphore.hpp>
+#include <vector>
+
+TimelineSemaphore::TimelineSemaphore(VkDevice device, std::uint64_t initialValue) noexcept
+	: m_deviceRef{ device }, m_semaphore{ VK_NULL_HANDLE } {
+	VkSemaphoreTypeCreateInfo typeInfo{
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO,
+		.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE,
+		.initialValue = initialValue
+	};
+
+	VkSemaphoreCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &typeInfo
+	};
+
+	vkCreateSemaphore(device, &createInfo, nullptr, &m_semaphore);
+}
+
+TimelineSemaphore::~TimelineSemaphore() noexcept {
+	vkDestroySemaphore(m_deviceRef, m_semaphore, nullptr);
+}
+
+std::uint64_t TimelineSemaphore::GetCompletedValue(VkDevice device) const noexcept {
+	std::uint64_t value = 0u;
+	vkGetSemaphoreCounterValue(device, m_semaphore, &value);
+
+	return value;
+}
+
+bool TimelineSemaphore::IsComplete(VkDevice device, std::uint64_t value) const noexcept {
+	return GetCompletedValue(device) >= value;
+}
+
+bool TimelineSemaphore::Wait(
+	VkDevice device, std::uint64_t value, std::uint64_t timeout
+) const noexcept {
+	VkSemaphoreWaitInfo waitInfo{
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+		.semaphoreCount = 1u,
+		.pSemaphores = &m_semaphore,
+		.pValues = &value
+	};
+
+	return vkWaitSemaphores(device, &waitInfo, timeout) == VK_SUCCESS;
+}
+
+void TimelineSemaphore::Signal(VkDevice device, std::uint64_t value) noexcept {
+	VkSemaphoreSignalInfo signalInfo{
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO,
+		.semaphore = m_semaphore,
+		.value = value
+	};
+
+	vkSignalSemaphore(device, &signalInfo);
+}
+
+VkSemaphore TimelineSemaphore::GetSemaphore() const noexcept {
+	return m_semaphore;
+}
+
+TimelinePoint TimelineSemaphore::GetPoint(std::uint64_t value) const noexcept {
+	return TimelinePoint{ .semaphore = m_semaphore, .value = value };
+}
+
+bool TimelineSemaphore::WaitForAll(
+	VkDevice device, std::span<const TimelinePoint> points, std::uint64_t timeout
+) {
+	std::vector<VkSemaphore> semaphores;
+	std::vector<std::uint64_t> values;
+
+	for (const TimelinePoint& point : points) {
+		semaphores.emplace_back(point.semaphore);
+		values.emplace_back(point.value);
+	}
+
+	VkSemaphoreWaitInfo waitInfo{
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+		.semaphoreCount = static_cast<std::uint32_t>(std::size(semaphores)),
+		.pSemaphores = std::data(semaphores),
+		.pValues = std::data(values)
+	};
+
+	return vkWaitSemaphores(device, &waitInfo, timeout) == VK_SUCCESS;
+}
+
+bool TimelineSemaphore::IsSupported(VkPhysicalDevice physicalDevice) noexcept {
+	VkPhysicalDeviceTimelineSemaphoreFeatures timelineFeatures{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES
+	};
+
+	VkPhysicalDeviceFeatures2 features{
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+		.pNext = &timelineFeatures
+	};
+
+	vkGetPhysicalDeviceFeatures2(physicalDevice, &features);
+
+	return timelineFeatures.timelineSemaphore;
+}
+
+QueueTimeline::QueueTimeline(VkDevice device, const Args& arguments) noexcept
+	: m_queue{ arguments.queue }, m_timeline{ device, 0u }, m_lastSubmittedValue{ 0u } {}
+
+std::optional<TimelinePoint> QueueTimeline::Submit(
+	std::span<const VkCommandBuffer> commandBuffers, std::span<const TimelineWait> waits
+) {
+	std::vector<VkSemaphore> waitSemaphores;
+	std::vector<std::uint64_t> waitValues;
+	std::vector<VkPipelineStageFlags> waitStages;
+
+	for (const TimelineWait& wait : waits) {
+		waitSemaphores.emplace_back(wait.point.semaphore);
+		waitValues.emplace_back(wait.point.value);
+		waitStages.emplace_back(wait.stage);
+	}
+
+	const std::uint64_t signalValue = m_lastSubmittedValue + 1u;
+	const VkSemaphore signalSemaphore = m_timeline.GetSemaphore();
+
+	VkTimelineSemaphoreSubmitInfo timelineInfo{
+		.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+		.waitSemaphoreValueCount = static_cast<std::uint32_t>(std::size(waitValues)),
+		.pWaitSemaphoreValues = std::data(waitValues),
+		.signalSemaphoreValueCount = 1u,
+		.pSignalSemaphoreValues = &signalValue
+	};
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = &timelineInfo,
+		.waitSemaphoreCount = static_cast<std::uint32_t>(std::size(waitSemaphores)),
+		.pWaitSemaphores = std::data(waitSemaphores),
+		.pWaitDstStageMask = std::data(waitStages),
+		.commandBufferCount = static_cast<std::uint32_t>(std::size(commandBuffers)),
+		.pCommandBuffers = std::data(commandBuffers),
+		.signalSemaphoreCount = 1u,
+		.pSignalSemaphores = &signalSemaphore
+	};
+
+	// A failed submission doesn't signal, so the value isn't used up.
+	if (vkQueueSubmit(m_queue, 1u, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+		return {};
+
+	m_lastSubmittedValue = signalValue;
+
+	return m_timeline.GetPoint(signalValue);
+}
+
+std::uint64_t QueueTimeline::GetLastSubmittedValue() const noexcept {
+	return m_lastSubmittedValue;
+}
+
+std::uint64_t QueueTimeline::GetCompletedValue(VkDevice device) const noexcept {
+	return m_timeline.GetCompletedValue(device);
+}
+
+bool QueueTimeline::IsComplete(VkDevice device, std::uint64_t value) const noexcept {
+	return m_timeline.IsComplete(device, value);
+}
+
+bool QueueTimeline::Wait(
+	VkDevice device, std::uint64_t value, std::uint64_t timeout
+) const noexcept {
+	return m_timeline.Wait(device, value, timeout);
+}
+
+bool QueueTimeline::WaitIdle(VkDevice device) const noexcept {
+	return m_timeline.Wait(device, m_lastSubmittedValue);
+}
+
+VkQueue QueueTimeline::GetQueue() const noexcept {
+	return m_queue;
+}
+
+const TimelineSemaphore& QueueTimeline::GetTimeline() const noexcept {
+	return m_timeline;
+}
@@ -0,0 +1,105 @@
+#ifndef TIMELINE_SEMAPHORE_HPP_
+#define TIMELINE_SEMAPHORE_HPP_
+#include <vulkan/vulkan.hpp>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+
+// A point on a timeline, reached once the semaphore's value is at least value.
+struct TimelinePoint {
+	VkSemaphore semaphore;
+	std::uint64_t value;
+};
+
+struct TimelineWait {
+	TimelinePoint point;
+	VkPipelineStageFlags stage;
+};
+
+class TimelineSemaphore {
+public:
+	TimelineSemaphore(VkDevice device, std::uint64_t initialValue = 0u) noexcept;
+	~TimelineSemaphore() noexcept;
+
+	TimelineSemaphore(const TimelineSemaphore&) = delete;
+	TimelineSemaphore& operator=(const TimelineSemaphore&) = delete;
+
+	// Doesn't block.
+	[[nodiscard]]
+	std::uint64_t GetCompletedValue(VkDevice device) const noexcept;
+	[[nodiscard]]
+	bool IsComplete(VkDevice device, std::uint64_t value) const noexcept;
+
+	// Returns false if the timeout ran out first.
+	bool Wait(
+		VkDevice device, std::uint64_t value,
+		std::uint64_t timeout = std::numeric_limits<std::uint64_t>::max()
+	) const noexcept;
+	// Signals from the CPU. The value has to be larger than the current one.
+	void Signal(VkDevice device, std::uint64_t value) noexcept;
+
+	[[nodiscard]]
+	VkSemaphore GetSemaphore() const noexcept;
+	[[nodiscard]]
+	TimelinePoint GetPoint(std::uint64_t value) const noexcept;
+
+	// Waits until every point is reached, which can be on the timelines of different queues.
+	static bool WaitForAll(
+		VkDevice device, std::span<const TimelinePoint> points,
+		std::uint64_t timeout = std::numeric_limits<std::uint64_t>::max()
+	);
+
+	[[nodiscard]]
+	static bool IsSupported(VkPhysicalDevice physicalDevice) noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkSemaphore m_semaphore;
+};
+
+// A queue with a timeline semaphore which every submission signals with the next value, instead
+// of a ring of binary fences and semaphores. Nothing has to be reset between frames; frame N
+// can be reused once the value of frame N - framesInFlight has completed, and other queues
+// wait on exactly the point they depend on. Submit has to be externally synchronised, like
+// vkQueueSubmit.
+class QueueTimeline {
+public:
+	struct Args {
+		VkQueue queue;
+	};
+
+public:
+	QueueTimeline(VkDevice device, const Args& arguments) noexcept;
+
+	// Returns the point the submission signals. Nothing if vkQueueSubmit failed, the value
+	// isn't used up then and nothing should wait for it.
+	[[nodiscard]]
+	std::optional<TimelinePoint> Submit(
+		std::span<const VkCommandBuffer> commandBuffers, std::span<const TimelineWait> waits = {}
+	);
+
+	[[nodiscard]]
+	std::uint64_t GetLastSubmittedValue() const noexcept;
+	[[nodiscard]]
+	std::uint64_t GetCompletedValue(VkDevice device) const noexcept;
+	[[nodiscard]]
+	bool IsComplete(VkDevice device, std::uint64_t value) const noexcept;
+	bool Wait(
+		VkDevice device, std::uint64_t value,
+		std::uint64_t timeout = std::numeric_limits<std::uint64_t>::max()
+	) const noexcept;
+	// Waits for everything which was submitted so far.
+	bool WaitIdle(VkDevice device) const noexcept;
+
+	[[nodiscard]]
+	VkQueue GetQueue() const noexcept;
+	[[nodiscard]]
+	const TimelineSemaphore& GetTimeline() const noexcept;
+
+private:
+	VkQueue m_queue;
+	TimelineSemaphore m_timeline;
+	std::uint64_t m_lastSubmittedValue;
+};
+#endif
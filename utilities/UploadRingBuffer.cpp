@@ -0,0 +1,99 @@
+#include <UploadRingBuffer.hpp>
+#include <DeviceMemoryPool.hpp>
+#include <algorithm>
+#include <cstdint>
+
+UploadRingBuffer::UploadRingBuffer(VkDevice device, const Args& arguments) noexcept
+	: m_deviceRef{ device }, m_buffer{ VK_NULL_HANDLE }, m_memory{ VK_NULL_HANDLE },
+	m_cpuAddress{ nullptr }, m_defaultAlignment{ 1u }, m_ringAllocator{ arguments.size } {
+	VkPhysicalDeviceProperties deviceProperty{};
+	vkGetPhysicalDeviceProperties(arguments.physicalDevice, &deviceProperty);
+
+	m_defaultAlignment = std::max(
+		deviceProperty.limits.minUniformBufferOffsetAlignment,
+		deviceProperty.limits.minStorageBufferOffsetAlignment
+	);
+
+	VkBufferCreateInfo createInfo{
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.size = arguments.size,
+		.usage = arguments.usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE
+	};
+
+	if (vkCreateBuffer(device, &createInfo, nullptr, &m_buffer) != VK_SUCCESS)
+		return;
+
+	VkMemoryRequirements requirements{};
+	vkGetBufferMemoryRequirements(device, m_buffer, &requirements);
+
+	std::optional<std::uint32_t> memoryTypeIndex = DeviceMemoryPool::FindMemoryTypeIndex(
+		arguments.physicalDevice, requirements.memoryTypeBits,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+	);
+
+	if (!memoryTypeIndex)
+		return;
+
+	VkMemoryAllocateInfo allocInfo{
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.allocationSize = requirements.size,
+		.memoryTypeIndex = *memoryTypeIndex
+	};
+
+	if (vkAllocateMemory(device, &allocInfo, nullptr, &m_memory) != VK_SUCCESS)
+		return;
+
+	vkBindBufferMemory(device, m_buffer, m_memory, 0u);
+	vkMapMemory(device, m_memory, 0u, VK_WHOLE_SIZE, 0u, &m_cpuAddress);
+}
+
+UploadRingBuffer::~UploadRingBuffer() noexcept {
+	vkDestroyBuffer(m_deviceRef, m_buffer, nullptr);
+	// Freeing the memory unmaps it.
+	vkFreeMemory(m_deviceRef, m_memory, nullptr);
+}
+
+std::optional<RingAllocation> UploadRingBuffer::Allocate(VkDeviceSize size) noexcept {
+	return Allocate(size, m_defaultAlignment);
+}
+
+std::optional<RingAllocation> UploadRingBuffer::Allocate(
+	VkDeviceSize size, VkDeviceSize alignment
+) noexcept {
+	if (!m_cpuAddress)
+		return {};
+
+	std::optional<VkDeviceSize> offset = m_ringAllocator.Allocate(size, alignment);
+
+	if (!offset)
+		return {};
+
+	return RingAllocation{
+		.buffer = m_buffer,
+		.offset = *offset,
+		.cpuAddress = static_cast<std::uint8_t*>(m_cpuAddress) + *offset
+	};
+}
+
+void UploadRingBuffer::FinishFrame(VkFence frameFence) noexcept {
+	m_ringAllocator.FinishFrame();
+	m_frameFences.emplace_back(frameFence);
+}
+
+void UploadRingBuffer::ReclaimFinishedFrames(VkDevice device) noexcept {
+	// The frames finish in submission order, so it stops at the first one still running.
+	while (!std::empty(m_frameFences)
+		&& vkGetFenceStatus(device, m_frameFences.front()) == VK_SUCCESS) {
+		m_ringAllocator.ReclaimFrame();
+		m_frameFences.pop_front();
+	}
+}
+
+VkBuffer UploadRingBuffer::GetBuffer() const noexcept {
+	return m_buffer;
+}
+
+VkDeviceSize UploadRingBuffer::GetUsedSize() const noexcept {
+	return m_ringAllocator.GetUsedSize();
+}
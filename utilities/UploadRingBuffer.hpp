@@ -0,0 +1,59 @@
+#ifndef UPLOAD_RING_BUFFER_HPP_
+#define UPLOAD_RING_BUFFER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <RingAllocator.hpp>
+#include <deque>
+#include <optional>
+
+struct RingAllocation {
+	VkBuffer buffer;
+	VkDeviceSize offset;
+	void* cpuAddress;
+};
+
+// A persistently mapped, host coherent buffer which per-frame data is written straight into.
+// Every frame is tagged with the fence its submission signals, the front fence of a
+// VkSyncObjects, and its space is reclaimed once that fence has signalled. The default alignment
+// satisfies both the uniform and the storage buffer offset alignments, so the offsets can be used
+// as dynamic descriptor offsets.
+class UploadRingBuffer {
+public:
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		VkDeviceSize size;
+		VkBufferUsageFlags usage;
+	};
+
+public:
+	UploadRingBuffer(VkDevice device, const Args& arguments) noexcept;
+	~UploadRingBuffer() noexcept;
+
+	UploadRingBuffer(const UploadRingBuffer&) = delete;
+	UploadRingBuffer& operator=(const UploadRingBuffer&) = delete;
+
+	[[nodiscard]]
+	std::optional<RingAllocation> Allocate(VkDeviceSize size) noexcept;
+	[[nodiscard]]
+	std::optional<RingAllocation> Allocate(VkDeviceSize size, VkDeviceSize alignment) noexcept;
+
+	// Call after submitting the frame with frameFence and before advancing the sync objects.
+	void FinishFrame(VkFence frameFence) noexcept;
+	// Doesn't block. Has to be called before a fence is reset for reuse, so right after waiting
+	// on the front fence is the natural spot.
+	void ReclaimFinishedFrames(VkDevice device) noexcept;
+
+	[[nodiscard]]
+	VkBuffer GetBuffer() const noexcept;
+	[[nodiscard]]
+	VkDeviceSize GetUsedSize() const noexcept;
+
+private:
+	VkDevice m_deviceRef;
+	VkBuffer m_buffer;
+	VkDeviceMemory m_memory;
+	void* m_cpuAddress;
+	VkDeviceSize m_defaultAlignment;
+	RingAllocator m_ringAllocator;
+	std::deque<VkFence> m_frameFences;
+};
+#endif
@@ -0,0 +1,253 @@
+#include <UploadScheduler.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <map>
+
+// Adds the parts of the copy which aren't in the written ranges yet, then adds the copy's range
+// to them. The written ranges are disjoint and keyed on their start.
+static void AddUnwrittenParts(
+	const PendingCopy& pendingCopy, std::map<VkDeviceSize, VkDeviceSize>& writtenRanges,
+	std::vector<PendingCopy>& visibleCopies
+) {
+	const VkDeviceSize copyStart = pendingCopy.dstOffset;
+	const VkDeviceSize copyEnd = copyStart + pendingCopy.size;
+
+	auto addPart = [&pendingCopy, &visibleCopies](VkDeviceSize start, VkDeviceSize end) {
+		visibleCopies.emplace_back(PendingCopy{
+			.dstBuffer = pendingCopy.dstBuffer,
+			.srcOffset = pendingCopy.srcOffset + (start - pendingCopy.dstOffset),
+			.dstOffset = start,
+			.size = end - start
+		});
+	};
+
+	// The first range which overlaps or touches the copy, touching ones are merged as well.
+	auto firstRange = writtenRanges.upper_bound(copyStart);
+	if (firstRange != std::begin(writtenRanges) && std::prev(firstRange)->second >= copyStart)
+		--firstRange;
+
+	VkDeviceSize partStart = copyStart;
+	VkDeviceSize mergedStart = copyStart;
+	VkDeviceSize mergedEnd = copyEnd;
+
+	auto range = firstRange;
+	for (; range != std::end(writtenRanges) && range->first <= copyEnd; ++range) {
+		if (range->first > partStart)
+			addPart(partStart, range->first);
+
+		partStart = std::max(partStart, range->second);
+		mergedStart = std::min(mergedStart, range->first);
+		mergedEnd = std::max(mergedEnd, range->second);
+	}
+
+	if (partStart < copyEnd)
+		addPart(partStart, copyEnd);
+
+	writtenRanges.erase(firstRange, range);
+	writtenRanges.emplace(mergedStart, mergedEnd);
+}
+
+std::vector<CopyCommand> CoalesceCopies(std::vector<PendingCopy> pendingCopies) {
+	// Stable, so the copies of a buffer stay in submission order.
+	std::ranges::stable_sort(pendingCopies, [](const PendingCopy& lhs, const PendingCopy& rhs) {
+		return std::less<VkBuffer>{}(lhs.dstBuffer, rhs.dstBuffer);
+	});
+
+	// Walking every buffer's copies from the newest one, anything an earlier copy would write
+	// over a later one is cut out of it.
+	std::vector<PendingCopy> visibleCopies;
+	std::map<VkDeviceSize, VkDeviceSize> writtenRanges;
+
+	for (size_t index = std::size(pendingCopies); index > 0u; --index) {
+		const PendingCopy& pendingCopy = pendingCopies[index - 1u];
+
+		if (index == std::size(pendingCopies)
+			|| pendingCopies[index].dstBuffer != pendingCopy.dstBuffer)
+			writtenRanges.clear();
+
+		if (pendingCopy.size)
+			AddUnwrittenParts(pendingCopy, writtenRanges, visibleCopies);
+	}
+
+	// Nothing overlaps anymore, so every offset in a buffer is unique.
+	std::ranges::sort(visibleCopies, [](const PendingCopy& lhs, const PendingCopy& rhs) {
+		if (lhs.dstBuffer != rhs.dstBuffer)
+			return std::less<VkBuffer>{}(lhs.dstBuffer, rhs.dstBuffer);
+
+		return lhs.dstOffset < rhs.dstOffset;
+	});
+
+	std::vector<CopyCommand> copyCommands;
+
+	for (const PendingCopy& pendingCopy : visibleCopies) {
+		if (std::empty(copyCommands) || copyCommands.back().dstBuffer != pendingCopy.dstBuffer)
+			copyCommands.emplace_back(CopyCommand{ .dstBuffer = pendingCopy.dstBuffer });
+
+		std::vector<VkBufferCopy>& regions = copyCommands.back().regions;
+
+		if (!std::empty(regions)) {
+			VkBufferCopy& lastRegion = regions.back();
+
+			if (lastRegion.srcOffset + lastRegion.size == pendingCopy.srcOffset
+				&& lastRegion.dstOffset + lastRegion.size == pendingCopy.dstOffset) {
+				lastRegion.size += pendingCopy.size;
+
+				continue;
+			}
+		}
+
+		regions.emplace_back(VkBufferCopy{
+			.srcOffset = pendingCopy.srcOffset,
+			.dstOffset = pendingCopy.dstOffset,
+			.size = pendingCopy.size
+		});
+	}
+
+	return copyCommands;
+}
+
+UploadScheduler::UploadScheduler(VkDevice device, const Args& arguments) noexcept
+	: m_deviceRef{ device }, m_transferQueue{ arguments.transferQueue },
+	m_stagingBuffer{
+		device,
+		UploadRingBuffer::Args{
+			.physicalDevice = arguments.physicalDevice,
+			.size = arguments.stagingSize,
+			.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+		}
+	},
+	m_batchSlots{}, m_nextBatchId{ 1u } {
+	for (BatchSlot& batchSlot : m_batchSlots) {
+		VkCommandPoolCreateInfo poolInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+			.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+			.queueFamilyIndex = arguments.transferFamilyIndex
+		};
+		vkCreateCommandPool(device, &poolInfo, nullptr, &batchSlot.commandPool);
+
+		VkCommandBufferAllocateInfo allocInfo{
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+			.commandPool = batchSlot.commandPool,
+			.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			.commandBufferCount = 1u
+		};
+		vkAllocateCommandBuffers(device, &allocInfo, &batchSlot.commandBuffer);
+
+		// Signalled, so the first flush of every slot doesn't wait.
+		VkFenceCreateInfo fenceInfo{
+			.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+			.flags = VK_FENCE_CREATE_SIGNALED_BIT
+		};
+		vkCreateFence(device, &fenceInfo, nullptr, &batchSlot.fence);
+
+		VkSemaphoreCreateInfo semaphoreInfo{ .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO };
+		vkCreateSemaphore(device, &semaphoreInfo, nullptr, &batchSlot.semaphore);
+	}
+}
+
+UploadScheduler::~UploadScheduler() noexcept {
+	for (BatchSlot& batchSlot : m_batchSlots) {
+		vkWaitForFences(m_deviceRef, 1u, &batchSlot.fence, VK_TRUE, UINT64_MAX);
+
+		vkDestroySemaphore(m_deviceRef, batchSlot.semaphore, nullptr);
+		vkDestroyFence(m_deviceRef, batchSlot.fence, nullptr);
+		vkDestroyCommandPool(m_deviceRef, batchSlot.commandPool, nullptr);
+	}
+}
+
+bool UploadScheduler::QueueUpload(
+	VkBuffer dstBuffer, VkDeviceSize dstOffset, void const* data, VkDeviceSize size
+) noexcept {
+	m_stagingBuffer.ReclaimFinishedFrames(m_deviceRef);
+
+	// The copies are tightly packed, so neighbouring uploads can be merged into one region.
+	std::optional<RingAllocation> staging = m_stagingBuffer.Allocate(size, 1u);
+
+	if (!staging)
+		return false;
+
+	std::memcpy(staging->cpuAddress, data, static_cast<size_t>(size));
+
+	m_pendingCopies.emplace_back(PendingCopy{
+		.dstBuffer = dstBuffer,
+		.srcOffset = staging->offset,
+		.dstOffset = dstOffset,
+		.size = size
+	});
+
+	return true;
+}
+
+UploadBatch UploadScheduler::Flush(VkDevice device, bool signalSemaphore) noexcept {
+	const std::uint64_t batchId = m_nextBatchId++;
+	BatchSlot& batchSlot = m_batchSlots[batchId % batchSlotCount];
+
+	vkWaitForFences(device, 1u, &batchSlot.fence, VK_TRUE, UINT64_MAX);
+	// The staging space of the batch which used this slot can be reused now.
+	m_stagingBuffer.ReclaimFinishedFrames(device);
+
+	vkResetFences(device, 1u, &batchSlot.fence);
+	vkResetCommandPool(device, batchSlot.commandPool, 0u);
+	batchSlot.batchId = batchId;
+
+	VkCommandBufferBeginInfo beginInfo{
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+	};
+	vkBeginCommandBuffer(batchSlot.commandBuffer, &beginInfo);
+
+	const std::vector<CopyCommand> copyCommands = CoalesceCopies(std::move(m_pendingCopies));
+	m_pendingCopies.clear();
+
+	size_t regionCount = 0u;
+	for (const CopyCommand& copyCommand : copyCommands) {
+		vkCmdCopyBuffer(
+			batchSlot.commandBuffer, m_stagingBuffer.GetBuffer(), copyCommand.dstBuffer,
+			static_cast<std::uint32_t>(std::size(copyCommand.regions)),
+			std::data(copyCommand.regions)
+		);
+
+		regionCount += std::size(copyCommand.regions);
+	}
+
+	vkEndCommandBuffer(batchSlot.commandBuffer);
+
+	VkSubmitInfo submitInfo{
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &batchSlot.commandBuffer,
+		.signalSemaphoreCount = signalSemaphore ? 1u : 0u,
+		.pSignalSemaphores = &batchSlot.semaphore
+	};
+	vkQueueSubmit(m_transferQueue, 1u, &submitInfo, batchSlot.fence);
+
+	m_stagingBuffer.FinishFrame(batchSlot.fence);
+
+	return UploadBatch{
+		.batchId = batchId,
+		.waitSemaphore = signalSemaphore ? batchSlot.semaphore : VK_NULL_HANDLE,
+		.regionCount = regionCount
+	};
+}
+
+bool UploadScheduler::IsBatchComplete(VkDevice device, std::uint64_t batchId) const noexcept {
+	const BatchSlot& batchSlot = m_batchSlots[batchId % batchSlotCount];
+
+	// The slot was reused by a later batch, which means this one had finished.
+	if (batchSlot.batchId != batchId)
+		return batchSlot.batchId > batchId;
+
+	return vkGetFenceStatus(device, batchSlot.fence) == VK_SUCCESS;
+}
+
+void UploadScheduler::WaitForBatch(VkDevice device, std::uint64_t batchId) const noexcept {
+	const BatchSlot& batchSlot = m_batchSlots[batchId % batchSlotCount];
+
+	if (batchSlot.batchId == batchId)
+		vkWaitForFences(device, 1u, &batchSlot.fence, VK_TRUE, UINT64_MAX);
+}
+
+size_t UploadScheduler::GetPendingCopyCount() const noexcept {
+	return std::size(m_pendingCopies);
+}
@@ -0,0 +1,95 @@
+#ifndef UPLOAD_SCHEDULER_HPP_
+#define UPLOAD_SCHEDULER_HPP_
+#include <vulkan/vulkan.hpp>
+#include <UploadRingBuffer.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+struct PendingCopy {
+	VkBuffer dstBuffer;
+	VkDeviceSize srcOffset;
+	VkDeviceSize dstOffset;
+	VkDeviceSize size;
+};
+
+struct CopyCommand {
+	VkBuffer dstBuffer;
+	std::vector<VkBufferCopy> regions;
+};
+
+// One command per destination buffer, with the copies which are contiguous in both the staging
+// and the destination buffer merged into a single region. The copies are expected in submission
+// order and a later copy wins where destinations overlap: the parts of the earlier ones which it
+// overwrites are dropped, so the regions of a command never overlap.
+[[nodiscard]]
+std::vector<CopyCommand> CoalesceCopies(std::vector<PendingCopy> pendingCopies);
+
+struct UploadBatch {
+	std::uint64_t batchId;
+	// Only created when the flush asked for it. It has to be waited on by exactly one
+	// submission, before the same batch slot is flushed again.
+	VkSemaphore waitSemaphore;
+	// The copy regions recorded over all the destination buffers, after coalescing.
+	size_t regionCount;
+};
+
+// Gathers many small uploads into one staging ring and submits them as a single command buffer
+// on the transfer queue. The graphics queue only has to wait on the semaphores of the batches it
+// reads from, and the CPU can poll any batch with IsBatchComplete. The destination buffers must
+// be shared concurrently between the transfer and the graphics families, like the ones Terra
+// creates with GetTransferAndGraphicsIndices.
+class UploadScheduler {
+public:
+	static constexpr size_t batchSlotCount = 3u;
+
+	struct Args {
+		VkPhysicalDevice physicalDevice;
+		VkQueue transferQueue;
+		std::uint32_t transferFamilyIndex;
+		VkDeviceSize stagingSize;
+	};
+
+public:
+	UploadScheduler(VkDevice device, const Args& arguments) noexcept;
+	~UploadScheduler() noexcept;
+
+	UploadScheduler(const UploadScheduler&) = delete;
+	UploadScheduler& operator=(const UploadScheduler&) = delete;
+
+	// Copies the data into the staging ring straight away. Returns false when the ring is full,
+	// the pending uploads have to be flushed first.
+	[[nodiscard]]
+	bool QueueUpload(
+		VkBuffer dstBuffer, VkDeviceSize dstOffset, void const* data, VkDeviceSize size
+	) noexcept;
+
+	// Only blocks if every batch slot is still in flight.
+	[[nodiscard]]
+	UploadBatch Flush(VkDevice device, bool signalSemaphore) noexcept;
+
+	[[nodiscard]]
+	bool IsBatchComplete(VkDevice device, std::uint64_t batchId) const noexcept;
+	void WaitForBatch(VkDevice device, std::uint64_t batchId) const noexcept;
+
+	[[nodiscard]]
+	size_t GetPendingCopyCount() const noexcept;
+
+private:
+	struct BatchSlot {
+		VkCommandPool commandPool;
+		VkCommandBuffer commandBuffer;
+		VkFence fence;
+		VkSemaphore semaphore;
+		std::uint64_t batchId;
+	};
+
+private:
+	VkDevice m_deviceRef;
+	VkQueue m_transferQueue;
+	UploadRingBuffer m_stagingBuffer;
+	std::vector<PendingCopy> m_pendingCopies;
+	std::array<BatchSlot, batchSlotCount> m_batchSlots;
+	std::uint64_t m_nextBatchId;
+};
+#endif
@@ -0,0 +1,400 @@
+#include <VertexCacheOptimizer.hpp>
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+#include <unordered_map>
+
+VertexCacheStats AnalyzeVertexCache(
+	std::span<const std::uint32_t> indices, size_t vertexCount, std::uint32_t cacheSize
+) {
+	// A vertex is in the cache while fewer than cacheSize misses happened after its own.
+	std::vector<size_t> missTimestamps(vertexCount, 0u);
+	std::vector<bool> referenced(vertexCount, false);
+	size_t missCount = 0u;
+	size_t referencedCount = 0u;
+
+	for (std::uint32_t index : indices) {
+		if (!referenced[index]) {
+			referenced[index] = true;
+			++referencedCount;
+		}
+
+		if (missTimestamps[index] == 0u || missCount - missTimestamps[index] >= cacheSize) {
+			++missCount;
+			missTimestamps[index] = missCount;
+		}
+	}
+
+	const size_t triangleCount = std::size(indices) / 3u;
+
+	return VertexCacheStats{
+		.acmr = triangleCount == 0u ?
+			0.f : static_cast<float>(missCount) / static_cast<float>(triangleCount),
+		.atvr = referencedCount == 0u ?
+			0.f : static_cast<float>(missCount) / static_cast<float>(referencedCount)
+	};
+}
+
+namespace {
+	class Tipsify {
+	public:
+		Tipsify(
+			std::span<const std::uint32_t> indices, size_t vertexCount, std::uint32_t cacheSize
+		) : m_indices{ indices }, m_cacheSize{ cacheSize },
+			m_triangleCount{ std::size(indices) / 3u },
+			m_liveTriangles(vertexCount, 0u), m_adjacencyOffsets(vertexCount + 1u, 0u),
+			m_adjacency(m_triangleCount * 3u), m_cacheTimestamps(vertexCount, 0u),
+			m_emitted(m_triangleCount, false), m_time{ cacheSize + 1u }, m_cursor{ 0u } {
+			for (size_t index = 0u; index < m_triangleCount * 3u; ++index)
+				++m_liveTriangles[indices[index]];
+
+			for (size_t vertex = 0u; vertex < vertexCount; ++vertex)
+				m_adjacencyOffsets[vertex + 1u] = m_adjacencyOffsets[vertex]
+					+ m_liveTriangles[vertex];
+
+			std::vector<std::uint32_t> fillOffsets{
+				std::begin(m_adjacencyOffsets), std::end(m_adjacencyOffsets) - 1
+			};
+
+			for (size_t index = 0u; index < m_triangleCount * 3u; ++index)
+				m_adjacency[fillOffsets[indices[index]]++]
+					= static_cast<std::uint32_t>(index / 3u);
+		}
+
+		[[nodiscard]]
+		std::vector<std::uint32_t> Optimize() {
+			std::vector<std::uint32_t> newIndices;
+			newIndices.reserve(m_triangleCount * 3u);
+
+			std::optional<std::uint32_t> fanningVertex = SkipDeadEnd();
+
+			while (fanningVertex) {
+				std::vector<std::uint32_t> candidates;
+
+				for (std::uint32_t adjacency = m_adjacencyOffsets[*fanningVertex];
+					adjacency < m_adjacencyOffsets[*fanningVertex + 1u]; ++adjacency) {
+					const std::uint32_t triangle = m_adjacency[adjacency];
+
+					if (m_emitted[triangle])
+						continue;
+
+					for (size_t corner = 0u; corner < 3u; ++corner) {
+						const std::uint32_t vertex = m_indices[triangle * 3u + corner];
+
+						newIndices.emplace_back(vertex);
+						m_deadEnds.emplace_back(vertex);
+						candidates.emplace_back(vertex);
+						--m_liveTriangles[vertex];
+
+						if (m_time - m_cacheTimestamps[vertex] > m_cacheSize)
+							m_cacheTimestamps[vertex] = m_time++;
+					}
+
+					m_emitted[triangle] = true;
+				}
+
+				fanningVertex = GetNextVertex(candidates);
+			}
+
+			return newIndices;
+		}
+
+	private:
+		[[nodiscard]]
+		std::optional<std::uint32_t> GetNextVertex(
+			const std::vector<std::uint32_t>& candidates
+		) noexcept {
+			std::optional<std::uint32_t> bestVertex;
+			size_t bestPriority = 0u;
+
+			for (std::uint32_t vertex : candidates) {
+				if (m_liveTriangles[vertex] == 0u)
+					continue;
+
+				// Prefer the oldest vertex which would still be in the cache
+				// after all of its triangles are emitted.
+				const size_t age = m_time - m_cacheTimestamps[vertex];
+
+				if (age + 2u * m_liveTriangles[vertex] <= m_cacheSize
+					&& (!bestVertex || age > bestPriority)) {
+					bestVertex = vertex;
+					bestPriority = age;
+				}
+			}
+
+			if (!bestVertex)
+				return SkipDeadEnd();
+
+			return bestVertex;
+		}
+
+		[[nodiscard]]
+		std::optional<std::uint32_t> SkipDeadEnd() noexcept {
+			while (!std::empty(m_deadEnds)) {
+				const std::uint32_t vertex = m_deadEnds.back();
+				m_deadEnds.pop_back();
+
+				if (m_liveTriangles[vertex] > 0u)
+					return vertex;
+			}
+
+			for (; m_cursor < std::size(m_liveTriangles); ++m_cursor)
+				if (m_liveTriangles[m_cursor] > 0u)
+					return static_cast<std::uint32_t>(m_cursor);
+
+			return {};
+		}
+
+	private:
+		std::span<const std::uint32_t> m_indices;
+		std::uint32_t m_cacheSize;
+		size_t m_triangleCount;
+		std::vector<std::uint32_t> m_liveTriangles;
+		std::vector<std::uint32_t> m_adjacencyOffsets;
+		std::vector<std::uint32_t> m_adjacency;
+		std::vector<size_t> m_cacheTimestamps;
+		std::vector<bool> m_emitted;
+		std::vector<std::uint32_t> m_deadEnds;
+		size_t m_time;
+		size_t m_cursor;
+	};
+}
+
+std::vector<std::uint32_t> OptimizeVertexCache(
+	std::span<const std::uint32_t> indices, size_t vertexCount, std::uint32_t cacheSize
+) {
+	return Tipsify{ indices, vertexCount, cacheSize }.Optimize();
+}
+
+// The same FIFO cache as Tipsify's, it is flushed by moving the time past the cache size.
+[[nodiscard]]
+static std::uint32_t CountCacheMisses(
+	std::span<const std::uint32_t> triangle, std::uint32_t cacheSize,
+	std::vector<size_t>& cacheTimestamps, size_t& time
+) noexcept {
+	std::uint32_t missCount = 0u;
+
+	for (std::uint32_t vertex : triangle)
+		if (time - cacheTimestamps[vertex] > cacheSize) {
+			cacheTimestamps[vertex] = time++;
+			++missCount;
+		}
+
+	return missCount;
+}
+
+std::vector<std::uint32_t> OptimizeOverdraw(
+	std::span<const std::uint32_t> indices, std::span<const std::array<float, 3u>> positions,
+	std::uint32_t cacheSize, float threshold
+) {
+	const size_t triangleCount = std::size(indices) / 3u;
+
+	if (triangleCount == 0u)
+		return std::vector<std::uint32_t>(std::begin(indices), std::end(indices));
+
+	auto getTriangle = [indices](size_t triangle) { return indices.subspan(triangle * 3u, 3u); };
+
+	std::vector<size_t> cacheTimestamps(std::size(positions), 0u);
+	size_t time = cacheSize + 1u;
+
+	// A triangle which misses with all of its vertices starts a new patch of the mesh.
+	std::vector<size_t> patchStarts;
+
+	for (size_t triangle = 0u; triangle < triangleCount; ++triangle)
+		if (CountCacheMisses(getTriangle(triangle), cacheSize, cacheTimestamps, time) == 3u
+			|| triangle == 0u)
+			patchStarts.emplace_back(triangle);
+
+	patchStarts.emplace_back(triangleCount);
+
+	// Every cluster starts with a cold cache once they are reordered, so a patch is only split
+	// where the triangles since the last split already reach the patch's ACMR within the
+	// threshold.
+	std::vector<size_t> clusterStarts;
+
+	for (size_t patch = 0u; patch + 1u < std::size(patchStarts); ++patch) {
+		const size_t patchStart = patchStarts[patch];
+		const size_t patchEnd = patchStarts[patch + 1u];
+
+		time += cacheSize + 1u;
+
+		size_t patchMissCount = 0u;
+		for (size_t triangle = patchStart; triangle < patchEnd; ++triangle)
+			patchMissCount += CountCacheMisses(
+				getTriangle(triangle), cacheSize, cacheTimestamps, time
+			);
+
+		const float targetAcmr = threshold * static_cast<float>(patchMissCount)
+			/ static_cast<float>(patchEnd - patchStart);
+
+		time += cacheSize + 1u;
+		clusterStarts.emplace_back(patchStart);
+
+		size_t clusterMissCount = 0u;
+		size_t clusterTriangleCount = 0u;
+
+		for (size_t triangle = patchStart; triangle + 1u < patchEnd; ++triangle) {
+			clusterMissCount += CountCacheMisses(
+				getTriangle(triangle), cacheSize, cacheTimestamps, time
+			);
+			++clusterTriangleCount;
+
+			if (static_cast<float>(clusterMissCount)
+				<= targetAcmr * static_cast<float>(clusterTriangleCount)) {
+				clusterStarts.emplace_back(triangle + 1u);
+
+				time += cacheSize + 1u;
+				clusterMissCount = 0u;
+				clusterTriangleCount = 0u;
+			}
+		}
+	}
+
+	clusterStarts.emplace_back(triangleCount);
+
+	std::array<float, 3u> meshCentre{};
+	for (const std::array<float, 3u>& position : positions)
+		for (size_t axis = 0u; axis < 3u; ++axis)
+			meshCentre[axis] += position[axis] / static_cast<float>(std::size(positions));
+
+	struct Cluster {
+		size_t start;
+		size_t end;
+		float sortKey;
+	};
+
+	std::vector<Cluster> clusters;
+
+	for (size_t cluster = 0u; cluster + 1u < std::size(clusterStarts); ++cluster) {
+		const size_t clusterStart = clusterStarts[cluster];
+		const size_t clusterEnd = clusterStarts[cluster + 1u];
+
+		// The centre is weighted by the area of the triangles, the unnormalised normals of the
+		// triangles already are.
+		std::array<float, 3u> centre{};
+		std::array<float, 3u> normal{};
+		float area = 0.f;
+
+		for (size_t triangle = clusterStart; triangle < clusterEnd; ++triangle) {
+			std::span<const std::uint32_t> corners = getTriangle(triangle);
+
+			const std::array<float, 3u>& position0 = positions[corners[0]];
+			const std::array<float, 3u>& position1 = positions[corners[1]];
+			const std::array<float, 3u>& position2 = positions[corners[2]];
+
+			std::array<float, 3u> edge1{};
+			std::array<float, 3u> edge2{};
+			for (size_t axis = 0u; axis < 3u; ++axis) {
+				edge1[axis] = position1[axis] - position0[axis];
+				edge2[axis] = position2[axis] - position0[axis];
+			}
+
+			const std::array<float, 3u> triangleNormal{
+				edge1[1] * edge2[2] - edge1[2] * edge2[1],
+				edge1[2] * edge2[0] - edge1[0] * edge2[2],
+				edge1[0] * edge2[1] - edge1[1] * edge2[0]
+			};
+			const float triangleArea = std::sqrt(
+				triangleNormal[0] * triangleNormal[0] + triangleNormal[1] * triangleNormal[1]
+				+ triangleNormal[2] * triangleNormal[2]
+			);
+
+			for (size_t axis = 0u; axis < 3u; ++axis) {
+				centre[axis] += (position0[axis] + position1[axis] + position2[axis]) / 3.f
+					* triangleArea;
+				normal[axis] += triangleNormal[axis];
+			}
+
+			area += triangleArea;
+		}
+
+		const float normalLength = std::sqrt(
+			normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]
+		);
+
+		// Degenerate clusters don't occlude anything, so where they go doesn't matter.
+		float sortKey = 0.f;
+
+		if (area > 0.f && normalLength > 0.f)
+			for (size_t axis = 0u; axis < 3u; ++axis)
+				sortKey += (centre[axis] / area - meshCentre[axis]) * normal[axis] / normalLength;
+
+		clusters.emplace_back(Cluster{
+			.start = clusterStart, .end = clusterEnd, .sortKey = sortKey
+		});
+	}
+
+	std::ranges::stable_sort(clusters, std::ranges::greater{}, &Cluster::sortKey);
+
+	std::vector<std::uint32_t> newIndices;
+	newIndices.reserve(triangleCount * 3u);
+
+	for (const Cluster& cluster : clusters)
+		newIndices.insert(
+			std::end(newIndices), std::begin(indices) + cluster.start * 3u,
+			std::begin(indices) + cluster.end * 3u
+		);
+
+	return newIndices;
+}
+
+std::vector<std::uint32_t> CreateVertexFetchRemap(
+	std::span<const std::uint32_t> indices, size_t vertexCount
+) {
+	std::vector<std::uint32_t> remap(vertexCount, unusedVertex);
+	std::uint32_t nextIndex = 0u;
+
+	for (std::uint32_t index : indices)
+		if (remap[index] == unusedVertex)
+			remap[index] = nextIndex++;
+
+	return remap;
+}
+
+std::vector<std::uint32_t> CreateDuplicateVertexRemap(
+	std::span<const std::byte> vertexData, size_t vertexStride
+) {
+	const size_t vertexCount = std::size(vertexData) / vertexStride;
+
+	std::vector<std::uint32_t> remap(vertexCount, unusedVertex);
+	std::unordered_map<std::string_view, std::uint32_t> uniqueVertices;
+	uniqueVertices.reserve(vertexCount);
+
+	std::uint32_t nextIndex = 0u;
+
+	for (size_t vertex = 0u; vertex < vertexCount; ++vertex) {
+		const std::string_view vertexBytes{
+			reinterpret_cast<const char*>(std::data(vertexData) + vertex * vertexStride),
+			vertexStride
+		};
+
+		auto [uniqueVertex, inserted] = uniqueVertices.try_emplace(vertexBytes, nextIndex);
+
+		if (inserted)
+			++nextIndex;
+
+		remap[vertex] = uniqueVertex->second;
+	}
+
+	return remap;
+}
+
+void RemapIndices(std::span<std::uint32_t> indices, std::span<const std::uint32_t> remap) noexcept {
+	for (std::uint32_t& index : indices)
+		index = remap[index];
+}
+
+std::optional<std::vector<std::uint16_t>> NarrowIndices(
+	std::span<const std::uint32_t> indices, size_t vertexCount
+) {
+	if (vertexCount > std::numeric_limits<std::uint16_t>::max() + 1u)
+		return {};
+
+	std::vector<std::uint16_t> indices16;
+	indices16.reserve(std::size(indices));
+
+	for (std::uint32_t index : indices)
+		indices16.emplace_back(static_cast<std::uint16_t>(index));
+
+	return indices16;
+}
@@ -0,0 +1,150 @@
+#ifndef VERTEX_CACHE_OPTIMIZER_HPP_
+#define VERTEX_CACHE_OPTIMIZER_HPP_
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// Marks the vertices which aren't referenced by any index in a remap table.
+inline constexpr std::uint32_t unusedVertex = std::numeric_limits<std::uint32_t>::max();
+
+struct VertexCacheStats {
+	// Transformed vertices per triangle. 0.5 is the best possible and 3 the worst.
+	float acmr;
+	// Transformed vertices per referenced vertex. 1 is the best possible.
+	float atvr;
+};
+
+// Simulates a FIFO post-transform cache of cacheSize entries.
+[[nodiscard]]
+VertexCacheStats AnalyzeVertexCache(
+	std::span<const std::uint32_t> indices, size_t vertexCount, std::uint32_t cacheSize = 16u
+);
+
+// Tipsify: Sander, Nehab and Barczak, "Fast Triangle Reordering for Vertex Locality
+// and Reduced Overdraw".
+[[nodiscard]]
+std::vector<std::uint32_t> OptimizeVertexCache(
+	std::span<const std::uint32_t> indices, size_t vertexCount, std::uint32_t cacheSize = 16u
+);
+
+// The second step of Tipsify, for indices which were already optimised for the vertex cache. The
+// triangles are split into clusters, at the points where the cache was cold anyway and wherever
+// the triangles so far already reach the ACMR of their patch times the threshold. The clusters
+// facing away from the centre of the mesh are drawn first, as they are the most likely to occlude
+// the others. A higher threshold allows smaller clusters, which lowers the overdraw further but
+// costs more cache misses.
+[[nodiscard]]
+std::vector<std::uint32_t> OptimizeOverdraw(
+	std::span<const std::uint32_t> indices, std::span<const std::array<float, 3u>> positions,
+	std::uint32_t cacheSize = 16u, float threshold = 1.05f
+);
+
+// Returns the new index of every vertex in the order the indices first use them.
+[[nodiscard]]
+std::vector<std::uint32_t> CreateVertexFetchRemap(
+	std::span<const std::uint32_t> indices, size_t vertexCount
+);
+
+// Returns the new index of every vertex, with bitwise identical vertices sharing one.
+// So the padding bytes of the vertex type must be zeroed.
+[[nodiscard]]
+std::vector<std::uint32_t> CreateDuplicateVertexRemap(
+	std::span<const std::byte> vertexData, size_t vertexStride
+);
+
+void RemapIndices(std::span<std::uint32_t> indices, std::span<const std::uint32_t> remap) noexcept;
+
+// Returns the indices as 16 bits if every vertex can be addressed.
+[[nodiscard]]
+std::optional<std::vector<std::uint16_t>> NarrowIndices(
+	std::span<const std::uint32_t> indices, size_t vertexCount
+);
+
+template<typename Vertex>
+[[nodiscard]]
+std::vector<Vertex> RemapVertices(
+	std::span<const Vertex> vertices, std::span<const std::uint32_t> remap
+) {
+	size_t newVertexCount = 0u;
+	for (std::uint32_t newIndex : remap)
+		if (newIndex != unusedVertex && newIndex >= newVertexCount)
+			newVertexCount = newIndex + 1u;
+
+	std::vector<Vertex> newVertices(newVertexCount);
+
+	for (size_t index = 0u; index < std::size(remap); ++index)
+		if (remap[index] != unusedVertex)
+			newVertices[remap[index]] = vertices[index];
+
+	return newVertices;
+}
+
+template<typename Vertex>
+struct OptimizedMesh {
+	std::vector<Vertex> vertices;
+	std::vector<std::uint32_t> indices;
+	// Empty if there are more vertices than 16 bit indices can address.
+	std::vector<std::uint16_t> indices16;
+	VertexCacheStats statsBefore;
+	VertexCacheStats statsAfter;
+};
+
+// Removes the duplicate vertices, reorders the triangles for the vertex cache and overdraw and
+// then the vertices for fetch locality. Deduplication comes first, so the cache
+// optimisation sees which triangles actually share their vertices. The positions are those of
+// the vertices, the overdraw step is skipped without them.
+template<typename Vertex>
+[[nodiscard]]
+OptimizedMesh<Vertex> OptimizeMesh(
+	std::span<const Vertex> vertices, std::span<const std::uint32_t> indices,
+	std::span<const std::array<float, 3u>> positions = {}, std::uint32_t cacheSize = 16u,
+	float overdrawThreshold = 1.05f
+) {
+	static_assert(
+		std::is_trivially_copyable_v<Vertex>, "Vertices are deduplicated by their bytes."
+	);
+
+	OptimizedMesh<Vertex> mesh{};
+	mesh.statsBefore = AnalyzeVertexCache(indices, std::size(vertices), cacheSize);
+
+	const std::vector<std::uint32_t> duplicateRemap = CreateDuplicateVertexRemap(
+		std::as_bytes(vertices), sizeof(Vertex)
+	);
+	std::vector<Vertex> uniqueVertices = RemapVertices(vertices, std::span{ duplicateRemap });
+
+	std::vector<std::uint32_t> uniqueIndices{ std::begin(indices), std::end(indices) };
+	RemapIndices(uniqueIndices, duplicateRemap);
+
+	mesh.indices = OptimizeVertexCache(uniqueIndices, std::size(uniqueVertices), cacheSize);
+
+	if (!std::empty(positions)) {
+		const std::vector<std::array<float, 3u>> uniquePositions = RemapVertices(
+			positions, duplicateRemap
+		);
+
+		mesh.indices = OptimizeOverdraw(
+			mesh.indices, uniquePositions, cacheSize, overdrawThreshold
+		);
+	}
+
+	const std::vector<std::uint32_t> fetchRemap = CreateVertexFetchRemap(
+		mesh.indices, std::size(uniqueVertices)
+	);
+	mesh.vertices = RemapVertices(std::span<const Vertex>{ uniqueVertices }, fetchRemap);
+	RemapIndices(mesh.indices, fetchRemap);
+
+	mesh.statsAfter = AnalyzeVertexCache(mesh.indices, std::size(mesh.vertices), cacheSize);
+
+	if (std::optional<std::vector<std::uint16_t>> indices16 = NarrowIndices(
+		mesh.indices, std::size(mesh.vertices)
+	))
+		mesh.indices16 = std::move(*indices16);
+
+	return mesh;
+}
+#endif
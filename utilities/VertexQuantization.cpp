@@ -0,0 +1,168 @@
+#include <VertexQuantization.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+QuantizationBounds ComputeQuantizationBounds(std::span<const Float3> positions) noexcept {
+	if (std::empty(positions))
+		return QuantizationBounds{ .center = { 0.f, 0.f, 0.f }, .extent = { 1.f, 1.f, 1.f } };
+
+	Float3 minimum = positions.front();
+	Float3 maximum = positions.front();
+
+	for (const Float3& position : positions)
+		for (size_t axis = 0u; axis < 3u; ++axis) {
+			minimum[axis] = std::min(minimum[axis], position[axis]);
+			maximum[axis] = std::max(maximum[axis], position[axis]);
+		}
+
+	QuantizationBounds bounds{};
+
+	for (size_t axis = 0u; axis < 3u; ++axis) {
+		bounds.center[axis] = (minimum[axis] + maximum[axis]) * 0.5f;
+		// A flat axis would otherwise divide by zero.
+		bounds.extent[axis] = std::max((maximum[axis] - minimum[axis]) * 0.5f, 1e-6f);
+	}
+
+	return bounds;
+}
+
+std::int16_t EncodeSnorm16(float value) noexcept {
+	return static_cast<std::int16_t>(std::lround(std::clamp(value, -1.f, 1.f) * 32'767.f));
+}
+
+float DecodeSnorm16(std::int16_t value) noexcept {
+	// -32768 and -32767 both map to -1.
+	return std::max(static_cast<float>(value) / 32'767.f, -1.f);
+}
+
+std::array<std::int16_t, 4u> EncodePosition(
+	const Float3& position, const QuantizationBounds& bounds
+) noexcept {
+	std::array<std::int16_t, 4u> encodedPosition{ 0, 0, 0, 32'767 };
+
+	for (size_t axis = 0u; axis < 3u; ++axis)
+		encodedPosition[axis] = EncodeSnorm16(
+			(position[axis] - bounds.center[axis]) / bounds.extent[axis]
+		);
+
+	return encodedPosition;
+}
+
+Float3 DecodePosition(
+	const std::array<std::int16_t, 4u>& position, const QuantizationBounds& bounds
+) noexcept {
+	Float3 decodedPosition{};
+
+	for (size_t axis = 0u; axis < 3u; ++axis)
+		decodedPosition[axis] = bounds.center[axis]
+			+ DecodeSnorm16(position[axis]) * bounds.extent[axis];
+
+	return decodedPosition;
+}
+
+[[nodiscard]]
+static float SignNotZero(float value) noexcept {
+	return value >= 0.f ? 1.f : -1.f;
+}
+
+std::array<std::int16_t, 2u> EncodeOctahedral(const Float3& normal) noexcept {
+	const float length = std::abs(normal[0]) + std::abs(normal[1]) + std::abs(normal[2]);
+
+	if (length == 0.f)
+		return { 0, 0 };
+
+	float x = normal[0] / length;
+	float y = normal[1] / length;
+
+	// The lower hemisphere is folded over the diagonals.
+	if (normal[2] < 0.f) {
+		const float foldedX = (1.f - std::abs(y)) * SignNotZero(x);
+		const float foldedY = (1.f - std::abs(x)) * SignNotZero(y);
+
+		x = foldedX;
+		y = foldedY;
+	}
+
+	return { EncodeSnorm16(x), EncodeSnorm16(y) };
+}
+
+Float3 DecodeOctahedral(const std::array<std::int16_t, 2u>& normal) noexcept {
+	float x = DecodeSnorm16(normal[0]);
+	float y = DecodeSnorm16(normal[1]);
+	const float z = 1.f - std::abs(x) - std::abs(y);
+
+	if (z < 0.f) {
+		const float unfoldedX = (1.f - std::abs(y)) * SignNotZero(x);
+		const float unfoldedY = (1.f - std::abs(x)) * SignNotZero(y);
+
+		x = unfoldedX;
+		y = unfoldedY;
+	}
+
+	const float length = std::sqrt(x * x + y * y + z * z);
+
+	return { x / length, y / length, z / length };
+}
+
+std::uint16_t EncodeHalf(float value) noexcept {
+	const auto bits = std::bit_cast<std::uint32_t>(value);
+	const auto sign = static_cast<std::uint16_t>((bits >> 16u) & 0x8000u);
+	const std::uint32_t absolute = bits & 0x7FFF'FFFFu;
+
+	// NaN stays a quiet NaN.
+	if (absolute > 0x7F80'0000u)
+		return sign | 0x7E00u;
+
+	// Too large values and infinity become infinity.
+	if (absolute >= 0x4780'0000u)
+		return sign | 0x7C00u;
+
+	// Normal halves.
+	if (absolute >= 0x3880'0000u) {
+		const std::uint32_t rebiased = absolute - 0x3800'0000u;
+		const std::uint32_t rounded = rebiased + 0x0FFFu + ((rebiased >> 13u) & 1u);
+
+		return sign | static_cast<std::uint16_t>(rounded >> 13u);
+	}
+
+	// Denormal halves, which are multiples of 2^-24.
+	const float denormal = std::bit_cast<float>(absolute) * 16'777'216.f;
+
+	return sign | static_cast<std::uint16_t>(std::lrint(denormal));
+}
+
+float DecodeHalf(std::uint16_t value) noexcept {
+	const float sign = (value & 0x8000u) != 0u ? -1.f : 1.f;
+	const std::uint32_t exponent = (value >> 10u) & 0x1Fu;
+	const std::uint32_t mantissa = value & 0x3FFu;
+
+	if (exponent == 0u)
+		return sign * std::ldexp(static_cast<float>(mantissa), -24);
+
+	if (exponent == 0x1Fu)
+		return mantissa == 0u ?
+			sign * std::numeric_limits<float>::infinity()
+			: std::numeric_limits<float>::quiet_NaN();
+
+	return sign * std::ldexp(
+		static_cast<float>(mantissa | 0x400u), static_cast<int>(exponent) - 25
+	);
+}
+
+QuantizedVertex QuantizeVertex(
+	const Float3& position, const Float3& normal, const Float2& uv,
+	const QuantizationBounds& bounds
+) noexcept {
+	const std::array<std::int16_t, 4u> encodedPosition = EncodePosition(position, bounds);
+	const std::array<std::int16_t, 2u> encodedNormal = EncodeOctahedral(normal);
+
+	return QuantizedVertex{
+		.position = {
+			encodedPosition[0], encodedPosition[1], encodedPosition[2], encodedPosition[3]
+		},
+		.normal = { encodedNormal[0], encodedNormal[1] },
+		.uv = { EncodeHalf(uv[0]), EncodeHalf(uv[1]) }
+	};
+}
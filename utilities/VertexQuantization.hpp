@@ -0,0 +1,60 @@
+#ifndef VERTEX_QUANTIZATION_HPP_
+#define VERTEX_QUANTIZATION_HPP_
+#include <array>
+#include <cstdint>
+#include <span>
+
+using Float3 = std::array<float, 3u>;
+using Float2 = std::array<float, 2u>;
+
+// The box the snorm16 positions are relative to. The shader restores a position with
+// center + quantizedPosition * extent.
+struct QuantizationBounds {
+	Float3 center;
+	Float3 extent;
+};
+
+// Half the size of a vertex stored as float3 position, float3 normal and float2 uv.
+struct QuantizedVertex {
+	// The w component is always 1, so the snorm fetch can be used as a homogeneous position.
+	std::int16_t position[4];
+	std::int16_t normal[2];
+	std::uint16_t uv[2];
+};
+
+[[nodiscard]]
+QuantizationBounds ComputeQuantizationBounds(std::span<const Float3> positions) noexcept;
+
+[[nodiscard]]
+std::int16_t EncodeSnorm16(float value) noexcept;
+[[nodiscard]]
+float DecodeSnorm16(std::int16_t value) noexcept;
+
+[[nodiscard]]
+std::array<std::int16_t, 4u> EncodePosition(
+	const Float3& position, const QuantizationBounds& bounds
+) noexcept;
+[[nodiscard]]
+Float3 DecodePosition(
+	const std::array<std::int16_t, 4u>& position, const QuantizationBounds& bounds
+) noexcept;
+
+// Octahedral encoding of a unit vector: Cigolle et al., "A Survey of Efficient
+// Representations for Independent Unit Vectors".
+[[nodiscard]]
+std::array<std::int16_t, 2u> EncodeOctahedral(const Float3& normal) noexcept;
+[[nodiscard]]
+Float3 DecodeOctahedral(const std::array<std::int16_t, 2u>& normal) noexcept;
+
+// IEEE 754 binary16, rounded to the nearest even.
+[[nodiscard]]
+std::uint16_t EncodeHalf(float value) noexcept;
+[[nodiscard]]
+float DecodeHalf(std::uint16_t value) noexcept;
+
+[[nodiscard]]
+QuantizedVertex QuantizeVertex(
+	const Float3& position, const Float3& normal, const Float2& uv,
+	const QuantizationBounds& bounds
+) noexcept;
+#endif
@@ -0,0 +1,33 @@
+#include <WorkerThreads.hpp>
+#include <algorithm>
+
+WorkerThreads::WorkerThreads(std::condition_variable_any& wakeCondition)
+	: m_wakeCondition{ wakeCondition } {}
+
+WorkerThreads::~WorkerThreads() noexcept {
+	for (auto& thread : m_threads)
+		thread.request_stop();
+
+	m_wakeCondition.notify_all();
+	// The jthreads join when they are destroyed.
+}
+
+void WorkerThreads::Start(size_t threadCount, const WorkerFunction& function) {
+	threadCount = ResolveCount(threadCount);
+
+	for (size_t index = 0u; index < threadCount; ++index)
+		m_threads.emplace_back([function, index](std::stop_token stopToken) {
+			function(stopToken, index);
+		});
+}
+
+size_t WorkerThreads::GetCount() const noexcept {
+	return std::size(m_threads);
+}
+
+size_t WorkerThreads::ResolveCount(size_t threadCount) noexcept {
+	if (threadCount == 0u)
+		return std::max(std::thread::hardware_concurrency(), 1u);
+
+	return threadCount;
+}
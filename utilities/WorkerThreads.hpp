@@ -0,0 +1,38 @@
+#ifndef WORKER_THREADS_HPP_
+#define WORKER_THREADS_HPP_
+#include <condition_variable>
+#include <functional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+// The threads of ThreadPool and JobSystem. Each one runs the worker function until it returns.
+// When destroyed, every thread is asked to stop before any is joined, and the condition the
+// workers wait on is notified.
+class WorkerThreads {
+public:
+	// stopToken, workerIndex.
+	using WorkerFunction = std::function<void(std::stop_token, size_t)>;
+
+public:
+	WorkerThreads(std::condition_variable_any& wakeCondition);
+	~WorkerThreads() noexcept;
+
+	WorkerThreads(const WorkerThreads&) = delete;
+	WorkerThreads& operator=(const WorkerThreads&) = delete;
+
+	// Only call once, after everything the workers use was created.
+	void Start(size_t threadCount, const WorkerFunction& function);
+
+	[[nodiscard]]
+	size_t GetCount() const noexcept;
+
+	// A threadCount of 0 is one per hardware thread.
+	[[nodiscard]]
+	static size_t ResolveCount(size_t threadCount) noexcept;
+
+private:
+	std::condition_variable_any& m_wakeCondition;
+	std::vector<std::jthread> m_threads;
+};
+#endif